@@ -0,0 +1,222 @@
+#include "bench_harness.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace bench {
+
+namespace {
+
+// Calibration stops doubling here even if the sample is still short (guards runaway bodies)
+constexpr long long MAX_ITERATIONS = 1LL << 40;
+
+double time_ns(const body& fn, long long iterations) {
+    auto start = std::chrono::steady_clock::now();
+    fn(iterations);
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+bool matches(const std::string& name, const char* filter) {
+    return filter == nullptr || name.find(filter) != std::string::npos;
+}
+
+void write_escaped(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+    out << '"';
+}
+
+// Parse the string value following `"key":` at or after pos; advances pos past it
+bool read_string_field(const std::string& text, const char* key, size_t& pos, std::string& out) {
+    std::string pattern = std::string("\"") + key + "\"";
+    size_t key_pos = text.find(pattern, pos);
+    if (key_pos == std::string::npos) {
+        return false;
+    }
+    size_t open = text.find('"', text.find(':', key_pos + pattern.size()));
+    if (open == std::string::npos) {
+        return false;
+    }
+
+    out.clear();
+    size_t i = open + 1;
+    for (; i < text.size() && text[i] != '"'; ++i) {
+        if (text[i] == '\\' && i + 1 < text.size()) {
+            ++i;
+        }
+        out += text[i];
+    }
+    pos = i + 1;
+    return i < text.size();
+}
+
+// Parse the numeric value following `"key":` between pos and limit
+bool read_number_field(const std::string& text, const char* key, size_t pos, size_t limit,
+                       double& out) {
+    std::string pattern = std::string("\"") + key + "\"";
+    size_t key_pos = text.find(pattern, pos);
+    if (key_pos == std::string::npos || key_pos >= limit) {
+        return false;
+    }
+    size_t colon = text.find(':', key_pos + pattern.size());
+    if (colon == std::string::npos) {
+        return false;
+    }
+    const char* start = text.c_str() + colon + 1;
+    char* end = nullptr;
+    out = std::strtod(start, &end);
+    return end != start;
+}
+
+} // namespace
+
+void suite::add(std::string name, body fn) {
+    entries.push_back({std::move(name), std::move(fn)});
+}
+
+void suite::list() const {
+    for (const auto& e : entries) {
+        std::printf("%s\n", e.name.c_str());
+    }
+}
+
+std::vector<result> suite::run(const run_options& options) const {
+    std::vector<result> results;
+    double min_sample_ns = options.min_sample_ms * 1e6;
+    int samples = std::max(options.samples, 1);
+
+    std::printf("%-48s %14s %14s %14s\n", "benchmark", "ns/op", "min ns/op", "iterations");
+    for (const auto& e : entries) {
+        if (!matches(e.name, options.filter)) {
+            continue;
+        }
+
+        // Untimed setup call: fixtures built on first use are ready before calibration
+        e.fn(0);
+
+        // Warm caches and calibrate: double until one sample is long enough to time reliably
+        long long iterations = 1;
+        while (time_ns(e.fn, iterations) < min_sample_ns && iterations < MAX_ITERATIONS) {
+            iterations *= 2;
+        }
+
+        std::vector<double> per_op(static_cast<size_t>(samples));
+        for (double& sample : per_op) {
+            sample = time_ns(e.fn, iterations) / static_cast<double>(iterations);
+        }
+        std::sort(per_op.begin(), per_op.end());
+
+        result r;
+        r.name = e.name;
+        r.ns_per_op = per_op[per_op.size() / 2];
+        r.min_ns_per_op = per_op.front();
+        r.iterations = iterations;
+        r.samples = samples;
+        results.push_back(r);
+
+        std::printf("%-48s %14.2f %14.2f %14lld\n", r.name.c_str(), r.ns_per_op, r.min_ns_per_op,
+                    r.iterations);
+        std::fflush(stdout);
+    }
+    return results;
+}
+
+bool write_json(const char* path, const char* suite_name, const std::vector<result>& results) {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    file << "{\n  \"suite\": ";
+    write_escaped(file, suite_name);
+    file << ",\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        char numbers[160];
+        std::snprintf(numbers, sizeof(numbers),
+                      "\"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f, \"iterations\": %lld, "
+                      "\"samples\": %d",
+                      r.ns_per_op, r.min_ns_per_op, r.iterations, r.samples);
+        file << "    {\"name\": ";
+        write_escaped(file, r.name);
+        file << ", " << numbers << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+bool read_json(const char* path, std::vector<result>& out) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string text = buffer.str();
+
+    out.clear();
+    size_t pos = text.find("\"benchmarks\"");
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    // One object per benchmark; fields are looked up within the object's braces
+    result r;
+    while (read_string_field(text, "name", pos, r.name)) {
+        size_t object_end = text.find('}', pos);
+        if (object_end == std::string::npos) {
+            break;
+        }
+
+        double value = 0.0;
+        if (read_number_field(text, "ns_per_op", pos, object_end, value)) {
+            r.ns_per_op = value;
+            r.min_ns_per_op = read_number_field(text, "min_ns_per_op", pos, object_end, value)
+                                  ? value
+                                  : r.ns_per_op;
+            r.iterations = read_number_field(text, "iterations", pos, object_end, value)
+                               ? static_cast<long long>(value)
+                               : 0;
+            r.samples = read_number_field(text, "samples", pos, object_end, value)
+                            ? static_cast<int>(value)
+                            : 0;
+            out.push_back(r);
+        }
+        pos = object_end + 1;
+    }
+    return !out.empty();
+}
+
+std::vector<comparison> compare(const std::vector<result>& baseline,
+                                const std::vector<result>& current, double threshold) {
+    std::vector<comparison> comparisons;
+    for (const auto& now : current) {
+        auto it = std::find_if(baseline.begin(), baseline.end(),
+                               [&](const result& before) { return before.name == now.name; });
+        if (it == baseline.end() || it->ns_per_op <= 0.0) {
+            continue;
+        }
+
+        comparison c;
+        c.name = now.name;
+        c.baseline_ns = it->ns_per_op;
+        c.current_ns = now.ns_per_op;
+        c.change = (c.current_ns - c.baseline_ns) / c.baseline_ns;
+        c.regression = c.change > threshold;
+        comparisons.push_back(c);
+    }
+    return comparisons;
+}
+
+} // namespace bench
@@ -0,0 +1,84 @@
+#pragma once
+
+// Minimal microbenchmark harness for froglords_bench
+//
+// Each benchmark body runs its operation a requested number of times. The harness doubles the
+// iteration count until one sample takes at least min_sample_ms, then times several samples
+// and reports the median (robust against the odd preempted sample) alongside the fastest.
+// Results can be written to JSON and compared against a previous run's JSON.
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// Keep a computed value alive so the optimizer can't delete the work that produced it
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+// Runs the benchmarked operation `iterations` times. Called once with 0 (untimed) before
+// calibration, so fixtures created on first use (worker threads, generated worlds) are not
+// measured.
+using body = std::function<void(long long iterations)>;
+
+struct run_options {
+    const char* filter = nullptr; // run only benchmarks whose name contains this
+    double min_sample_ms = 20.0;  // calibrate iterations until one sample takes this long
+    int samples = 7;              // timed samples per benchmark (median reported)
+};
+
+struct result {
+    std::string name;
+    double ns_per_op = 0.0;     // median over samples
+    double min_ns_per_op = 0.0; // fastest sample
+    long long iterations = 0;   // per sample
+    int samples = 0;
+};
+
+struct comparison {
+    std::string name;
+    double baseline_ns = 0.0;
+    double current_ns = 0.0;
+    double change = 0.0; // (current - baseline) / baseline
+    bool regression = false;
+};
+
+class suite {
+  public:
+    void add(std::string name, body fn);
+
+    // Print names of registered benchmarks
+    void list() const;
+
+    // Run matching benchmarks in registration order, printing one line per result
+    std::vector<result> run(const run_options& options) const;
+
+  private:
+    struct entry {
+        std::string name;
+        body fn;
+    };
+    std::vector<entry> entries;
+};
+
+// Write results as {"suite": ..., "benchmarks": [{"name": ..., "ns_per_op": ...}, ...]}
+bool write_json(const char* path, const char* suite_name, const std::vector<result>& results);
+
+// Read results from a file written by write_json; returns false if unreadable or empty
+bool read_json(const char* path, std::vector<result>& out);
+
+// Match current results to the baseline by name. A benchmark regresses when its median is
+// more than `threshold` (fraction, 0.1 = 10%) slower. Benchmarks missing from either side
+// are skipped.
+std::vector<comparison> compare(const std::vector<result>& baseline,
+                                const std::vector<result>& current, double threshold);
+
+} // namespace bench
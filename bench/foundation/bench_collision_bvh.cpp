@@ -0,0 +1,138 @@
+// Collision Broadphase Benchmark
+// Per-query cost of the BVH broadphase versus box count (10 to 1M boxes), with the
+// exhaustive path measured both box-at-a-time (scalar) and through the SoA batch kernel
+//
+// Boxes are scattered at constant density, so the number of boxes near any query stays
+// roughly fixed while the world grows; a scalable broadphase keeps per-query cost flat.
+
+#include "foundation/collision.h"
+#include "foundation/collision_bvh.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+// TUNED: World layout for scaling runs
+constexpr float BOX_SPACING = 4.0f;     // meters (average spacing between box centers)
+constexpr float SPHERE_RADIUS = 0.5f;    // meters (matches controller BUMPER_RADIUS)
+constexpr float SWEEP_DISTANCE = 0.15f; // meters (~9 m/s at 60Hz)
+constexpr int QUERY_COUNT = 100000;
+// Exhaustive resolution is O(N) per query; cap its total work so large worlds finish
+constexpr double EXHAUSTIVE_BOX_TESTS_BUDGET = 2e9;
+
+struct query_sample {
+    glm::vec3 start;
+    glm::vec3 end;
+};
+
+collision_world make_world(int box_count, std::mt19937& rng) {
+    float side = std::sqrt(static_cast<float>(box_count)) * BOX_SPACING;
+    std::uniform_real_distribution<float> position(-side * 0.5f, side * 0.5f);
+    std::uniform_real_distribution<float> extent(0.1f, 1.0f);
+    std::uniform_real_distribution<float> height(0.0f, 2.0f);
+
+    collision_world world;
+    world.boxes.reserve(box_count);
+    for (int i = 0; i < box_count; ++i) {
+        collision_box box;
+        box.bounds.center = glm::vec3(position(rng), height(rng), position(rng));
+        box.bounds.half_extents = glm::vec3(extent(rng), extent(rng), extent(rng));
+        box.type = collision_surface_type::WALL;
+        world.boxes.push_back(box);
+    }
+    return world;
+}
+
+std::vector<query_sample> make_queries(int box_count, std::mt19937& rng) {
+    float side = std::sqrt(static_cast<float>(box_count)) * BOX_SPACING;
+    std::uniform_real_distribution<float> position(-side * 0.5f, side * 0.5f);
+    std::uniform_real_distribution<float> height(0.0f, 2.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+    std::vector<query_sample> queries(QUERY_COUNT);
+    for (auto& query : queries) {
+        query.start = glm::vec3(position(rng), height(rng), position(rng));
+        float a = angle(rng);
+        query.end = query.start + glm::vec3(std::sin(a), 0.0f, std::cos(a)) * SWEEP_DISTANCE;
+    }
+    return queries;
+}
+
+double elapsed_ns(std::chrono::steady_clock::time_point start) {
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count());
+}
+
+// Resolve every query against the world; returns ns per query
+double time_resolve(const collision_world& world, const std::vector<query_sample>& queries,
+                    int query_count, float& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < query_count; ++i) {
+        sphere s{queries[i].start, SPHERE_RADIUS};
+        glm::vec3 position = queries[i].end;
+        glm::vec3 velocity = (queries[i].end - queries[i].start) * 60.0f;
+        sphere_collision contact = resolve_collisions(s, world, position, velocity, 0.707f);
+        checksum += position.x + (contact.hit ? 1.0f : 0.0f);
+    }
+    return elapsed_ns(start) / static_cast<double>(query_count);
+}
+
+} // namespace
+
+int main() {
+    const int box_counts[] = {10, 100, 1000, 10000, 100000, 1000000};
+
+    printf("Collision broadphase scaling (%d queries, radius %.2fm)\n\n", QUERY_COUNT,
+           SPHERE_RADIUS);
+    printf("%10s %10s %10s %12s %14s %16s %12s %9s\n", "boxes", "nodes", "build_ms", "query_ns",
+           "resolve_ns", "exhaustive_ns", "soa_ns", "speedup");
+
+    float checksum = 0.0f;
+    for (int box_count : box_counts) {
+        std::mt19937 rng(12345u + static_cast<unsigned>(box_count));
+        collision_world exhaustive = make_world(box_count, rng);
+        std::vector<query_sample> queries = make_queries(box_count, rng);
+
+        collision_world world = exhaustive;
+        auto build_start = std::chrono::steady_clock::now();
+        build_broadphase(world);
+        double build_ms = elapsed_ns(build_start) * 1e-6;
+
+        // Raw broadphase query (swept sphere bounds → candidate indices)
+        uint32_t candidates[256];
+        size_t total_candidates = 0;
+        auto query_start = std::chrono::steady_clock::now();
+        for (const auto& query : queries) {
+            glm::vec3 pad(SPHERE_RADIUS);
+            total_candidates += query_bvh(world.bvh, glm::min(query.start, query.end) - pad,
+                                          glm::max(query.start, query.end) + pad, candidates, 256);
+        }
+        double query_ns = elapsed_ns(query_start) / static_cast<double>(QUERY_COUNT);
+        checksum += static_cast<float>(total_candidates);
+
+        double resolve_ns = time_resolve(world, queries, QUERY_COUNT, checksum);
+
+        int exhaustive_queries = static_cast<int>(
+            std::min<double>(QUERY_COUNT, EXHAUSTIVE_BOX_TESTS_BUDGET / box_count));
+        exhaustive_queries = std::max(exhaustive_queries, 10);
+        double exhaustive_ns = time_resolve(exhaustive, queries, exhaustive_queries, checksum);
+
+        // Exhaustive path through the SoA kernel (BVH dropped)
+        collision_world batched = world;
+        batched.bvh = collision_bvh{};
+        double soa_ns = time_resolve(batched, queries, exhaustive_queries, checksum);
+
+        printf("%10d %10zu %10.2f %12.1f %14.1f %16.1f %12.1f %8.1fx\n", box_count,
+               world.bvh.nodes.size(), build_ms, query_ns, resolve_ns, exhaustive_ns, soa_ns,
+               exhaustive_ns / resolve_ns);
+    }
+
+    printf("\n(checksum %.3f)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,716 @@
+// FrogLords Microbenchmark Suite
+// Hot-path cost of collision, vehicle simulation, reactive systems and mesh generation, and
+// job_system scaling of the parallel paths from 1 to 32 threads
+//
+// Usage:
+//   froglords_bench [--filter TEXT] [--json PATH] [--baseline PATH] [--threshold PERCENT]
+//                   [--min-time MS] [--samples N] [--list]
+//
+// --json writes this run's results; --baseline compares against a previous --json file and
+// flags benchmarks whose median slowed by more than --threshold percent (default 10).
+// Exit code: 0 = ok, 1 = usage/IO error, 2 = regression against the baseline.
+
+#include "bench_harness.h"
+#include "app/debug_generation.h"
+#include "app/game_world.h"
+#include "app/input_script.h"
+#include "app/stress_level.h"
+#include "foundation/collision.h"
+#include "foundation/collision_query.h"
+#include "foundation/procedural_mesh.h"
+#include "foundation/mesh_cache.h"
+#include "foundation/spring_damper.h"
+#include "foundation/math_utils.h"
+#include "foundation/profiler.h"
+#include "foundation/trace.h"
+#include "foundation/job_system.h"
+#include "vehicle/vehicle_fleet.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// TUNED: Collision workload (matches bench_collision_bvh layout: constant box density)
+constexpr float BOX_SPACING = 4.0f;     // meters (average spacing between box centers)
+constexpr float SPHERE_RADIUS = 0.5f;   // meters (matches controller BUMPER_RADIUS)
+constexpr float SWEEP_DISTANCE = 0.15f; // meters (~9 m/s at 60Hz)
+constexpr int SAMPLE_COUNT = 4096;      // precomputed inputs cycled through by each benchmark
+constexpr float RAY_LENGTH = 8.0f;      // meters (camera boom / AI sight line)
+
+constexpr float TICK_DT = 1.0f / 60.0f; // seconds (simulation tick used by per-tick benchmarks)
+
+struct bench_options {
+    bench::run_options run;
+    const char* json_path = nullptr;
+    const char* baseline_path = nullptr;
+    double threshold_percent = 10.0;
+    bool list_only = false;
+};
+
+void print_usage(const char* program) {
+    std::printf("Usage: %s [--filter TEXT] [--json PATH] [--baseline PATH] [--threshold PERCENT]\n"
+                "       [--min-time MS] [--samples N] [--list]\n",
+                program);
+}
+
+bool parse_options(int argc, char* argv[], bench_options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (std::strcmp(arg, "--filter") == 0 && has_value) {
+            options.run.filter = argv[++i];
+        } else if (std::strcmp(arg, "--json") == 0 && has_value) {
+            options.json_path = argv[++i];
+        } else if (std::strcmp(arg, "--baseline") == 0 && has_value) {
+            options.baseline_path = argv[++i];
+        } else if (std::strcmp(arg, "--threshold") == 0 && has_value) {
+            options.threshold_percent = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--min-time") == 0 && has_value) {
+            options.run.min_sample_ms = std::atof(argv[++i]);
+        } else if (std::strcmp(arg, "--samples") == 0 && has_value) {
+            options.run.samples = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--list") == 0) {
+            options.list_only = true;
+        } else {
+            return false;
+        }
+    }
+
+    return options.threshold_percent >= 0.0 && options.run.min_sample_ms > 0.0 &&
+           options.run.samples > 0;
+}
+
+collision_world make_world(int box_count, std::mt19937& rng) {
+    float side = std::sqrt(static_cast<float>(box_count)) * BOX_SPACING;
+    std::uniform_real_distribution<float> position(-side * 0.5f, side * 0.5f);
+    std::uniform_real_distribution<float> extent(0.1f, 1.0f);
+    std::uniform_real_distribution<float> height(0.0f, 2.0f);
+
+    collision_world world;
+    world.boxes.reserve(box_count);
+    for (int i = 0; i < box_count; ++i) {
+        collision_box box;
+        box.bounds.center = glm::vec3(position(rng), height(rng), position(rng));
+        box.bounds.half_extents = glm::vec3(extent(rng), extent(rng), extent(rng));
+        box.type = collision_surface_type::WALL;
+        world.boxes.push_back(box);
+    }
+    build_broadphase(world);
+    return world;
+}
+
+// Short sweeps scattered over the world footprint (start, end pairs)
+std::vector<glm::vec3> make_sweeps(int box_count, std::mt19937& rng) {
+    float side = std::sqrt(static_cast<float>(box_count)) * BOX_SPACING;
+    std::uniform_real_distribution<float> position(-side * 0.5f, side * 0.5f);
+    std::uniform_real_distribution<float> height(0.0f, 2.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+    std::vector<glm::vec3> sweeps;
+    sweeps.reserve(SAMPLE_COUNT * 2);
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        glm::vec3 start(position(rng), height(rng), position(rng));
+        float a = angle(rng);
+        sweeps.push_back(start);
+        sweeps.push_back(start + glm::vec3(std::sin(a), 0.0f, std::cos(a)) * SWEEP_DISTANCE);
+    }
+    return sweeps;
+}
+
+// Rays from the sweep starts in random horizontal directions, tilted slightly down so low
+// boxes are hit as well as tall ones
+std::vector<ray> make_rays(int box_count, std::mt19937& rng) {
+    std::vector<glm::vec3> starts = make_sweeps(box_count, rng);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+    std::vector<ray> rays;
+    rays.reserve(SAMPLE_COUNT);
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        float a = angle(rng);
+        ray r;
+        r.origin = starts[static_cast<size_t>(i) * 2];
+        r.direction = glm::normalize(glm::vec3(std::sin(a), -0.1f, std::cos(a)));
+        r.max_distance = RAY_LENGTH;
+        rays.push_back(r);
+    }
+    return rays;
+}
+
+// Sphere/box pairs near contact: a mix of hits, misses and deep overlaps
+struct sphere_box_pair {
+    sphere s;
+    aabb box;
+};
+
+std::vector<sphere_box_pair> make_sphere_box_pairs(std::mt19937& rng) {
+    std::uniform_real_distribution<float> offset(-2.0f, 2.0f);
+    std::uniform_real_distribution<float> extent(0.1f, 1.0f);
+
+    std::vector<sphere_box_pair> pairs(SAMPLE_COUNT);
+    for (auto& pair : pairs) {
+        pair.box.center = glm::vec3(0.0f);
+        pair.box.half_extents = glm::vec3(extent(rng), extent(rng), extent(rng));
+        pair.s.center = glm::vec3(offset(rng), offset(rng), offset(rng));
+        pair.s.radius = SPHERE_RADIUS;
+    }
+    return pairs;
+}
+
+// Vehicle driven by the default input script around the test level; persists across samples
+// so the benchmark sees the same mix of driving, turning and wall contact as the game
+struct driving_state {
+    game_world world;
+    app::input_script script = app::default_input_script();
+    long long tick = 0;
+
+    driving_state() { world.init(); }
+
+    controller_input_params next_input() {
+        return script.sample(static_cast<int>(tick++ % script.length()));
+    }
+};
+
+controller::camera_input_params heading_basis(const controller& character) {
+    controller::camera_input_params cam_params;
+    cam_params.forward = math::yaw_to_forward(character.heading_yaw);
+    cam_params.right = math::yaw_to_right(character.heading_yaw);
+    return cam_params;
+}
+
+vehicle_fleet make_fleet(int count) {
+    std::mt19937 rng(12345u);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    vehicle_fleet fleet;
+    fleet.reserve(static_cast<size_t>(count));
+    controller prototype;
+    prototype.handbrake.brake_rate = 4.0f;
+    for (int i = 0; i < count; ++i) {
+        prototype.position = glm::vec3(unit(rng) * 500.0f, 0.5f, unit(rng) * 500.0f);
+        prototype.heading_yaw = unit(rng) * glm::pi<float>();
+        size_t index = fleet.add(prototype);
+
+        controller_input_params input;
+        input.move_direction = glm::vec2(unit(rng), unit(rng));
+        input.turn_input = unit(rng);
+        input.handbrake = unit(rng) > 0.8f;
+        fleet.set_input(index, input);
+    }
+    return fleet;
+}
+
+void register_collision(bench::suite& suite) {
+    std::mt19937 rng(12345u);
+    auto pairs = std::make_shared<std::vector<sphere_box_pair>>(make_sphere_box_pairs(rng));
+    suite.add("resolve_sphere_aabb", [pairs](long long iterations) {
+        const auto& p = *pairs;
+        for (long long i = 0; i < iterations; ++i) {
+            const sphere_box_pair& pair = p[static_cast<size_t>(i) % p.size()];
+            sphere_collision contact = resolve_sphere_aabb(pair.s, pair.box);
+            bench::do_not_optimize(contact.penetration);
+        }
+    });
+
+    const int box_counts[] = {10, 100, 1000, 10000, 100000};
+    for (int box_count : box_counts) {
+        std::mt19937 world_rng(12345u + static_cast<unsigned>(box_count));
+        auto world = std::make_shared<collision_world>(make_world(box_count, world_rng));
+        auto sweeps = std::make_shared<std::vector<glm::vec3>>(make_sweeps(box_count, world_rng));
+
+        suite.add("resolve_collisions/" + std::to_string(box_count),
+                  [world, sweeps](long long iterations) {
+                      const auto& w = *sweeps;
+                      for (long long i = 0; i < iterations; ++i) {
+                          size_t sample = (static_cast<size_t>(i) % SAMPLE_COUNT) * 2;
+                          sphere s{w[sample], SPHERE_RADIUS};
+                          glm::vec3 position = w[sample + 1];
+                          glm::vec3 velocity = (w[sample + 1] - w[sample]) / TICK_DT;
+                          sphere_collision contact =
+                              resolve_collisions(s, *world, position, velocity, 0.707f);
+                          bench::do_not_optimize(position.x);
+                          bench::do_not_optimize(contact.hit);
+                      }
+                  });
+
+        // Same moves resolved continuously (sweeps + slides, then the discrete settle)
+        suite.add("move_and_slide/" + std::to_string(box_count),
+                  [world, sweeps](long long iterations) {
+                      const auto& w = *sweeps;
+                      for (long long i = 0; i < iterations; ++i) {
+                          size_t sample = (static_cast<size_t>(i) % SAMPLE_COUNT) * 2;
+                          sphere s{w[sample], SPHERE_RADIUS};
+                          glm::vec3 position = w[sample + 1];
+                          glm::vec3 velocity = (w[sample + 1] - w[sample]) / TICK_DT;
+                          sphere_collision contact =
+                              move_and_slide(s, *world, position, velocity, 0.707f);
+                          bench::do_not_optimize(position.x);
+                          bench::do_not_optimize(contact.hit);
+                      }
+                  });
+
+        auto rays = std::make_shared<std::vector<ray>>(make_rays(box_count, world_rng));
+        suite.add("raycast/" + std::to_string(box_count), [world, rays](long long iterations) {
+            const auto& r = *rays;
+            for (long long i = 0; i < iterations; ++i) {
+                cast_hit hit = raycast(*world, r[static_cast<size_t>(i) % r.size()]);
+                bench::do_not_optimize(hit.distance);
+            }
+        });
+        suite.add("sphere_cast/" + std::to_string(box_count),
+                  [world, rays](long long iterations) {
+                      const auto& r = *rays;
+                      for (long long i = 0; i < iterations; ++i) {
+                          cast_hit hit = sphere_cast(*world, r[static_cast<size_t>(i) % r.size()],
+                                                     SPHERE_RADIUS);
+                          bench::do_not_optimize(hit.distance);
+                      }
+                  });
+    }
+
+    // Moving obstacles: every dynamic box moves each tick (one op = the whole tick), and
+    // resolves against a field of them (same layout as the static worlds)
+    for (int box_count : {1000, 10000}) {
+        std::mt19937 dynamic_rng(4242u + static_cast<unsigned>(box_count));
+        collision_world source = make_world(box_count, dynamic_rng);
+        auto world = std::make_shared<collision_world>();
+        for (const collision_box& box : source.boxes) {
+            add_dynamic_box(*world, box);
+        }
+        auto sweeps =
+            std::make_shared<std::vector<glm::vec3>>(make_sweeps(box_count, dynamic_rng));
+
+        suite.add("move_dynamic_box/all/" + std::to_string(box_count),
+                  [world](long long iterations) {
+                      for (long long i = 0; i < iterations; ++i) {
+                          // Circle in place (~1 m/s), crossing cells now and then
+                          float phase = static_cast<float>(i % 360) * 0.0174533f;
+                          glm::vec3 step(std::cos(phase) * TICK_DT, 0.0f,
+                                         std::sin(phase) * TICK_DT);
+                          for (uint32_t id = 0; id < world->dynamic_boxes.size(); ++id) {
+                              aabb bounds = world->dynamic_boxes[id].bounds;
+                              bounds.center += step;
+                              move_dynamic_box(*world, id, bounds);
+                          }
+                          bench::do_not_optimize(world->dynamic_boxes.data());
+                      }
+                  });
+
+        suite.add("resolve_collisions/dynamic/" + std::to_string(box_count),
+                  [world, sweeps](long long iterations) {
+                      const auto& w = *sweeps;
+                      for (long long i = 0; i < iterations; ++i) {
+                          size_t sample = (static_cast<size_t>(i) % SAMPLE_COUNT) * 2;
+                          sphere s{w[sample], SPHERE_RADIUS};
+                          glm::vec3 position = w[sample + 1];
+                          glm::vec3 velocity = (w[sample + 1] - w[sample]) / TICK_DT;
+                          sphere_collision contact =
+                              resolve_collisions(s, *world, position, velocity, 0.707f);
+                          bench::do_not_optimize(position.x);
+                          bench::do_not_optimize(contact.hit);
+                      }
+                  });
+    }
+
+    // Steady state: a sphere resting on a floor below a box field (gravity pulls it in every
+    // tick, the resolver pushes it back out), without and with a contact cache. 100 boxes
+    // takes the SoA sweep, 1000 the BVH.
+    for (int box_count : {100, 1000}) {
+        std::mt19937 resting_rng(777u);
+        auto world = std::make_shared<collision_world>(make_world(box_count, resting_rng));
+        collision_box floor;
+        floor.bounds = aabb{glm::vec3(0.0f, -10.5f, 0.0f), glm::vec3(100.0f, 0.5f, 100.0f)};
+        floor.type = collision_surface_type::FLOOR;
+        world->boxes.push_back(floor);
+        build_broadphase(*world);
+
+        for (bool cached : {false, true}) {
+            std::string name = "resolve_collisions/resting/" + std::to_string(box_count);
+            suite.add(name + (cached ? "/cached" : ""), [world, cached](long long iterations) {
+                contact_cache cache;
+                sphere s{glm::vec3(0.0f, -10.0f + SPHERE_RADIUS, 0.0f), SPHERE_RADIUS};
+                const glm::vec3 fall(0.0f, -math::GRAVITY * TICK_DT, 0.0f);
+                for (long long i = 0; i < iterations; ++i) {
+                    glm::vec3 position = s.center + fall * TICK_DT;
+                    glm::vec3 velocity = fall;
+                    sphere_collision contact = resolve_collisions(
+                        s, *world, position, velocity, 0.707f, cached ? &cache : nullptr);
+                    bench::do_not_optimize(position.y);
+                    bench::do_not_optimize(contact.contacted_floor);
+                }
+            });
+        }
+    }
+}
+
+void register_simulation(bench::suite& suite) {
+    // Input application + physics integration + collision against the test level
+    auto driving = std::make_shared<driving_state>();
+    suite.add("controller::update", [driving](long long iterations) {
+        controller& character = driving->world.character;
+        for (long long i = 0; i < iterations; ++i) {
+            character.apply_input(driving->next_input(), heading_basis(character), TICK_DT);
+            character.update(&driving->world.world_geometry, TICK_DT);
+            bench::do_not_optimize(character.position.x);
+        }
+    });
+
+    suite.add("spring_damper::update", [](long long iterations) {
+        spring_damper spring;
+        for (long long i = 0; i < iterations; ++i) {
+            // Alternate targets so the spring never settles into a trivially cheap state
+            spring.update({(i & 64) ? 1.0f : -1.0f, TICK_DT});
+            bench::do_not_optimize(spring.position);
+        }
+    });
+
+    // Reactive systems need a moving controller to respond to; the vehicle is advanced one
+    // tick every 64 reactive updates, so its cost is amortized into the measurement
+    auto reactive = std::make_shared<driving_state>();
+    suite.add("vehicle_reactive_systems::update", [reactive](long long iterations) {
+        game_world& world = reactive->world;
+        for (long long i = 0; i < iterations; ++i) {
+            if ((i & 63) == 0) {
+                world.update(TICK_DT, reactive->next_input());
+            }
+            world.vehicle_reactive.update(world.character, TICK_DT);
+            bench::do_not_optimize(world.vehicle_reactive.lean_spring.position);
+        }
+    });
+
+    // One tick of the SoA fleet (one op = all vehicles), under held random input
+    auto fleet = std::make_shared<vehicle_fleet>(make_fleet(100000));
+    suite.add("vehicle_fleet::update/100000", [fleet](long long iterations) {
+        for (long long i = 0; i < iterations; ++i) {
+            fleet->update(TICK_DT);
+            bench::do_not_optimize(fleet->position_x[0]);
+        }
+    });
+
+    // Full debug primitive generation for one frame of the test level
+    auto debug_world = std::make_shared<driving_state>();
+    for (int i = 0; i < 120; ++i) {
+        debug_world->world.update(TICK_DT, debug_world->next_input());
+    }
+    suite.add("app::generate_debug_primitives", [debug_world](long long iterations) {
+        game_world& world = debug_world->world;
+        for (long long i = 0; i < iterations; ++i) {
+            world.debug_list.clear();
+            app::generate_debug_primitives(world.debug_list, world);
+            bench::do_not_optimize(world.debug_list.lines.size());
+        }
+    });
+}
+
+void register_mesh_generation(bench::suite& suite) {
+    suite.add("generate_sphere/8x8", [](long long iterations) {
+        for (long long i = 0; i < iterations; ++i) {
+            foundation::wireframe_mesh mesh = foundation::generate_sphere();
+            bench::do_not_optimize(mesh.vertices.size());
+        }
+    });
+
+    suite.add("generate_sphere/32x32", [](long long iterations) {
+        for (long long i = 0; i < iterations; ++i) {
+            foundation::wireframe_mesh mesh = foundation::generate_sphere({32, 32, 1.0f});
+            bench::do_not_optimize(mesh.vertices.size());
+        }
+    });
+
+    suite.add("generate_arc/32", [](long long iterations) {
+        glm::vec3 start_dir(1.0f, 0.0f, 0.0f);
+        glm::vec3 end_dir(0.0f, 0.0f, 1.0f);
+        for (long long i = 0; i < iterations; ++i) {
+            foundation::wireframe_mesh mesh =
+                foundation::generate_arc(glm::vec3(0.0f), start_dir, end_dir, 1.0f, 32);
+            bench::do_not_optimize(mesh.vertices.size());
+        }
+    });
+
+    // Same arc into stack buffers (the debug slip arc's path): no allocation
+    suite.add("generate_arc/32/buffers", [](long long iterations) {
+        glm::vec3 start_dir(1.0f, 0.0f, 0.0f);
+        glm::vec3 end_dir(0.0f, 0.0f, 1.0f);
+        std::array<glm::vec3, 33> vertices;
+        std::array<uint16_t, 64> indices;
+        for (long long i = 0; i < iterations; ++i) {
+            foundation::mesh_size size = foundation::generate_arc<uint16_t>(
+                glm::vec3(0.0f), start_dir, end_dir, 1.0f, 32, {vertices, indices});
+            bench::do_not_optimize(size.vertices);
+            bench::do_not_optimize(vertices[32].x);
+        }
+    });
+
+    suite.add("generate_circle/32", [](long long iterations) {
+        for (long long i = 0; i < iterations; ++i) {
+            foundation::wireframe_mesh mesh = foundation::generate_circle(glm::vec3(1.0f));
+            bench::do_not_optimize(mesh.vertices.size());
+        }
+    });
+
+    // Same shapes from the memoized cache (steady state: every request hits)
+    auto cache = std::make_shared<foundation::mesh_cache>();
+    suite.add("mesh_cache::sphere/32x32", [cache](long long iterations) {
+        for (long long i = 0; i < iterations; ++i) {
+            foundation::cached_mesh mesh = cache->sphere({32, 32, 1.0f});
+            bench::do_not_optimize(mesh.transform[0][0]);
+        }
+    });
+
+    suite.add("mesh_cache::circle/32", [cache](long long iterations) {
+        for (long long i = 0; i < iterations; ++i) {
+            foundation::cached_mesh mesh = cache->circle(glm::vec3(1.0f), {});
+            bench::do_not_optimize(mesh.transform[0][0]);
+        }
+    });
+}
+
+// Named stress level (see stress_level.h), generated on first use so filtered-out scenes cost
+// nothing; sweeps are scattered over its footprint like make_sweeps
+struct lazy_stress_level {
+    app::stress_level_params params;
+    std::unique_ptr<driving_state> state; // world holds the level; vehicle parked at spawn
+    std::vector<glm::vec3> sweeps;
+
+    driving_state& get() {
+        if (!state) {
+            app::level_description description;
+            app::generate_stress_level(params, description);
+            state = std::make_unique<driving_state>();
+            state->world.build_level(description);
+
+            const aabb& ground = description.boxes[0].bounds; // covers the footprint
+            std::mt19937 rng(params.seed);
+            std::uniform_real_distribution<float> x(-ground.half_extents.x,
+                                                    ground.half_extents.x);
+            std::uniform_real_distribution<float> z(-ground.half_extents.z,
+                                                    ground.half_extents.z);
+            std::uniform_real_distribution<float> height(SPHERE_RADIUS, 3.0f);
+            std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+            sweeps.reserve(SAMPLE_COUNT * 2);
+            for (int i = 0; i < SAMPLE_COUNT; ++i) {
+                glm::vec3 start(x(rng), height(rng), z(rng));
+                float a = angle(rng);
+                sweeps.push_back(start);
+                sweeps.push_back(start +
+                                 glm::vec3(std::sin(a), 0.0f, std::cos(a)) * SWEEP_DISTANCE);
+            }
+        }
+        return *state;
+    }
+};
+
+// Collision and per-frame debug drawing over generated scenes of 1k to 1M boxes. Names carry
+// the stress level name, so froglords_headless --stress reproduces the same scene.
+void register_stress_levels(bench::suite& suite) {
+    const char* scenes[] = {"city/1000",    "city/100000",    "city/1000000",
+                            "clutter/1000", "clutter/100000", "clutter/1000000",
+                            "stairs/100000", "corridors/100000"};
+    for (const char* scene_name : scenes) {
+        auto level = std::make_shared<lazy_stress_level>();
+        if (!app::parse_stress_level_name(scene_name, level->params)) {
+            std::fprintf(stderr, "Bad stress level name: %s\n", scene_name);
+            continue;
+        }
+        level->params.meshes = false; // collision only; the scene is never rendered here
+        std::string suffix = "/stress/" + std::string(scene_name);
+
+        suite.add("resolve_collisions" + suffix, [level](long long iterations) {
+            const collision_world& world = level->get().world.world_geometry;
+            const auto& w = level->sweeps;
+            for (long long i = 0; i < iterations; ++i) {
+                size_t sample = (static_cast<size_t>(i) % SAMPLE_COUNT) * 2;
+                sphere s{w[sample], SPHERE_RADIUS};
+                glm::vec3 position = w[sample + 1];
+                glm::vec3 velocity = (w[sample + 1] - w[sample]) / TICK_DT;
+                sphere_collision contact =
+                    resolve_collisions(s, world, position, velocity, 0.707f);
+                bench::do_not_optimize(position.x);
+                bench::do_not_optimize(contact.hit);
+            }
+        });
+
+        suite.add("raycast" + suffix, [level](long long iterations) {
+            const collision_world& world = level->get().world.world_geometry;
+            const auto& w = level->sweeps;
+            for (long long i = 0; i < iterations; ++i) {
+                size_t sample = (static_cast<size_t>(i) % SAMPLE_COUNT) * 2;
+                ray r;
+                r.origin = w[sample];
+                r.direction = glm::normalize((w[sample + 1] - w[sample]) / SWEEP_DISTANCE +
+                                             glm::vec3(0.0f, -0.1f, 0.0f));
+                r.max_distance = RAY_LENGTH;
+                cast_hit hit = raycast(world, r);
+                bench::do_not_optimize(hit.distance);
+            }
+        });
+
+        // One op = a full frame of debug primitives (draws every box's outline)
+        suite.add("app::generate_debug_primitives" + suffix, [level](long long iterations) {
+            game_world& world = level->get().world;
+            for (long long i = 0; i < iterations; ++i) {
+                world.debug_list.clear();
+                app::generate_debug_primitives(world.debug_list, world);
+                bench::do_not_optimize(world.debug_list.lines.size());
+            }
+        });
+    }
+}
+
+// Job system created on first use, so filtered-out thread counts never spawn workers
+struct lazy_jobs {
+    int threads;
+    std::unique_ptr<job_system> jobs;
+
+    job_system& get() {
+        if (!jobs) {
+            jobs = std::make_unique<job_system>(threads - 1);
+        }
+        return *jobs;
+    }
+};
+
+// Same work at 1..32 threads (one op = the whole batch); ideal scaling halves ns/op per
+// doubling until threads exceed cores
+void register_job_scaling(bench::suite& suite) {
+    auto fleet = std::make_shared<vehicle_fleet>(make_fleet(100000));
+
+    std::mt19937 rng(54321u);
+    auto world = std::make_shared<collision_world>(make_world(10000, rng));
+    auto queries = std::make_shared<std::vector<sphere_query>>();
+    std::vector<glm::vec3> sweeps = make_sweeps(10000, rng);
+    for (int i = 0; i < SAMPLE_COUNT; ++i) {
+        sphere_query q;
+        q.collision_sphere = sphere{sweeps[static_cast<size_t>(i) * 2], SPHERE_RADIUS};
+        q.position = sweeps[static_cast<size_t>(i) * 2 + 1];
+        q.velocity = (q.position - q.collision_sphere.center) / TICK_DT;
+        queries->push_back(q);
+    }
+
+    const int thread_counts[] = {1, 2, 4, 8, 16, 32};
+    for (int threads : thread_counts) {
+        auto jobs = std::make_shared<lazy_jobs>(lazy_jobs{threads, nullptr});
+        std::string suffix = "/threads=" + std::to_string(threads);
+
+        suite.add("jobs/vehicle_fleet::update/100000" + suffix, [jobs, fleet](long long n) {
+            job_system& system = jobs->get();
+            for (long long i = 0; i < n; ++i) {
+                fleet->update(TICK_DT, &system);
+                bench::do_not_optimize(fleet->position_x[0]);
+            }
+        });
+
+        suite.add("jobs/resolve_collisions_batch/" + std::to_string(SAMPLE_COUNT) + suffix,
+                  [jobs, world, queries](long long n) {
+                      job_system& system = jobs->get();
+                      std::vector<sphere_query> batch;
+                      std::vector<sphere_collision> contacts;
+                      for (long long i = 0; i < n; ++i) {
+                          batch = *queries;
+                          resolve_collisions_batch(batch, *world, 0.707f, contacts, &system);
+                          bench::do_not_optimize(contacts.data());
+                      }
+                  });
+    }
+}
+
+// Cost of one FL_PROFILE_ZONE (begin + end event) while a trace capture is running
+void register_profiling(bench::suite& suite) {
+#if FROGLORDS_PROFILE
+    // Same capacity every sample, so the event buffer is allocated once, here
+    constexpr uint32_t EVENTS = 1u << 22;
+    trace::start_capture(EVENTS);
+    trace::stop_capture();
+
+    // Restart the capture before the buffer fills so every zone is recorded, not dropped
+    suite.add("trace/zone_capturing", [](long long iterations) {
+        constexpr long long ZONES_PER_CAPTURE = EVENTS / 2;
+        for (long long done = 0; done < iterations;) {
+            long long batch = std::min(iterations - done, ZONES_PER_CAPTURE);
+            trace::start_capture(EVENTS);
+            for (long long i = 0; i < batch; ++i) {
+                FL_PROFILE_ZONE("bench_zone");
+            }
+            trace::stop_capture();
+            done += batch;
+        }
+        bench::do_not_optimize(iterations);
+    });
+#else
+    (void)suite;
+#endif
+}
+
+void print_comparison(const std::vector<bench::comparison>& comparisons, double threshold) {
+    std::printf("\nBaseline comparison (regression threshold %.1f%%)\n", threshold * 100.0);
+    std::printf("%-48s %14s %14s %9s\n", "benchmark", "baseline ns", "current ns", "change");
+    for (const auto& c : comparisons) {
+        std::printf("%-48s %14.2f %14.2f %+8.1f%%%s\n", c.name.c_str(), c.baseline_ns,
+                    c.current_ns, c.change * 100.0, c.regression ? "  REGRESSION" : "");
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bench_options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // Load the baseline first so a bad path fails before minutes of benchmarking
+    std::vector<bench::result> baseline;
+    if (options.baseline_path != nullptr && !bench::read_json(options.baseline_path, baseline)) {
+        std::fprintf(stderr, "Failed to read baseline: %s\n", options.baseline_path);
+        return 1;
+    }
+
+    bench::suite suite;
+    register_collision(suite);
+    register_simulation(suite);
+    register_mesh_generation(suite);
+    register_stress_levels(suite);
+    register_job_scaling(suite);
+    register_profiling(suite);
+
+    if (options.list_only) {
+        suite.list();
+        return 0;
+    }
+
+    std::vector<bench::result> results = suite.run(options.run);
+
+    if (options.json_path != nullptr &&
+        !bench::write_json(options.json_path, "froglords_bench", results)) {
+        std::fprintf(stderr, "Failed to write results: %s\n", options.json_path);
+        return 1;
+    }
+
+    if (options.baseline_path != nullptr) {
+        double threshold = options.threshold_percent / 100.0;
+        std::vector<bench::comparison> comparisons =
+            bench::compare(baseline, results, threshold);
+        print_comparison(comparisons, threshold);
+
+        int regressions = 0;
+        for (const auto& c : comparisons) {
+            regressions += c.regression ? 1 : 0;
+        }
+        if (regressions > 0) {
+            std::printf("\n%d benchmark(s) regressed\n", regressions);
+            return 2;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+@vs vs_instanced
+layout(binding=0) uniform instanced_vs_params {
+    mat4 view_proj;
+};
+
+layout(location=0) in vec3 position;
+
+// Per-instance data: model matrix columns + line color
+layout(location=1) in vec4 inst_model0;
+layout(location=2) in vec4 inst_model1;
+layout(location=3) in vec4 inst_model2;
+layout(location=4) in vec4 inst_model3;
+layout(location=5) in vec4 inst_color;
+
+out vec4 color;
+
+void main() {
+    mat4 model = mat4(inst_model0, inst_model1, inst_model2, inst_model3);
+    gl_Position = view_proj * (model * vec4(position, 1.0));
+    color = inst_color;
+}
+@end
+
+@fs fs_instanced
+in vec4 color;
+
+out vec4 frag_color;
+
+void main() {
+    frag_color = color;
+}
+@end
+
+@program wireframe_instanced vs_instanced fs_instanced
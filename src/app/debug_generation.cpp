@@ -2,10 +2,17 @@
 #include "app/game_world.h"
 #include "rendering/debug_primitives.h"
 #include "foundation/procedural_mesh.h"
+#include "foundation/mesh_tables.h"
 #include "foundation/math_utils.h"
+#include "foundation/memory_tracking.h"
+#include "foundation/profiler.h"
+#include "foundation/job_system.h"
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <span>
 
 namespace {
 
@@ -19,6 +26,31 @@ void mesh_to_debug_lines(debug::debug_primitive_list& list, const foundation::wi
     }
 }
 
+// Line-list indices, two per edge
+template <typename Index>
+void mesh_to_debug_lines(debug::debug_primitive_list& list, std::span<const glm::vec3> vertices,
+                         std::span<const Index> indices, const glm::mat4& transform,
+                         const glm::vec4& color) {
+    for (size_t i = 0; i + 1 < indices.size(); i += 2) {
+        glm::vec3 v0 = glm::vec3(transform * glm::vec4(vertices[indices[i]], 1.0f));
+        glm::vec3 v1 = glm::vec3(transform * glm::vec4(vertices[indices[i + 1]], 1.0f));
+        list.lines.push_back(debug::debug_line{v0, v1, color});
+    }
+}
+
+template <size_t V, size_t E>
+void mesh_to_debug_lines(debug::debug_primitive_list& list,
+                         const foundation::mesh_table<V, E>& mesh, const glm::mat4& transform,
+                         const glm::vec4& color) {
+    mesh_to_debug_lines(list, mesh.vertex_span(), mesh.index_span(), transform, color);
+}
+
+// Fixed shapes drawn every frame, built at compile time
+constexpr auto UNIT_CIRCLE = foundation::make_circle_table<32>(); // circle_config default
+constexpr auto CHARACTER_BODY = foundation::make_box_table(0.4f, 0.8f, 0.3f);
+// Long vehicle proportions: X=width, Y=height, Z=length (forward is +Z)
+constexpr auto VEHICLE_BODY = foundation::make_box_table(0.6f, 0.4f, 1.2f);
+
 // Anonymous namespace for helper functions that translate game state into debug primitives.
 
 void generate_character_state_primitives(debug::debug_primitive_list& list,
@@ -72,9 +104,9 @@ void generate_character_state_primitives(debug::debug_primitive_list& list,
         glm::vec3 rgb = glm::mix(GRADIENT[index], GRADIENT[index + 1], t);
         glm::vec4 color = glm::vec4(rgb, 0.8f);
 
-        foundation::wireframe_mesh speed_ring =
-            foundation::generate_circle(character.position, {current_speed});
-        mesh_to_debug_lines(list, speed_ring, color);
+        glm::mat4 ring_transform = glm::scale(glm::translate(glm::mat4(1.0f), character.position),
+                                              glm::vec3(current_speed, 1.0f, current_speed));
+        mesh_to_debug_lines(list, UNIT_CIRCLE, ring_transform, color);
 
         // Slip angle arc - visualize angle between heading and velocity
         float slip_angle = character.calculate_slip_angle();
@@ -85,9 +117,16 @@ void generate_character_state_primitives(debug::debug_primitive_list& list,
             glm::vec3 velocity_dir =
                 math::safe_normalize(math::project_to_horizontal(character.velocity), heading_dir);
 
-            foundation::wireframe_mesh slip_arc = foundation::generate_arc(
-                character.position, heading_dir, velocity_dir, current_speed * 0.5f);
-            mesh_to_debug_lines(list, slip_arc, {1.0f, 1.0f, 1.0f, 1.0f}); // White
+            // Generated into stack buffers: no per-frame heap allocation
+            constexpr int SLIP_ARC_SEGMENTS = 32;
+            std::array<glm::vec3, SLIP_ARC_SEGMENTS + 1> arc_vertices;
+            std::array<uint16_t, SLIP_ARC_SEGMENTS * 2> arc_indices;
+            foundation::mesh_size slip_arc = foundation::generate_arc<uint16_t>(
+                character.position, heading_dir, velocity_dir, current_speed * 0.5f,
+                SLIP_ARC_SEGMENTS, {arc_vertices, arc_indices});
+            mesh_to_debug_lines(list, std::span<const glm::vec3>(arc_vertices),
+                                std::span<const uint16_t>(arc_indices.data(), slip_arc.indices),
+                                glm::mat4(1.0f), {1.0f, 1.0f, 1.0f, 1.0f}); // White
         }
     }
 
@@ -142,15 +181,8 @@ void generate_character_body_primitives(debug::debug_primitive_list& list,
     // Get the full world transform from the reactive systems, which includes tilt and offset
     glm::mat4 transform = visuals.get_visual_transform(character);
 
-    // Generate the character body box in local space
-    foundation::wireframe_mesh body_mesh = foundation::generate_box({0.4f, 0.8f, 0.3f});
-
-    // Manually transform the vertices and add them as debug lines
-    for (const auto& edge : body_mesh.edges) {
-        glm::vec3 v0 = glm::vec3(transform * glm::vec4(body_mesh.vertices[edge.v0], 1.0f));
-        glm::vec3 v1 = glm::vec3(transform * glm::vec4(body_mesh.vertices[edge.v1], 1.0f));
-        list.lines.push_back(debug::debug_line{v0, v1, {0.2f, 1.0f, 0.2f, 1.0f}});
-    }
+    // Character body box in local space
+    mesh_to_debug_lines(list, CHARACTER_BODY, transform, {0.2f, 1.0f, 0.2f, 1.0f});
 }
 
 void generate_vehicle_body_primitives(debug::debug_primitive_list& list,
@@ -160,54 +192,53 @@ void generate_vehicle_body_primitives(debug::debug_primitive_list& list,
     // Get the full world transform from the vehicle visual systems, which includes tilt
     glm::mat4 transform = visuals.get_visual_transform(character);
 
-    // Generate the vehicle body box in local space (long vehicle proportions)
-    // X=width, Y=height, Z=length (forward is +Z)
-    foundation::wireframe_mesh body_mesh = foundation::generate_box({0.6f, 0.4f, 1.2f});
-
-    // Manually transform the vertices and add them as debug lines
-    for (const auto& edge : body_mesh.edges) {
-        glm::vec3 v0 = glm::vec3(transform * glm::vec4(body_mesh.vertices[edge.v0], 1.0f));
-        glm::vec3 v1 = glm::vec3(transform * glm::vec4(body_mesh.vertices[edge.v1], 1.0f));
-        list.lines.push_back(debug::debug_line{v0, v1, {0.2f, 1.0f, 0.2f, 1.0f}});
-    }
+    // Vehicle body box in local space
+    mesh_to_debug_lines(list, VEHICLE_BODY, transform, {0.2f, 1.0f, 0.2f, 1.0f});
 }
 
 // Removed: generate_locomotion_surveyor_wheel (used locomotion-specific fields)
 
 void generate_collision_state_primitives(debug::debug_primitive_list& list,
                                          const controller& character,
-                                         const collision_world& world) {
+                                         const collision_world& world, job_system* jobs) {
     // Type-based colors for semantic collision boxes
     constexpr glm::vec4 FLOOR_COLOR = {0.3f, 1.0f, 0.3f, 1.0f};    // Green
     constexpr glm::vec4 WALL_COLOR = {1.0f, 0.0f, 1.0f, 1.0f};     // Magenta
     constexpr glm::vec4 PLATFORM_COLOR = {1.0f, 1.0f, 0.3f, 1.0f}; // Yellow
     constexpr glm::vec4 GENERIC_COLOR = {0.5f, 0.5f, 0.5f, 1.0f};  // Gray
 
-    // World geometry boxes
-    for (const auto& box : world.boxes) {
-        glm::vec4 color;
-        switch (box.type) {
-        case collision_surface_type::FLOOR:
-            color = FLOOR_COLOR;
-            break;
-        case collision_surface_type::WALL:
-            color = WALL_COLOR;
-            break;
-        case collision_surface_type::PLATFORM:
-            color = PLATFORM_COLOR;
-            break;
-        default:
-            color = GENERIC_COLOR;
-            break;
+    // World geometry boxes: one slot each, filled in parallel (the only per-box section, so
+    // the only one that grows with level size)
+    constexpr size_t BOX_GRAIN = 2048;
+    size_t first_slot = list.boxes.size();
+    list.boxes.resize(first_slot + world.boxes.size());
+    parallel_for(jobs, world.boxes.size(), BOX_GRAIN, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const collision_box& box = world.boxes[i];
+            glm::vec4 color;
+            switch (box.type) {
+            case collision_surface_type::FLOOR:
+                color = FLOOR_COLOR;
+                break;
+            case collision_surface_type::WALL:
+                color = WALL_COLOR;
+                break;
+            case collision_surface_type::PLATFORM:
+                color = PLATFORM_COLOR;
+                break;
+            default:
+                color = GENERIC_COLOR;
+                break;
+            }
+
+            glm::mat4 transform = glm::translate(glm::mat4(1.0f), box.bounds.center);
+            list.boxes[first_slot + i] = debug::debug_box{
+                .transform = transform,
+                .half_extents = box.bounds.half_extents,
+                .color = color,
+            };
         }
-
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), box.bounds.center);
-        list.boxes.push_back(debug::debug_box{
-            .transform = transform,
-            .half_extents = box.bounds.half_extents,
-            .color = color,
-        });
-    }
+    });
 
     // Ground contact point
     if (character.is_grounded) {
@@ -320,9 +351,13 @@ void generate_car_control_primitives(debug::debug_primitive_list& list, const co
 
 namespace app {
 
-void generate_debug_primitives(debug::debug_primitive_list& list, const game_world& world) {
+void generate_debug_primitives(debug::debug_primitive_list& list, const game_world& world,
+                               job_system* jobs) {
+    FL_PROFILE_ZONE("generate_debug_primitives");
+    FL_MEMORY_TAG(DEBUG);
+
     // This function orchestrates calls to the various generation helpers.
-    generate_collision_state_primitives(list, world.character, world.world_geometry);
+    generate_collision_state_primitives(list, world.character, world.world_geometry, jobs);
     generate_character_state_primitives(list, world.character, world.vehicle_reactive);
     generate_vehicle_body_primitives(list, world.character, world.vehicle_reactive);
     generate_car_control_primitives(list, world.character);
@@ -5,9 +5,12 @@ struct debug_primitive_list;
 } // namespace debug
 
 struct game_world;
+class job_system;
 
 namespace app {
 
-void generate_debug_primitives(debug::debug_primitive_list& list, const game_world& world);
+// With `jobs`, per-box primitives for large levels are generated in parallel (same output)
+void generate_debug_primitives(debug::debug_primitive_list& list, const game_world& world,
+                               job_system* jobs = nullptr);
 
 } // namespace app
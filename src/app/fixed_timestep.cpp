@@ -0,0 +1,38 @@
+#include "app/fixed_timestep.h"
+#include "foundation/debug_assert.h"
+#include <algorithm>
+
+namespace app {
+
+int advance_fixed_timestep(fixed_timestep_state& state, const fixed_timestep_config& config,
+                           float frame_dt) {
+    FL_PRECONDITION(config.tick_rate > 0.0f, "tick_rate must be positive");
+    FL_PRECONDITION(config.max_catchup_steps > 0, "max_catchup_steps must be positive");
+    FL_ASSERT_FINITE_SCALAR(frame_dt, "frame_dt");
+
+    float tick_dt = config.tick_dt();
+    state.accumulator += std::max(frame_dt, 0.0f);
+
+    int ticks = 0;
+    while (state.accumulator >= tick_dt && ticks < config.max_catchup_steps) {
+        state.accumulator -= tick_dt;
+        ticks++;
+    }
+
+    // Still behind after the catch-up budget: drop whole ticks of backlog (keep the fraction
+    // for interpolation) so one hitch doesn't force slow frames forever
+    if (state.accumulator >= tick_dt) {
+        int backlog = static_cast<int>(state.accumulator / tick_dt);
+        state.dropped_ticks += backlog;
+        state.accumulator -= static_cast<float>(backlog) * tick_dt;
+    }
+
+    state.last_frame_ticks = ticks;
+    return ticks;
+}
+
+float interpolation_alpha(const fixed_timestep_state& state, const fixed_timestep_config& config) {
+    return std::clamp(state.accumulator / config.tick_dt(), 0.0f, 1.0f);
+}
+
+} // namespace app
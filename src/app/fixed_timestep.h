@@ -0,0 +1,34 @@
+#pragma once
+
+// Accumulator-driven fixed simulation tick (decouples physics rate from display rate)
+//
+// Each frame adds the real frame time to an accumulator and runs whole ticks out of it.
+// Rendering blends the last two tick states by the leftover fraction (see
+// interpolate_render_state), so a 60Hz simulation renders smoothly at 240Hz while a long
+// frame never feeds a huge dt into collision resolution.
+
+namespace app {
+
+struct fixed_timestep_config {
+    bool enabled = true;
+    float tick_rate = 60.0f;   // Hz
+    int max_catchup_steps = 5; // ticks per frame before backlog is dropped (spiral-of-death guard)
+
+    float tick_dt() const { return 1.0f / tick_rate; }
+};
+
+struct fixed_timestep_state {
+    float accumulator = 0.0f; // seconds of real time not yet simulated
+    int last_frame_ticks = 0; // ticks run by the most recent advance
+    int dropped_ticks = 0;    // total ticks discarded by the catch-up limit
+};
+
+// Add frame_dt to the accumulator and return the number of ticks to run this frame
+int advance_fixed_timestep(fixed_timestep_state& state, const fixed_timestep_config& config,
+                           float frame_dt);
+
+// Fraction of a tick left in the accumulator, clamped to [0, 1]: blend weight from previous
+// to current. Can reach 1 when float rounding leaves a whole tick in the accumulator.
+float interpolation_alpha(const fixed_timestep_state& state, const fixed_timestep_config& config);
+
+} // namespace app
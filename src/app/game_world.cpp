@@ -1,11 +1,11 @@
 #include "app/game_world.h"
 #include "foundation/math_utils.h"
 #include "foundation/debug_assert.h"
-#include "vehicle/controller_input_params.h"
+#include "foundation/collision.h"
+#include "foundation/profiler.h"
+#include "foundation/mesh_tables.h"
 
 #include "rendering/velocity_trail.h"
-#include "input/input.h"
-#include "input/keycodes.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <cmath>
 #include <algorithm>
@@ -20,37 +20,73 @@ void game_world::init() {
     // Initialize camera FOV from dynamic_fov (dynamic_fov is single source of truth)
     cam.set_fov(dynamic_fov.base_fov);
 
+    // Full-size trail up front: sampling never reallocates
+    trail_state = velocity_trail_state();
+    trail_state.positions.reserve(MAX_TRAIL_SAMPLES);
+    trail_state.timestamps.reserve(MAX_TRAIL_SAMPLES);
+
     scn = scene();
     setup_test_level(*this);
 }
 
-void game_world::update(float dt) {
-    debug_list.clear();
+app::level_file_status game_world::load_level(const char* path) {
+    auto file = std::make_shared<app::level_file>();
+    app::level_file_status status = file->open(path);
+    if (status != app::level_file_status::OK) {
+        return status;
+    }
 
-    // Poll input and construct controller input params
-    controller_input_params input_params;
-    input_params.move_direction = glm::vec2(0.0f, 0.0f);
-    input_params.move_direction.y += input::is_key_down(SAPP_KEYCODE_W) ? 1.0f : 0.0f;
-    input_params.move_direction.y -= input::is_key_down(SAPP_KEYCODE_S) ? 1.0f : 0.0f;
+    app::use_level(*file, world_geometry, scn);
+    level = std::move(file);
+    streamer.reset();
+    return status;
+}
 
-    // A/D input for turning (car-like control only)
-    float lateral_input = 0.0f;
-    lateral_input -= input::is_key_down(SAPP_KEYCODE_A) ? 1.0f : 0.0f;
-    lateral_input += input::is_key_down(SAPP_KEYCODE_D) ? 1.0f : 0.0f;
+void game_world::build_level(const app::level_description& description) {
+    world_geometry.boxes.clear();
+    world_geometry.boxes.reserve(description.boxes.size());
+    for (const collision_box& box : description.boxes) {
+        world_geometry.boxes.push_back(box);
+    }
+    build_broadphase(world_geometry);
 
-    input_params.turn_input = lateral_input;
+    scn.clear();
+    for (const foundation::wireframe_mesh& mesh : description.meshes) {
+        scn.add_object(mesh);
+    }
+    level.reset();
+    streamer.reset();
+}
 
-    if (glm::length(input_params.move_direction) > 0.0f) {
-        input_params.move_direction = glm::normalize(input_params.move_direction);
+bool game_world::stream_level(const char* manifest_path, std::string& error) {
+    auto next = std::make_shared<app::level_streamer>();
+    if (!next->open(manifest_path, error)) {
+        return false;
     }
 
-    // Handbrake input (Space key)
-    input_params.handbrake = input::is_key_down(SAPP_KEYCODE_SPACE);
+    // Start from an empty static world; the streamer installs chunks as they load
+    world_geometry.boxes.clear();
+    build_broadphase(world_geometry);
+    scn.clear();
+    streamer = std::move(next);
+    streamer->prime(character.position, world_geometry, scn);
+    level.reset();
+    return true;
+}
+
+void game_world::update(float dt, const controller_input_params& input_params) {
+    FL_PROFILE_ZONE("game_world::update");
 
-    // Validate normalized input direction
+    debug_list.clear();
+
+    if (streamer) {
+        streamer->update(character.position, world_geometry, scn);
+    }
+
+    // Validate normalized input direction (input polling lives in the platform layer)
     float input_length = glm::length(input_params.move_direction);
-    FL_POSTCONDITION(input_length == 0.0f || glm::epsilonEqual(input_length, 1.0f, 0.001f),
-                     "input direction must be zero or normalized");
+    FL_PRECONDITION(input_length == 0.0f || glm::epsilonEqual(input_length, 1.0f, 0.001f),
+                    "input direction must be zero or normalized");
 
     // Construct camera input params with heading-relative basis (car-like control)
     controller::camera_input_params cam_params;
@@ -112,8 +148,61 @@ void game_world::update(float dt) {
         eye_position = cam_follow.compute_eye_position(character.position);
     }
 
+    glm::vec3 look_target = cam_follow.compute_look_target(character.position);
+    if (cam_follow.avoid_occlusion) {
+        eye_position = cam_follow.resolve_occlusion(look_target, eye_position, world_geometry);
+    }
+
     cam.set_position(eye_position);
-    cam.set_target(cam_follow.compute_look_target(character.position));
+    cam.set_target(look_target);
+}
+
+world_render_state capture_render_state(const game_world& world) {
+    world_render_state state;
+    state.position = world.character.position;
+    state.collision_center = world.character.collision_sphere.center;
+    state.heading_yaw = world.character.heading_yaw;
+    state.orientation_yaw = world.vehicle_reactive.orientation.yaw_spring.position;
+    state.lean = world.vehicle_reactive.lean_spring.position;
+    state.pitch = world.vehicle_reactive.pitch_spring.position;
+    state.camera_eye = world.cam.get_position();
+    state.camera_target = world.cam.get_target();
+    state.camera_fov = world.cam.get_fov();
+    return state;
+}
+
+void apply_render_state(game_world& world, const world_render_state& state) {
+    world.character.position = state.position;
+    world.character.collision_sphere.center = state.collision_center;
+    world.character.heading_yaw = state.heading_yaw;
+    world.vehicle_reactive.orientation.yaw_spring.position = state.orientation_yaw;
+    world.vehicle_reactive.lean_spring.position = state.lean;
+    world.vehicle_reactive.pitch_spring.position = state.pitch;
+    world.cam.set_position(state.camera_eye);
+    world.cam.set_target(state.camera_target);
+    world.cam.set_fov(state.camera_fov);
+}
+
+world_render_state interpolate_render_state(const world_render_state& previous,
+                                            const world_render_state& current, float alpha) {
+    FL_ASSERT_IN_RANGE(alpha, 0.0f, 1.0f, "interpolation alpha");
+
+    // Yaw wraps at ±π: blend along the shortest arc so a wrap doesn't spin the vehicle
+    auto lerp_angle = [alpha](float from, float to) {
+        return math::wrap_angle_radians(from + math::wrap_angle_radians(to - from) * alpha);
+    };
+
+    world_render_state state;
+    state.position = glm::mix(previous.position, current.position, alpha);
+    state.collision_center = glm::mix(previous.collision_center, current.collision_center, alpha);
+    state.heading_yaw = lerp_angle(previous.heading_yaw, current.heading_yaw);
+    state.orientation_yaw = lerp_angle(previous.orientation_yaw, current.orientation_yaw);
+    state.lean = glm::mix(previous.lean, current.lean, alpha);
+    state.pitch = glm::mix(previous.pitch, current.pitch, alpha);
+    state.camera_eye = glm::mix(previous.camera_eye, current.camera_eye, alpha);
+    state.camera_target = glm::mix(previous.camera_target, current.camera_target, alpha);
+    state.camera_fov = glm::mix(previous.camera_fov, current.camera_fov, alpha);
+    return state;
 }
 
 void game_world::apply_camera_orbit(float delta_x, float delta_y) {
@@ -124,6 +213,9 @@ void game_world::apply_camera_zoom(float delta) {
     cam_follow.zoom(delta);
 }
 
+// Test level floor, built at compile time and drawn straight from read-only memory
+constexpr auto TEST_LEVEL_FLOOR = foundation::make_grid_table<40>(40.0f);
+
 void setup_test_level(game_world& world) {
     // Platform system geometry
     constexpr float PLATFORM_BASE_HEIGHT = 1.0f;
@@ -144,8 +236,10 @@ void setup_test_level(game_world& world) {
     constexpr float STEP_HALF_EXTENT = 0.8f;
     constexpr int STEP_COUNT = 4;
 
-    foundation::wireframe_mesh floor = foundation::generate_grid_floor(40.0f, 40);
-    world.scn.add_object(floor);
+    scene_mesh floor;
+    floor.vertices = TEST_LEVEL_FLOOR.vertex_span();
+    floor.indices = TEST_LEVEL_FLOOR.index_span();
+    world.scn.add_view(floor);
 
     // Ground collision plane (replaces special-case ground at y=0)
     collision_box ground_plane;
@@ -204,4 +298,6 @@ void setup_test_level(game_world& world) {
         step.type = collision_surface_type::FLOOR;
         world.world_geometry.boxes.push_back(step);
     }
+
+    build_broadphase(world.world_geometry);
 }
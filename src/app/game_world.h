@@ -4,6 +4,7 @@
 #include "camera/camera_follow.h"
 #include "camera/dynamic_fov.h"
 #include "vehicle/controller.h"
+#include "vehicle/controller_input_params.h"
 #include "vehicle/tuning.h"
 #include "vehicle/vehicle_reactive_systems.h"
 #include "character/character_reactive_systems.h"
@@ -11,7 +12,11 @@
 #include "rendering/velocity_trail.h"
 #include "foundation/collision_primitives.h"
 #include "rendering/debug_primitives.h"
+#include "app/level_file.h"
+#include "app/level_streaming.h"
 #include <glm/glm.hpp>
+#include <memory>
+#include <string>
 #include <vector>
 
 struct game_world {
@@ -27,12 +32,53 @@ struct game_world {
 
     debug::debug_primitive_list debug_list;
 
+    // Mapped level that world_geometry and scn borrow from (null for the built-in test level);
+    // shared so copies of the world keep it alive
+    std::shared_ptr<const app::level_file> level;
+
+    // Chunked level streamed around the character (null unless stream_level was called);
+    // updated at the start of every tick
+    std::shared_ptr<app::level_streamer> streamer;
+
     void init();
-    void update(float dt);
+    // Replace the static level with a compiled level file (dynamic boxes are kept).
+    // On failure the current level is left untouched.
+    app::level_file_status load_level(const char* path);
+    // Replace the static level with a copy of `description` (dynamic boxes are kept), e.g. a
+    // generated stress level
+    void build_level(const app::level_description& description);
+    // Replace the static level with a chunked level (see level_streaming.h), loading the
+    // chunks around the character before returning. Returns false with `error` set if the
+    // manifest cannot be read.
+    bool stream_level(const char* manifest_path, std::string& error);
+    // Input is sampled by the caller (platform runtime or headless script) so the
+    // simulation has no dependency on the window/input layer
+    void update(float dt, const controller_input_params& input_params);
 
     // Camera input forwarding
     void apply_camera_orbit(float delta_x, float delta_y);
     void apply_camera_zoom(float delta);
 };
 
+// Presentation state that fixed-timestep rendering blends between the last two ticks
+// (vehicle position, reactive visual transforms and the follow camera derived from them)
+struct world_render_state {
+    glm::vec3 position{0.0f};
+    glm::vec3 collision_center{0.0f};
+    float heading_yaw = 0.0f;
+    float orientation_yaw = 0.0f;
+    float lean = 0.0f;
+    float pitch = 0.0f;
+    glm::vec3 camera_eye{0.0f};
+    glm::vec3 camera_target{0.0f};
+    float camera_fov = 0.0f;
+};
+
+world_render_state capture_render_state(const game_world& world);
+void apply_render_state(game_world& world, const world_render_state& state);
+
+// Blend from previous to current by alpha in [0, 1] (angles take the shortest arc)
+world_render_state interpolate_render_state(const world_render_state& previous,
+                                            const world_render_state& current, float alpha);
+
 void setup_test_level(game_world& world);
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "app/input_script.h"
+#include "foundation/debug_assert.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace app {
+
+int input_script::length() const {
+    int total = 0;
+    for (const auto& segment : segments) {
+        total += segment.ticks;
+    }
+    return total;
+}
+
+controller_input_params input_script::sample(int tick) const {
+    FL_PRECONDITION(tick >= 0, "tick must be non-negative");
+
+    controller_input_params input_params;
+    input_params.move_direction = glm::vec2(0.0f, 0.0f);
+    input_params.turn_input = 0.0f;
+    input_params.handbrake = false;
+
+    int total = length();
+    if (total <= 0) {
+        return input_params;
+    }
+
+    int local_tick = tick % total;
+    for (const auto& segment : segments) {
+        if (local_tick < segment.ticks) {
+            // Throttle maps to the forward axis; sign-only so the direction stays normalized
+            // (matches keyboard input where W/S produce exactly ±1)
+            if (segment.throttle > 0.0f) {
+                input_params.move_direction.y = 1.0f;
+            } else if (segment.throttle < 0.0f) {
+                input_params.move_direction.y = -1.0f;
+            }
+            input_params.turn_input = std::clamp(segment.turn, -1.0f, 1.0f);
+            input_params.handbrake = segment.handbrake;
+            return input_params;
+        }
+        local_tick -= segment.ticks;
+    }
+
+    return input_params;
+}
+
+input_script default_input_script() {
+    // Durations assume 60Hz ticks. Turns are balanced so the vehicle wanders within the
+    // test level ground plane indefinitely instead of driving off the edge during long soaks.
+    input_script script;
+    script.segments = {
+        {180, 1.0f, 0.0f, false},  // accelerate straight toward max speed
+        {240, 1.0f, 1.0f, false},  // sustained right turn at speed
+        {240, 1.0f, -1.0f, false}, // sustained left turn at speed
+        {60, 1.0f, 1.0f, true},    // handbrake turn
+        {120, 0.0f, 0.0f, false},  // coast under drag
+        {120, -1.0f, 0.0f, false}, // reverse
+        {240, 1.0f, 0.5f, false},  // gentle right arc
+        {120, 0.0f, -0.5f, true},  // handbrake while turning from low speed
+        {240, 1.0f, -0.5f, false}, // gentle left arc
+        {180, 0.0f, 0.0f, false},  // settle
+    };
+    return script;
+}
+
+bool load_input_script(const char* path, input_script& out) {
+    FILE* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        return false;
+    }
+
+    input_script script;
+    char line[256];
+    while (std::fgets(line, sizeof(line), file) != nullptr) {
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r' || line[0] == '\0') {
+            continue;
+        }
+
+        input_script_segment segment;
+        int handbrake = 0;
+        if (std::sscanf(line, "%d %f %f %d", &segment.ticks, &segment.throttle, &segment.turn,
+                        &handbrake) != 4) {
+            continue;
+        }
+        if (segment.ticks <= 0) {
+            continue;
+        }
+        segment.handbrake = handbrake != 0;
+        script.segments.push_back(segment);
+    }
+    std::fclose(file);
+
+    if (script.segments.empty()) {
+        return false;
+    }
+
+    out = script;
+    return true;
+}
+
+} // namespace app
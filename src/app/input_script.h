@@ -0,0 +1,38 @@
+#pragma once
+
+#include "vehicle/controller_input_params.h"
+#include <vector>
+
+// Scripted controller input for running the simulation without a window.
+// A script is a looping sequence of segments, each holding constant input
+// for a number of fixed ticks. Used by headless soak/tuning runs and benchmarks.
+
+namespace app {
+
+struct input_script_segment {
+    int ticks = 1;          // duration (fixed simulation ticks)
+    float throttle = 0.0f;  // forward/back input [-1, 1]
+    float turn = 0.0f;      // turn input [-1, 1] (positive = right turn)
+    bool handbrake = false; // handbrake held
+};
+
+struct input_script {
+    std::vector<input_script_segment> segments;
+
+    // Total ticks in one pass over all segments
+    int length() const;
+
+    // Input for a given tick; the script loops once it runs out of segments
+    controller_input_params sample(int tick) const;
+};
+
+// Built-in script exercising acceleration, steering, handbrake and reverse
+input_script default_input_script();
+
+// Load a script from a text file: one segment per line as
+//   <ticks> <throttle> <turn> <handbrake 0|1>
+// Blank lines and lines starting with '#' are ignored.
+// Returns false if the file cannot be read or contains no valid segments.
+bool load_input_script(const char* path, input_script& out);
+
+} // namespace app
@@ -0,0 +1,442 @@
+#include "app/level_file.h"
+#include "foundation/collision.h"
+#include "foundation/debug_assert.h"
+#include "rendering/scene.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace app {
+
+namespace {
+
+// Sections start on cache-line boundaries (also satisfies every element's alignment)
+constexpr uint64_t SECTION_ALIGNMENT = 64;
+
+constexpr size_t SECTION_COUNT = static_cast<size_t>(level_section::COUNT);
+
+// Element sizes are part of the format: a change here needs a LEVEL_FILE_VERSION bump
+static_assert(sizeof(collision_box) == 28, "collision_box layout is part of the level format");
+static_assert(sizeof(bvh_node) == 32, "bvh_node layout is part of the level format");
+static_assert(sizeof(glm::vec3) == 12, "glm::vec3 layout is part of the level format");
+static_assert(sizeof(level_mesh_record) == 52, "level_mesh_record layout changed");
+static_assert(std::is_trivially_copyable_v<collision_box> &&
+                  std::is_trivially_copyable_v<bvh_node> &&
+                  std::is_trivially_copyable_v<level_mesh_record>,
+              "level sections are used in place");
+
+constexpr uint32_t ELEMENT_SIZES[SECTION_COUNT] = {
+    sizeof(collision_box),     // BOXES
+    sizeof(bvh_node),          // BVH_NODES
+    sizeof(uint32_t),          // BVH_ITEM_INDICES
+    sizeof(glm::vec3),         // BVH_ITEM_MIN
+    sizeof(glm::vec3),         // BVH_ITEM_MAX
+    sizeof(float),             // SOA_MIN_X
+    sizeof(float),             // SOA_MIN_Y
+    sizeof(float),             // SOA_MIN_Z
+    sizeof(float),             // SOA_MAX_X
+    sizeof(float),             // SOA_MAX_Y
+    sizeof(float),             // SOA_MAX_Z
+    sizeof(level_mesh_record), // MESHES
+    sizeof(glm::vec3),         // MESH_VERTICES
+    sizeof(uint32_t),          // MESH_INDICES
+};
+
+constexpr level_section SOA_SECTIONS[] = {level_section::SOA_MIN_X, level_section::SOA_MIN_Y,
+                                          level_section::SOA_MIN_Z, level_section::SOA_MAX_X,
+                                          level_section::SOA_MAX_Y, level_section::SOA_MAX_Z};
+
+uint64_t align_up(uint64_t value) {
+    return (value + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+// Header and section table checks only (constant time)
+level_file_status check_header(const unsigned char* data, size_t size) {
+    if (size < sizeof(level_file_header)) {
+        return level_file_status::BAD_HEADER;
+    }
+    const auto& header = *reinterpret_cast<const level_file_header*>(data);
+    if (std::memcmp(header.magic, "FLVL", 4) != 0 || header.byte_order != 0x01020304u) {
+        return level_file_status::BAD_HEADER;
+    }
+    if (header.version != LEVEL_FILE_VERSION) {
+        return level_file_status::VERSION_MISMATCH;
+    }
+    if (header.section_count != SECTION_COUNT || header.file_size != size) {
+        return level_file_status::CORRUPT;
+    }
+
+    for (size_t i = 0; i < SECTION_COUNT; ++i) {
+        const level_section_entry& entry = header.sections[i];
+        if (entry.element_size != ELEMENT_SIZES[i] || entry.offset % SECTION_ALIGNMENT != 0 ||
+            entry.offset > size || entry.count > (size - entry.offset) / entry.element_size) {
+            return level_file_status::CORRUPT;
+        }
+    }
+
+    // Arrays that mirror the boxes must match their count (the broadphase may be absent)
+    auto count = [&](level_section id) { return header.sections[static_cast<size_t>(id)].count; };
+    uint64_t boxes = count(level_section::BOXES);
+    bool has_bvh = count(level_section::BVH_NODES) > 0;
+    for (level_section id : {level_section::BVH_ITEM_INDICES, level_section::BVH_ITEM_MIN,
+                             level_section::BVH_ITEM_MAX}) {
+        if (count(id) != (has_bvh ? boxes : 0)) {
+            return level_file_status::CORRUPT;
+        }
+    }
+    uint64_t soa = count(level_section::SOA_MIN_X);
+    bool soa_valid = soa == 0 || (soa % SOA_LANES == 0 && soa >= boxes && soa - boxes < SOA_LANES);
+    for (level_section id : SOA_SECTIONS) {
+        soa_valid = soa_valid && count(id) == soa;
+    }
+    if (!soa_valid) {
+        return level_file_status::CORRUPT;
+    }
+
+    // add_level_meshes slices the geometry sections by these ranges on every load. One pass
+    // over the records (not the geometry) keeps opening proportional to the mesh count.
+    const auto* records = reinterpret_cast<const level_mesh_record*>(
+        data + header.sections[static_cast<size_t>(level_section::MESHES)].offset);
+    uint64_t vertices = count(level_section::MESH_VERTICES);
+    uint64_t indices = count(level_section::MESH_INDICES);
+    for (uint64_t i = 0; i < count(level_section::MESHES); ++i) {
+        const level_mesh_record& record = records[i];
+        if (static_cast<uint64_t>(record.first_vertex) + record.vertex_count > vertices ||
+            static_cast<uint64_t>(record.first_index) + record.index_count > indices) {
+            return level_file_status::CORRUPT;
+        }
+    }
+    return level_file_status::OK;
+}
+
+bool write_padding(std::FILE* file, uint64_t& written, uint64_t target) {
+    static const unsigned char zeros[SECTION_ALIGNMENT] = {};
+    while (written < target) {
+        size_t chunk = static_cast<size_t>(std::min<uint64_t>(target - written, sizeof(zeros)));
+        if (std::fwrite(zeros, 1, chunk, file) != chunk) {
+            return false;
+        }
+        written += chunk;
+    }
+    return true;
+}
+
+bool parse_surface_type(const char* name, collision_surface_type& out) {
+    struct named_type {
+        const char* name;
+        collision_surface_type type;
+    };
+    static const named_type types[] = {
+        {"none", collision_surface_type::NONE},
+        {"floor", collision_surface_type::FLOOR},
+        {"wall", collision_surface_type::WALL},
+        {"platform", collision_surface_type::PLATFORM},
+        {"dynamic", collision_surface_type::DYNAMIC},
+    };
+    for (const named_type& t : types) {
+        if (std::strcmp(name, t.name) == 0) {
+            out = t.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool finite(const glm::vec3& v) {
+    return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+}
+
+} // namespace
+
+const char* level_file_status_name(level_file_status status) {
+    switch (status) {
+    case level_file_status::OK:
+        return "ok";
+    case level_file_status::CANNOT_OPEN:
+        return "cannot open file";
+    case level_file_status::BAD_HEADER:
+        return "not a level file (or different byte order)";
+    case level_file_status::VERSION_MISMATCH:
+        return "level format version mismatch (recompile the level)";
+    case level_file_status::CORRUPT:
+        return "corrupt level file";
+    }
+    return "unknown";
+}
+
+level_file_status level_file::open(const char* path) {
+    header = nullptr;
+    if (!file.open(path)) {
+        return level_file_status::CANNOT_OPEN;
+    }
+    level_file_status status = check_header(file.data(), file.size());
+    if (status != level_file_status::OK) {
+        file.close();
+        return status;
+    }
+    header = reinterpret_cast<const level_file_header*>(file.data());
+    return status;
+}
+
+void use_level(const level_file& level, collision_world& world, scene& scn) {
+    FL_PRECONDITION(level.is_open(), "use_level requires an open level file");
+
+    size_t box_count = level.box_count();
+    world.boxes.borrow(level.section<collision_box>(level_section::BOXES));
+
+    world.bvh.nodes.borrow(level.section<bvh_node>(level_section::BVH_NODES));
+    world.bvh.item_indices.borrow(level.section<uint32_t>(level_section::BVH_ITEM_INDICES));
+    world.bvh.item_min.borrow(level.section<glm::vec3>(level_section::BVH_ITEM_MIN));
+    world.bvh.item_max.borrow(level.section<glm::vec3>(level_section::BVH_ITEM_MAX));
+    world.bvh.source_count = world.bvh.empty() ? 0 : box_count;
+
+    foundation::mapped_array<float>* soa_arrays[] = {&world.soa.min_x, &world.soa.min_y,
+                                                     &world.soa.min_z, &world.soa.max_x,
+                                                     &world.soa.max_y, &world.soa.max_z};
+    for (size_t i = 0; i < std::size(SOA_SECTIONS); ++i) {
+        soa_arrays[i]->borrow(level.section<float>(SOA_SECTIONS[i]));
+    }
+    world.soa.source_count = world.soa.empty() ? 0 : box_count;
+    refresh_world_revision(world);
+
+    scn.clear();
+    add_level_meshes(level, scn);
+}
+
+void add_level_meshes(const level_file& level, scene& scn, uint32_t group) {
+    std::span<const glm::vec3> vertices = level.section<glm::vec3>(level_section::MESH_VERTICES);
+    std::span<const uint32_t> indices = level.section<uint32_t>(level_section::MESH_INDICES);
+    std::span<const level_mesh_record> records =
+        level.section<level_mesh_record>(level_section::MESHES);
+    for (const level_mesh_record& record : records) {
+        scene_mesh mesh;
+        mesh.vertices = vertices.subspan(record.first_vertex, record.vertex_count);
+        mesh.indices = indices.subspan(record.first_index, record.index_count);
+        mesh.position = record.position;
+        mesh.rotation = record.rotation;
+        mesh.scale = record.scale;
+        scn.add_view(mesh, group);
+    }
+}
+
+bool validate_level_contents(const level_file& level, std::string& error) {
+    if (!level.is_open()) {
+        error = "level is not open";
+        return false;
+    }
+
+    std::span<const collision_box> boxes = level.section<collision_box>(level_section::BOXES);
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const collision_box& box = boxes[i];
+        auto type = static_cast<int>(box.type);
+        if (type < static_cast<int>(collision_surface_type::NONE) ||
+            type > static_cast<int>(collision_surface_type::DYNAMIC) ||
+            !finite(box.bounds.center) || !finite(box.bounds.half_extents) ||
+            glm::any(glm::lessThan(box.bounds.half_extents, glm::vec3(0.0f)))) {
+            error = "box " + std::to_string(i) + " is invalid";
+            return false;
+        }
+    }
+
+    std::span<const bvh_node> nodes = level.section<bvh_node>(level_section::BVH_NODES);
+    std::span<const uint32_t> items = level.section<uint32_t>(level_section::BVH_ITEM_INDICES);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const bvh_node& node = nodes[i];
+        bool in_range = node.is_leaf() ? static_cast<uint64_t>(node.first) + node.count <=
+                                             items.size()
+                                       : node.first > i && node.first + 1u < nodes.size();
+        if (!in_range) {
+            error = "BVH node " + std::to_string(i) + " is out of range";
+            return false;
+        }
+    }
+
+    // Traversal stacks hold BVH_MAX_DEPTH levels. Children follow their parent (checked
+    // above), so one forward pass finds the longest path to every node.
+    std::vector<int> depths(nodes.size(), 0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (depths[i] > BVH_MAX_DEPTH) {
+            error = "BVH node " + std::to_string(i) + " is deeper than " +
+                    std::to_string(BVH_MAX_DEPTH) + " levels";
+            return false;
+        }
+        if (!nodes[i].is_leaf()) {
+            for (uint32_t child = nodes[i].first; child <= nodes[i].first + 1; ++child) {
+                depths[child] = std::max(depths[child], depths[i] + 1);
+            }
+        }
+    }
+    for (uint32_t item : items) {
+        if (item >= boxes.size()) {
+            error = "BVH item index out of range";
+            return false;
+        }
+    }
+
+    std::span<const glm::vec3> vertices = level.section<glm::vec3>(level_section::MESH_VERTICES);
+    std::span<const uint32_t> indices = level.section<uint32_t>(level_section::MESH_INDICES);
+    std::span<const level_mesh_record> meshes =
+        level.section<level_mesh_record>(level_section::MESHES);
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const level_mesh_record& mesh = meshes[i];
+        bool in_range =
+            static_cast<uint64_t>(mesh.first_vertex) + mesh.vertex_count <= vertices.size() &&
+            static_cast<uint64_t>(mesh.first_index) + mesh.index_count <= indices.size() &&
+            mesh.index_count % 2 == 0;
+        for (uint32_t k = 0; in_range && k < mesh.index_count; ++k) {
+            in_range = indices[mesh.first_index + k] < mesh.vertex_count;
+        }
+        if (!in_range) {
+            error = "mesh " + std::to_string(i) + " is out of range";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool write_level_file(const char* path, const collision_world& world,
+                      std::span<const foundation::wireframe_mesh> meshes) {
+    FL_PRECONDITION(world.bvh.empty() || world.bvh.source_count == world.boxes.size(),
+                    "write_level_file requires a current broadphase (build_broadphase)");
+    FL_PRECONDITION(world.soa.empty() || world.soa.source_count == world.boxes.size(),
+                    "write_level_file requires a current broadphase (build_broadphase)");
+
+    // Meshes flattened into the upload-ready layout (indices relative to each mesh)
+    std::vector<level_mesh_record> records;
+    std::vector<glm::vec3> vertices;
+    std::vector<uint32_t> indices;
+    for (const foundation::wireframe_mesh& mesh : meshes) {
+        level_mesh_record record;
+        record.first_vertex = static_cast<uint32_t>(vertices.size());
+        record.vertex_count = static_cast<uint32_t>(mesh.vertices.size());
+        record.first_index = static_cast<uint32_t>(indices.size());
+        record.index_count = static_cast<uint32_t>(mesh.edges.size() * 2);
+        record.position = mesh.position;
+        record.rotation = mesh.rotation;
+        record.scale = mesh.scale;
+        records.push_back(record);
+        vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+        for (const foundation::edge& e : mesh.edges) {
+            indices.push_back(static_cast<uint32_t>(e.v0));
+            indices.push_back(static_cast<uint32_t>(e.v1));
+        }
+    }
+
+    struct section_source {
+        const void* data;
+        size_t count;
+    };
+    const section_source sources[SECTION_COUNT] = {
+        {world.boxes.data(), world.boxes.size()},
+        {world.bvh.nodes.data(), world.bvh.nodes.size()},
+        {world.bvh.item_indices.data(), world.bvh.item_indices.size()},
+        {world.bvh.item_min.data(), world.bvh.item_min.size()},
+        {world.bvh.item_max.data(), world.bvh.item_max.size()},
+        {world.soa.min_x.data(), world.soa.min_x.size()},
+        {world.soa.min_y.data(), world.soa.min_y.size()},
+        {world.soa.min_z.data(), world.soa.min_z.size()},
+        {world.soa.max_x.data(), world.soa.max_x.size()},
+        {world.soa.max_y.data(), world.soa.max_y.size()},
+        {world.soa.max_z.data(), world.soa.max_z.size()},
+        {records.data(), records.size()},
+        {vertices.data(), vertices.size()},
+        {indices.data(), indices.size()},
+    };
+
+    level_file_header header;
+    uint64_t offset = align_up(sizeof(level_file_header));
+    for (size_t i = 0; i < SECTION_COUNT; ++i) {
+        level_section_entry& entry = header.sections[i];
+        entry.offset = offset;
+        entry.count = sources[i].count;
+        entry.element_size = ELEMENT_SIZES[i];
+        offset = align_up(offset + entry.count * entry.element_size);
+    }
+    header.file_size = offset;
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint64_t written = 0;
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    written += sizeof(header);
+    for (size_t i = 0; ok && i < SECTION_COUNT; ++i) {
+        const level_section_entry& entry = header.sections[i];
+        ok = write_padding(file, written, entry.offset);
+        size_t bytes = static_cast<size_t>(entry.count * entry.element_size);
+        ok = ok && (bytes == 0 || std::fwrite(sources[i].data, 1, bytes, file) == bytes);
+        written += bytes;
+    }
+    ok = ok && write_padding(file, written, header.file_size);
+    ok = std::fclose(file) == 0 && ok;
+    return ok;
+}
+
+bool load_level_description(const char* path, level_description& out, std::string& error) {
+    FILE* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        error = std::string("cannot read ") + path;
+        return false;
+    }
+
+    level_description level;
+    char line[256];
+    int line_number = 0;
+    bool ok = true;
+    while (ok && std::fgets(line, sizeof(line), file) != nullptr) {
+        line_number++;
+        char keyword[32] = {};
+        if (line[0] == '#' || std::sscanf(line, "%31s", keyword) != 1) {
+            continue; // comment or blank
+        }
+
+        if (std::strcmp(keyword, "box") == 0) {
+            char type[32] = {};
+            collision_box box;
+            glm::vec3& c = box.bounds.center;
+            glm::vec3& h = box.bounds.half_extents;
+            ok = std::sscanf(line, "box %31s %f %f %f %f %f %f", type, &c.x, &c.y, &c.z, &h.x,
+                             &h.y, &h.z) == 7 &&
+                 parse_surface_type(type, box.type) && finite(c) && finite(h) &&
+                 !glm::any(glm::lessThan(h, glm::vec3(0.0f)));
+            if (ok) {
+                level.boxes.push_back(box);
+            }
+        } else if (std::strcmp(keyword, "grid_floor") == 0) {
+            float size = 0.0f;
+            int divisions = 0;
+            ok = std::sscanf(line, "grid_floor %f %d", &size, &divisions) == 2 && size > 0.0f &&
+                 divisions > 0;
+            if (ok) {
+                level.meshes.push_back(foundation::generate_grid_floor(size, divisions));
+            }
+        } else if (std::strcmp(keyword, "wire_box") == 0) {
+            foundation::box_dimensions dims;
+            glm::vec3 position(0.0f);
+            ok = std::sscanf(line, "wire_box %f %f %f %f %f %f", &dims.width, &dims.height,
+                             &dims.depth, &position.x, &position.y, &position.z) == 6 &&
+                 dims.width > 0.0f && dims.height > 0.0f && dims.depth > 0.0f;
+            if (ok) {
+                foundation::wireframe_mesh mesh = foundation::generate_box(dims);
+                mesh.position = position;
+                level.meshes.push_back(mesh);
+            }
+        } else {
+            ok = false;
+        }
+    }
+    std::fclose(file);
+
+    if (!ok) {
+        error = std::string(path) + ":" + std::to_string(line_number) + ": malformed line";
+        return false;
+    }
+    out = std::move(level);
+    return true;
+}
+
+} // namespace app
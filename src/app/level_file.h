@@ -0,0 +1,153 @@
+#pragma once
+
+#include "foundation/collision_primitives.h"
+#include "foundation/mapped_file.h"
+#include "foundation/procedural_mesh.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+class scene;
+
+// Binary level file (.flvl): static collision boxes, their prebuilt broadphase (BVH nodes and
+// SoA bounds) and static wireframe meshes, stored exactly as the simulation and renderer use
+// them. The file is memory-mapped and used in place: opening checks the header, section table
+// and mesh record ranges only, and use_level points the collision world and scene at the
+// mapped arrays, so startup cost does not grow with level size beyond the pages actually
+// touched.
+//
+// Layout: level_file_header, then one 64-byte-aligned array per section (native byte order;
+// files from a different byte order or format version are rejected, not converted).
+// Levels are compiled from a text description by froglords_level_compiler.
+
+namespace app {
+
+// Bump whenever any section's element layout or meaning changes
+constexpr uint32_t LEVEL_FILE_VERSION = 1;
+
+enum class level_section : uint32_t {
+    BOXES,            // collision_box
+    BVH_NODES,        // bvh_node
+    BVH_ITEM_INDICES, // uint32_t
+    BVH_ITEM_MIN,     // glm::vec3
+    BVH_ITEM_MAX,     // glm::vec3
+    SOA_MIN_X,        // float (SoA arrays padded to a multiple of SOA_LANES)
+    SOA_MIN_Y,
+    SOA_MIN_Z,
+    SOA_MAX_X,
+    SOA_MAX_Y,
+    SOA_MAX_Z,
+    MESHES,        // level_mesh_record
+    MESH_VERTICES, // glm::vec3 (all meshes back to back)
+    MESH_INDICES,  // uint32_t line-list indices, relative to the mesh's first vertex
+    COUNT
+};
+
+struct level_section_entry {
+    uint64_t offset = 0; // bytes from the start of the file
+    uint64_t count = 0;  // elements
+    uint32_t element_size = 0;
+    uint32_t reserved = 0;
+};
+
+struct level_file_header {
+    char magic[4] = {'F', 'L', 'V', 'L'};
+    uint32_t version = LEVEL_FILE_VERSION;
+    uint32_t byte_order = 0x01020304u; // reads differently on a foreign-endian machine
+    uint32_t section_count = static_cast<uint32_t>(level_section::COUNT);
+    uint64_t file_size = 0;
+    level_section_entry sections[static_cast<size_t>(level_section::COUNT)];
+};
+
+// One static mesh: ranges into MESH_VERTICES and MESH_INDICES plus its transform
+struct level_mesh_record {
+    uint32_t first_vertex = 0;
+    uint32_t vertex_count = 0;
+    uint32_t first_index = 0;
+    uint32_t index_count = 0;
+    glm::vec3 position{0.0f};
+    glm::vec3 rotation{0.0f}; // Euler angles (radians)
+    glm::vec3 scale{1.0f};
+};
+
+enum class level_file_status {
+    OK,
+    CANNOT_OPEN,      // missing, unreadable or empty file
+    BAD_HEADER,       // not a level file, or written with a different byte order
+    VERSION_MISMATCH, // recompile the level
+    CORRUPT           // sections out of bounds or inconsistent with each other
+};
+
+const char* level_file_status_name(level_file_status status);
+
+class level_file {
+  public:
+    level_file_status open(const char* path);
+
+    bool is_open() const { return header != nullptr; }
+    size_t box_count() const { return count(level_section::BOXES); }
+    size_t mesh_count() const { return count(level_section::MESHES); }
+    size_t file_size() const { return file.size(); }
+
+    // Read every page of the file ahead of use (see mapped_file::prefault)
+    void prefault() const { file.prefault(); }
+
+    // Typed view of a section (T must match the section's element type)
+    template <typename T>
+    std::span<const T> section(level_section id) const {
+        if (header == nullptr) {
+            return {};
+        }
+        const level_section_entry& entry = header->sections[static_cast<size_t>(id)];
+        return {reinterpret_cast<const T*>(file.data() + entry.offset),
+                static_cast<size_t>(entry.count)};
+    }
+
+  private:
+    size_t count(level_section id) const {
+        return header != nullptr ? static_cast<size_t>(
+                                       header->sections[static_cast<size_t>(id)].count)
+                                 : 0;
+    }
+
+    foundation::mapped_file file;
+    const level_file_header* header = nullptr;
+};
+
+// Point `world`'s static boxes and broadphase and `scn`'s meshes at the level's arrays
+// (replacing their current contents; dynamic boxes are kept). Nothing is copied: the level
+// must outlive both. Cost is one scene entry per mesh.
+void use_level(const level_file& level, collision_world& world, scene& scn);
+
+// Add the level's meshes to `scn` as borrowed views in `group` (see scene::remove_group)
+void add_level_meshes(const level_file& level, scene& scn, uint32_t group = 0);
+
+// Full consistency check of every box, BVH node (ranges and depth) and mesh range (reads the
+// whole file).
+// Opening a level trusts the contents; compilers and tests call this after writing.
+bool validate_level_contents(const level_file& level, std::string& error);
+
+// Write `world` (broadphase must be current, see build_broadphase) and `meshes` as a level
+// file. Returns false if the file cannot be written.
+bool write_level_file(const char* path, const collision_world& world,
+                      std::span<const foundation::wireframe_mesh> meshes);
+
+// Level source before compiling
+struct level_description {
+    std::vector<collision_box> boxes;
+    std::vector<foundation::wireframe_mesh> meshes;
+};
+
+// Load a text level description, one item per line:
+//   box <none|floor|wall|platform|dynamic> <cx> <cy> <cz> <hx> <hy> <hz>
+//   grid_floor <size> <divisions>
+//   wire_box <width> <height> <depth> <x> <y> <z>
+// Blank lines and lines starting with '#' are ignored.
+// Returns false (with a message naming the line) if the file cannot be read or a line is
+// malformed.
+bool load_level_description(const char* path, level_description& out, std::string& error);
+
+} // namespace app
@@ -0,0 +1,511 @@
+#include "app/level_streaming.h"
+#include "foundation/collision.h"
+#include "foundation/debug_assert.h"
+#include "foundation/memory_tracking.h"
+#include "foundation/profiler.h"
+#include "foundation/trace.h"
+#include "rendering/scene.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <utility>
+
+namespace app {
+
+namespace {
+
+float distance_to_bounds(const glm::vec3& position, const level_chunk_info& chunk) {
+    return glm::length(position - glm::clamp(position, chunk.bounds_min, chunk.bounds_max));
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since)
+        .count();
+}
+
+// Upper bound on the merged collision arrays per static box: the box, at most two BVH nodes,
+// its leaf index and bounds, and its SoA bounds (build_broadphase)
+constexpr uint64_t MERGED_BYTES_PER_BOX = sizeof(collision_box) + 2 * sizeof(bvh_node) +
+                                          sizeof(uint32_t) + 2 * sizeof(glm::vec3) +
+                                          6 * sizeof(float);
+
+// Installed chunk set plus one being built or waiting to install (see loader_main)
+constexpr uint64_t MERGED_COPIES = 2;
+
+size_t merged_world_bytes(const collision_world& world) {
+    return world.boxes.size() * sizeof(collision_box) +
+           world.bvh.nodes.size() * sizeof(bvh_node) +
+           world.bvh.item_indices.size() * sizeof(uint32_t) +
+           (world.bvh.item_min.size() + world.bvh.item_max.size()) * sizeof(glm::vec3) +
+           6 * world.soa.min_x.size() * sizeof(float);
+}
+
+void grow_bounds(level_chunk_info& chunk, const glm::vec3& point) {
+    chunk.bounds_min = glm::min(chunk.bounds_min, point);
+    chunk.bounds_max = glm::max(chunk.bounds_max, point);
+}
+
+// Everything one tile holds while partitioning
+struct chunk_contents {
+    level_chunk_info info;
+    collision_world world;
+    std::vector<foundation::wireframe_mesh> meshes;
+};
+
+} // namespace
+
+bool load_level_manifest(const char* path, level_manifest& out, std::string& error) {
+    FILE* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        error = std::string("cannot read ") + path;
+        return false;
+    }
+
+    std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    level_manifest manifest;
+    char line[1024];
+    int line_number = 0;
+    bool ok = true;
+    while (ok && std::fgets(line, sizeof(line), file) != nullptr) {
+        line_number++;
+        char keyword[32] = {};
+        if (line[0] == '#' || std::sscanf(line, "%31s", keyword) != 1) {
+            continue; // comment or blank
+        }
+
+        if (std::strcmp(keyword, "chunk_size") == 0) {
+            ok = std::sscanf(line, "chunk_size %f", &manifest.chunk_size) == 1 &&
+                 manifest.chunk_size > 0.0f;
+        } else if (std::strcmp(keyword, "chunk") == 0) {
+            level_chunk_info chunk;
+            unsigned long long bytes = 0;
+            int consumed = 0;
+            ok = std::sscanf(line, "chunk %d %d %llu %f %f %f %f %f %f %n", &chunk.x, &chunk.z,
+                             &bytes, &chunk.bounds_min.x, &chunk.bounds_min.y,
+                             &chunk.bounds_min.z, &chunk.bounds_max.x, &chunk.bounds_max.y,
+                             &chunk.bounds_max.z, &consumed) == 9 &&
+                 consumed > 0;
+            if (ok) {
+                // The file name is the rest of the line (may contain spaces)
+                std::string name = line + consumed;
+                while (!name.empty() && (name.back() == '\n' || name.back() == '\r')) {
+                    name.pop_back();
+                }
+                chunk.bytes = bytes;
+                chunk.path = (directory / name).string();
+                ok = !name.empty();
+                manifest.chunks.push_back(chunk);
+            }
+        } else {
+            ok = false;
+        }
+    }
+    std::fclose(file);
+
+    if (!ok) {
+        error = std::string(path) + ":" + std::to_string(line_number) + ": malformed line";
+        return false;
+    }
+    out = std::move(manifest);
+    return true;
+}
+
+bool write_chunked_level(const char* manifest_path, const level_description& level,
+                         float chunk_size, std::string& error) {
+    FL_PRECONDITION(chunk_size > 0.0f, "chunk_size must be positive");
+
+    // Ordered by tile so the manifest (and chunk indices) are deterministic
+    std::map<std::pair<int32_t, int32_t>, chunk_contents> tiles;
+    auto tile_for = [&](const glm::vec3& point) -> chunk_contents& {
+        auto key = std::make_pair(static_cast<int32_t>(std::floor(point.x / chunk_size)),
+                                  static_cast<int32_t>(std::floor(point.z / chunk_size)));
+        auto [it, inserted] = tiles.try_emplace(key);
+        if (inserted) {
+            it->second.info.x = key.first;
+            it->second.info.z = key.second;
+            it->second.info.bounds_min = glm::vec3(std::numeric_limits<float>::max());
+            it->second.info.bounds_max = glm::vec3(-std::numeric_limits<float>::max());
+        }
+        return it->second;
+    };
+
+    for (const collision_box& box : level.boxes) {
+        chunk_contents& tile = tile_for(box.bounds.center);
+        tile.world.boxes.push_back(box);
+        grow_bounds(tile.info, box.bounds.center - box.bounds.half_extents);
+        grow_bounds(tile.info, box.bounds.center + box.bounds.half_extents);
+    }
+    for (const foundation::wireframe_mesh& mesh : level.meshes) {
+        chunk_contents& tile = tile_for(mesh.position);
+        tile.meshes.push_back(mesh);
+        glm::mat4 model = mesh.get_model_matrix();
+        for (const glm::vec3& vertex : mesh.vertices) {
+            grow_bounds(tile.info, glm::vec3(model * glm::vec4(vertex, 1.0f)));
+        }
+        grow_bounds(tile.info, mesh.position); // meshes without vertices
+    }
+
+    std::filesystem::path manifest_file(manifest_path);
+    level_manifest manifest;
+    manifest.chunk_size = chunk_size;
+    for (auto& [key, tile] : tiles) {
+        std::string name = manifest_file.filename().string() + "." + std::to_string(key.first) +
+                           "_" + std::to_string(key.second) + ".flvl";
+        std::string path = (manifest_file.parent_path() / name).string();
+
+        build_broadphase(tile.world);
+        if (!write_level_file(path.c_str(), tile.world, tile.meshes)) {
+            error = "cannot write " + path;
+            return false;
+        }
+        tile.info.bytes = std::filesystem::file_size(path);
+        tile.info.path = name;
+        manifest.chunks.push_back(tile.info);
+    }
+
+    FILE* file = std::fopen(manifest_path, "w");
+    if (file == nullptr) {
+        error = std::string("cannot write ") + manifest_path;
+        return false;
+    }
+    std::fprintf(file, "# FrogLords chunked level: chunk x z bytes min max file\n");
+    std::fprintf(file, "chunk_size %.9g\n", static_cast<double>(manifest.chunk_size));
+    for (const level_chunk_info& chunk : manifest.chunks) {
+        std::fprintf(file, "chunk %d %d %llu %.9g %.9g %.9g %.9g %.9g %.9g %s\n", chunk.x,
+                     chunk.z, static_cast<unsigned long long>(chunk.bytes),
+                     static_cast<double>(chunk.bounds_min.x),
+                     static_cast<double>(chunk.bounds_min.y),
+                     static_cast<double>(chunk.bounds_min.z),
+                     static_cast<double>(chunk.bounds_max.x),
+                     static_cast<double>(chunk.bounds_max.y),
+                     static_cast<double>(chunk.bounds_max.z), chunk.path.c_str());
+    }
+    if (std::fclose(file) != 0) {
+        error = std::string("cannot write ") + manifest_path;
+        return false;
+    }
+    return true;
+}
+
+uint64_t chunk_budget_bytes(const level_chunk_info& chunk) {
+    // The file holds the chunk's boxes, so it bounds their count
+    uint64_t max_boxes = chunk.bytes / sizeof(collision_box);
+    return chunk.bytes + MERGED_COPIES * max_boxes * MERGED_BYTES_PER_BOX;
+}
+
+level_streamer::~level_streamer() {
+    if (loader.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        loader.join();
+    }
+}
+
+bool level_streamer::open(const char* manifest_path, std::string& error) {
+    FL_PRECONDITION(!is_open(), "level_streamer::open called twice");
+    if (!load_level_manifest(manifest_path, chunk_manifest, error)) {
+        return false;
+    }
+    chunks.assign(chunk_manifest.chunks.size(), chunk_state{});
+    loader = std::thread([this] { loader_main(); });
+    return true;
+}
+
+void level_streamer::update(const glm::vec3& position, collision_world& world, scene& scn) {
+    FL_PROFILE_ZONE("level_streamer::update");
+    FL_PRECONDITION(is_open(), "level_streamer::update requires open()");
+    FL_PRECONDITION(settings.unload_radius >= settings.load_radius,
+                    "unload_radius must not be below load_radius");
+
+    std::unique_ptr<merge_job> merged;
+    bool merge_waiting = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished_scratch.swap(finished_loads);
+        merged = std::move(finished_merge);
+        merge_waiting = merge_request != nullptr;
+    }
+    collect_loads();
+    if (merged) {
+        install(std::move(merged), world, scn);
+        if (merge_waiting) {
+            wake.notify_one(); // the loader holds newer sets back until this one is installed
+        }
+    }
+
+    release_retained();
+    request_chunks(position);
+
+    // Every change to the resident set gets its own merged broadphase (built off-thread)
+    if (set_changed) {
+        set_changed = false;
+        auto job = std::make_unique<merge_job>();
+        for (uint32_t i = 0; i < chunks.size(); ++i) {
+            if (chunks[i].status == chunk_status::RESIDENT) {
+                job->chunks.push_back(i);
+                job->files.push_back(chunks[i].file);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            merge_request = std::move(job);
+        }
+        wake.notify_one();
+    }
+
+    streaming_stats.resident_chunks = 0;
+    streaming_stats.loading_chunks = 0;
+    for (const chunk_state& chunk : chunks) {
+        streaming_stats.resident_chunks += chunk.status == chunk_status::RESIDENT ? 1 : 0;
+        streaming_stats.loading_chunks += chunk.status == chunk_status::LOADING ? 1 : 0;
+    }
+    streaming_stats.resident_bytes = committed_bytes + retained_bytes;
+    streaming_stats.retained_bytes = retained_bytes;
+}
+
+void level_streamer::prime(const glm::vec3& position, collision_world& world, scene& scn) {
+    // Loads finish, then the merge of the loaded set finishes, then it is installed
+    for (int step = 0; step < 2; ++step) {
+        update(position, world, scn);
+        wait_idle();
+    }
+    update(position, world, scn);
+}
+
+void level_streamer::wait_idle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    // A set held back behind an uninstalled one needs the next update, not the loader
+    idle.wait(lock, [this] {
+        return load_queue.empty() && (!merge_request || finished_merge) && !loader_busy;
+    });
+}
+
+void level_streamer::collect_loads() {
+    for (load_result& result : finished_scratch) {
+        chunk_state& chunk = chunks[result.chunk];
+        FL_ASSERT(chunk.status == chunk_status::LOADING, "load finished for a chunk not loading");
+        if (result.file) {
+            chunk.status = chunk_status::RESIDENT;
+            chunk.file = std::move(result.file);
+            streaming_stats.loads++;
+            set_changed = true;
+        } else {
+            chunk.status = chunk_status::FAILED;
+            committed_bytes -= chunk_budget_bytes(chunk_manifest.chunks[result.chunk]);
+            streaming_stats.failures++;
+        }
+    }
+    finished_scratch.clear();
+}
+
+void level_streamer::request_chunks(const glm::vec3& position) {
+    candidates.clear();
+    eviction_order.clear();
+    for (uint32_t i = 0; i < chunks.size(); ++i) {
+        float distance = distance_to_bounds(position, chunk_manifest.chunks[i]);
+        if (chunks[i].status == chunk_status::RESIDENT) {
+            if (distance > settings.unload_radius) {
+                evict(i);
+            } else {
+                eviction_order.emplace_back(distance, i);
+            }
+        } else if (chunks[i].status == chunk_status::UNLOADED &&
+                   distance <= settings.load_radius) {
+            candidates.emplace_back(distance, i);
+        }
+    }
+    if (candidates.empty()) {
+        return;
+    }
+
+    // Nearest chunks load first; over budget, they displace the farthest resident ones
+    std::sort(candidates.begin(), candidates.end());
+    std::sort(eviction_order.begin(), eviction_order.end(),
+              [](const auto& a, const auto& b) { return a > b; });
+    size_t next_victim = 0;
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& [distance, index] : candidates) {
+            uint64_t bytes = chunk_budget_bytes(chunk_manifest.chunks[index]);
+            while (committed_bytes + bytes > settings.memory_budget &&
+                   next_victim < eviction_order.size() &&
+                   eviction_order[next_victim].first > distance) {
+                evict(eviction_order[next_victim++].second);
+            }
+            if (committed_bytes + bytes > settings.memory_budget) {
+                streaming_stats.over_budget++;
+                continue;
+            }
+            if (committed_bytes + retained_bytes + bytes > settings.memory_budget) {
+                continue; // fits once evicted chunks are unmapped: retried on a later update
+            }
+
+            chunk_state& chunk = chunks[index];
+            chunk.status = chunk_status::LOADING;
+            chunk.requested_at = clock::now();
+            committed_bytes += bytes;
+            load_queue.push_back(index);
+            queued = true;
+        }
+    }
+    if (queued) {
+        wake.notify_one();
+    }
+}
+
+void level_streamer::evict(uint32_t index) {
+    // The installed chunk set keeps the file mapped until a set without it replaces it, so
+    // its charge moves to retained_bytes until then
+    chunk_state& chunk = chunks[index];
+    uint64_t bytes = chunk_budget_bytes(chunk_manifest.chunks[index]);
+    retained.push_back(retained_file{chunk.file, bytes});
+    retained_bytes += bytes;
+    committed_bytes -= bytes;
+
+    chunk.status = chunk_status::UNLOADED;
+    chunk.file.reset();
+    chunk.installed = false; // a reload is a new load, with its own latency
+    streaming_stats.evictions++;
+    set_changed = true;
+}
+
+void level_streamer::release_retained() {
+    auto unmapped = [this](const retained_file& entry) {
+        if (!entry.file.expired()) {
+            return false;
+        }
+        retained_bytes -= entry.bytes;
+        return true;
+    };
+    retained.erase(std::remove_if(retained.begin(), retained.end(), unmapped), retained.end());
+}
+
+void level_streamer::install(std::unique_ptr<merge_job> job, collision_world& world,
+                             scene& scn) {
+    FL_PROFILE_ZONE("level_streamer::install");
+    FL_MEMORY_TAG(COLLISION);
+
+    // The scene's views point into the chunk files: a chunk keeps its meshes only while the
+    // new set has the same file for it (an evicted and reloaded chunk has a new mapping, and
+    // the old one is unmapped once the previous set is released below)
+    const std::vector<uint32_t> no_chunks;
+    const std::vector<std::shared_ptr<const level_file>> no_files;
+    const std::vector<uint32_t>& previous = installed ? installed->chunks : no_chunks;
+    const std::vector<std::shared_ptr<const level_file>>& previous_files =
+        installed ? installed->files : no_files;
+    auto same_file = [](const std::vector<uint32_t>& set_chunks,
+                        const std::vector<std::shared_ptr<const level_file>>& set_files,
+                        uint32_t index, const std::shared_ptr<const level_file>& file) {
+        // Chunk lists are sorted by index
+        auto found = std::lower_bound(set_chunks.begin(), set_chunks.end(), index);
+        return found != set_chunks.end() && *found == index &&
+               set_files[static_cast<size_t>(found - set_chunks.begin())] == file;
+    };
+    for (size_t k = 0; k < previous.size(); ++k) {
+        if (!same_file(job->chunks, job->files, previous[k], previous_files[k])) {
+            scn.remove_group(previous[k] + 1);
+        }
+    }
+    for (size_t k = 0; k < job->chunks.size(); ++k) {
+        uint32_t index = job->chunks[k];
+        if (same_file(previous, previous_files, index, job->files[k])) {
+            continue;
+        }
+        add_level_meshes(*job->files[k], scn, index + 1);
+
+        // Latency is recorded once per load, when the set holding that load's file goes in
+        chunk_state& chunk = chunks[index];
+        if (!chunk.installed && chunk.file == job->files[k]) {
+            chunk.installed = true;
+            double latency = elapsed_ms(chunk.requested_at);
+            streaming_stats.installed_loads++;
+            total_load_ms += latency;
+            streaming_stats.last_load_ms = latency;
+            streaming_stats.average_load_ms = total_load_ms /
+                                             static_cast<double>(streaming_stats.installed_loads);
+            streaming_stats.max_load_ms = std::max(streaming_stats.max_load_ms, latency);
+        }
+    }
+
+    world.boxes = std::move(job->world.boxes);
+    world.bvh = std::move(job->world.bvh);
+    world.soa = std::move(job->world.soa);
+    refresh_world_revision(world);
+    streaming_stats.resident_boxes = world.boxes.size();
+    streaming_stats.merged_bytes = merged_world_bytes(world);
+    streaming_stats.last_merge_ms = job->build_ms;
+
+    installed = std::move(job);
+}
+
+void level_streamer::loader_main() {
+    FL_TRACE_THREAD_NAME("level_loader");
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        // A new merge waits for the finished one to be installed: with the installed set
+        // that bounds the merged collision copies alive at once to MERGED_COPIES
+        wake.wait(lock, [this] {
+            return stopping || !load_queue.empty() || (merge_request && !finished_merge);
+        });
+        if (stopping) {
+            return;
+        }
+        loader_busy = true;
+
+        if (!load_queue.empty()) {
+            uint32_t index = load_queue.front();
+            load_queue.pop_front();
+            const std::string& path = chunk_manifest.chunks[index].path; // immutable once open
+            lock.unlock();
+
+            auto file = std::make_shared<level_file>();
+            std::shared_ptr<const level_file> result;
+            if (file->open(path.c_str()) == level_file_status::OK) {
+                file->prefault();
+                result = std::move(file);
+            }
+
+            lock.lock();
+            finished_loads.push_back(load_result{index, std::move(result)});
+        } else {
+            std::unique_ptr<merge_job> job = std::move(merge_request);
+            lock.unlock();
+
+            FL_PROFILE_ZONE("level_streamer::merge");
+            FL_MEMORY_TAG(COLLISION);
+            auto start = clock::now();
+            size_t box_count = 0;
+            for (const auto& file : job->files) {
+                box_count += file->box_count();
+            }
+            job->world.boxes.resize(box_count);
+            collision_box* out = job->world.boxes.data();
+            for (const auto& file : job->files) {
+                std::span<const collision_box> boxes =
+                    file->section<collision_box>(level_section::BOXES);
+                out = std::copy(boxes.begin(), boxes.end(), out);
+            }
+            build_broadphase(job->world);
+            job->build_ms = elapsed_ms(start);
+
+            lock.lock();
+            finished_merge = std::move(job);
+        }
+
+        loader_busy = false;
+        if (load_queue.empty() && (!merge_request || finished_merge)) {
+            idle.notify_all();
+        }
+    }
+}
+
+} // namespace app
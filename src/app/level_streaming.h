@@ -0,0 +1,199 @@
+#pragma once
+
+#include "app/level_file.h"
+#include "foundation/collision_primitives.h"
+#include <glm/glm.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class scene;
+
+// Chunked levels: a large level is split into square tiles on the XZ plane, each compiled to
+// its own level file (see level_file.h) and listed in a text manifest. level_streamer maps
+// the chunks near the player on a background thread, evicts distant ones, and keeps the
+// collision world and scene holding exactly the resident chunks, within a memory budget.
+
+namespace app {
+
+struct level_chunk_info {
+    int32_t x = 0; // tile coordinates (chunk_size units)
+    int32_t z = 0;
+    // Everything in the chunk; boxes and meshes may overhang their tile
+    glm::vec3 bounds_min{0.0f};
+    glm::vec3 bounds_max{0.0f};
+    uint64_t bytes = 0; // file size
+    std::string path;   // level file (relative to the manifest when written)
+};
+
+struct level_manifest {
+    float chunk_size = 64.0f;
+    std::vector<level_chunk_info> chunks;
+};
+
+// Manifest text format, one item per line:
+//   chunk_size <meters>
+//   chunk <x> <z> <bytes> <min x y z> <max x y z> <file>
+// Blank lines and lines starting with '#' are ignored. Chunk paths are returned resolved
+// against the manifest's directory.
+bool load_level_manifest(const char* path, level_manifest& out, std::string& error);
+
+// Split `level` into chunk_size tiles (a box or mesh belongs to the tile holding its center
+// or position) and write one level file per non-empty tile, named
+// "<manifest_path>.<x>_<z>.flvl", plus the manifest itself
+bool write_chunked_level(const char* manifest_path, const level_description& level,
+                         float chunk_size, std::string& error);
+
+// Bytes a chunk is charged against the streaming memory budget: its file plus an upper bound
+// on its boxes' share of the merged collision arrays (the installed copy and one rebuild)
+uint64_t chunk_budget_bytes(const level_chunk_info& chunk);
+
+struct level_streaming_settings {
+    float load_radius = 150.0f; // meters from the position to a chunk's bounds
+    // Resident chunks are evicted beyond this (> load_radius, so chunks on the boundary do
+    // not reload every time the player turns around)
+    float unload_radius = 200.0f;
+    // Charged per chunk (chunk_budget_bytes) from its load request until its file is unmapped,
+    // which for an evicted chunk is once no installed or pending chunk set still uses it
+    size_t memory_budget = size_t(256) << 20;
+};
+
+struct level_streaming_stats {
+    int resident_chunks = 0;
+    int loading_chunks = 0;
+    size_t resident_bytes = 0; // charged against the budget (loading, resident, still mapped)
+    size_t retained_bytes = 0; // part of resident_bytes: evicted chunks not yet unmapped
+    size_t merged_bytes = 0;   // collision arrays of the installed chunk set (actual)
+    size_t resident_boxes = 0; // static boxes in the installed collision world
+    uint64_t loads = 0;
+    uint64_t installed_loads = 0; // loads that reached the world (evicted first: never)
+    uint64_t evictions = 0;
+    uint64_t failures = 0;     // chunk files that did not open (not retried)
+    uint64_t over_budget = 0;  // loads skipped because the budget was full
+    // Load latency: request until the chunk is in the collision world and scene
+    double last_load_ms = 0.0;
+    double average_load_ms = 0.0;
+    double max_load_ms = 0.0;
+    double last_merge_ms = 0.0; // background broadphase build for the last chunk set
+};
+
+// Streams a chunked level around a moving position
+//
+// update() runs on the simulation thread and never waits for I/O: it queues loads for chunks
+// within load_radius (nearest first), evicts chunks beyond unload_radius, and installs
+// whatever the loader thread has finished. The loader thread maps chunk files (touching
+// their pages so the simulation never faults them in) and builds the merged broadphase for
+// each new chunk set; installing it replaces the world's static boxes in one step.
+//
+// When the budget is full, a nearer chunk evicts the farthest resident ones beyond its own
+// distance; otherwise the load is skipped until space frees up. Evicted chunks stay charged
+// until the chunk set without them is installed and their files are unmapped, so the load
+// waits for that. At most two merged collision copies exist at a time (installed, and one
+// being built or waiting to install), which chunk_budget_bytes accounts for.
+class level_streamer {
+  public:
+    level_streamer() = default;
+    ~level_streamer();
+    level_streamer(const level_streamer&) = delete;
+    level_streamer& operator=(const level_streamer&) = delete;
+
+    // Read the manifest and start the loader thread
+    bool open(const char* manifest_path, std::string& error);
+    bool is_open() const { return loader.joinable(); }
+
+    // Request chunks around `position` and install finished ones into `world` (static boxes
+    // only; dynamic boxes are kept) and `scn` (objects grouped by chunk, group = index + 1)
+    void update(const glm::vec3& position, collision_world& world, scene& scn);
+
+    // Blocking update: returns once the chunks around `position` are installed (level start,
+    // teleports)
+    void prime(const glm::vec3& position, collision_world& world, scene& scn);
+
+    // Block until the loader thread has finished everything queued so far; the next update
+    // installs it
+    void wait_idle();
+
+    const level_manifest& manifest() const { return chunk_manifest; }
+    const level_streaming_stats& stats() const { return streaming_stats; }
+
+    level_streaming_settings settings;
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    enum class chunk_status { UNLOADED, LOADING, RESIDENT, FAILED };
+
+    struct chunk_state {
+        chunk_status status = chunk_status::UNLOADED;
+        std::shared_ptr<const level_file> file; // while RESIDENT
+        clock::time_point requested_at{};
+        bool installed = false; // this load's file is in the world and scene
+    };
+
+    // Evicted chunk whose file may still be mapped by a chunk set
+    struct retained_file {
+        std::weak_ptr<const level_file> file;
+        uint64_t bytes = 0; // budget charge carried over from the chunk
+    };
+
+    struct load_result {
+        uint32_t chunk = 0;
+        std::shared_ptr<const level_file> file; // null if the file did not open
+    };
+
+    // One resident chunk set, and (once built) its merged collision arrays
+    struct merge_job {
+        std::vector<uint32_t> chunks;
+        std::vector<std::shared_ptr<const level_file>> files; // parallel to chunks
+        collision_world world;
+        double build_ms = 0.0;
+    };
+
+    void loader_main();
+    void collect_loads();
+    void request_chunks(const glm::vec3& position);
+    void evict(uint32_t chunk);
+    void release_retained();
+    void install(std::unique_ptr<merge_job> job, collision_world& world, scene& scn);
+
+    level_manifest chunk_manifest;
+    std::vector<chunk_state> chunks; // parallel to chunk_manifest.chunks
+    size_t committed_bytes = 0;      // budget charge of resident + loading chunks
+    size_t retained_bytes = 0;       // budget charge of evicted chunks still mapped
+    std::vector<retained_file> retained;
+    bool set_changed = false;
+
+    // Chunk set currently in the world and scene (keeps evicted files mapped until replaced)
+    std::unique_ptr<merge_job> installed;
+
+    // Scratch reused every update
+    std::vector<load_result> finished_scratch;
+    std::vector<std::pair<float, uint32_t>> candidates;
+    std::vector<std::pair<float, uint32_t>> eviction_order;
+
+    // Shared with the loader thread (guarded by mutex)
+    std::mutex mutex;
+    std::condition_variable wake;     // work queued or stopping
+    std::condition_variable idle;     // loader finished its queue
+    std::deque<uint32_t> load_queue;
+    std::unique_ptr<merge_job> merge_request; // newest chunk set only
+    std::vector<load_result> finished_loads;
+    std::unique_ptr<merge_job> finished_merge; // no new merge starts until it is installed
+    bool loader_busy = false;
+    bool stopping = false;
+
+    level_streaming_stats streaming_stats;
+    double total_load_ms = 0.0;
+
+    std::thread loader; // last member: started once everything it reads is constructed
+};
+
+} // namespace app
@@ -8,9 +8,49 @@
 #include "rendering/debug_draw.h"
 #include "rendering/debug_visualization.h"
 #include "app/debug_generation.h"
+#include "foundation/memory_tracking.h"
+#include "foundation/profiler.h"
+#include "foundation/trace.h"
+#include "vehicle/controller_input_params.h"
 #include <imgui.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+// Written to the working directory; open in chrome://tracing or ui.perfetto.dev
+constexpr const char* TRACE_CAPTURE_PATH = "froglords_trace.json";
+
+// Per-subsystem heap table written on exit when memory tracking is compiled in
+constexpr const char* MEMORY_REPORT_PATH = "froglords_memory.txt";
+
+// Poll keyboard state into controller input (platform layer → simulation)
+controller_input_params poll_controller_input() {
+    controller_input_params input_params;
+    input_params.move_direction = glm::vec2(0.0f, 0.0f);
+    input_params.move_direction.y += input::is_key_down(SAPP_KEYCODE_W) ? 1.0f : 0.0f;
+    input_params.move_direction.y -= input::is_key_down(SAPP_KEYCODE_S) ? 1.0f : 0.0f;
+
+    // A/D input for turning (car-like control only)
+    float lateral_input = 0.0f;
+    lateral_input -= input::is_key_down(SAPP_KEYCODE_A) ? 1.0f : 0.0f;
+    lateral_input += input::is_key_down(SAPP_KEYCODE_D) ? 1.0f : 0.0f;
+
+    input_params.turn_input = lateral_input;
+
+    if (glm::length(input_params.move_direction) > 0.0f) {
+        input_params.move_direction = glm::normalize(input_params.move_direction);
+    }
+
+    // Handbrake input (Space key)
+    input_params.handbrake = input::is_key_down(SAPP_KEYCODE_SPACE);
+
+    return input_params;
+}
+
+} // namespace
 
 app_runtime& runtime() {
     static app_runtime instance;
@@ -31,16 +71,45 @@ void app_runtime::initialize() {
     pass_action.colors[0].load_action = SG_LOADACTION_CLEAR;
     pass_action.colors[0].clear_value = {0.1f, 0.1f, 0.1f, 1.0f};
 
+    FL_TRACE_THREAD_NAME("main");
+    jobs = std::make_unique<job_system>();
+
     input::init();
     gui::init();
 
     renderer.init();
+    debug_meshes = debug::create_instanced_meshes(renderer);
 
     world.init();
+    if (startup_level != nullptr) {
+        load_startup_level();
+    }
+    previous_render_state = capture_render_state(world);
 
     initialized = true;
 }
 
+void app_runtime::set_startup_level(const char* path, bool streamed) {
+    startup_level = path;
+    startup_level_streamed = streamed;
+}
+
+void app_runtime::load_startup_level() {
+    // On failure the built-in test level stays loaded
+    if (startup_level_streamed) {
+        std::string error;
+        if (!world.stream_level(startup_level, error)) {
+            std::fprintf(stderr, "Failed to stream level: %s\n", error.c_str());
+        }
+        return;
+    }
+    app::level_file_status status = world.load_level(startup_level);
+    if (status != app::level_file_status::OK) {
+        std::fprintf(stderr, "Failed to load level %s: %s\n", startup_level,
+                     app::level_file_status_name(status));
+    }
+}
+
 void app_runtime::shutdown() {
     if (!initialized) {
         return;
@@ -49,6 +118,13 @@ void app_runtime::shutdown() {
     renderer.shutdown();
     gui::shutdown();
     sg_shutdown();
+    jobs.reset();
+
+#if FROGLORDS_MEMORY_TRACKING
+    if (!memory::write_report(MEMORY_REPORT_PATH)) {
+        std::fprintf(stderr, "Failed to write memory report %s\n", MEMORY_REPORT_PATH);
+    }
+#endif
 
     initialized = false;
 }
@@ -58,9 +134,16 @@ void app_runtime::frame() {
         return;
     }
 
-    float dt = static_cast<float>(sapp_frame_duration());
+    FL_PROFILE_FRAME_BEGIN();
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+    uint64_t allocations_at_start = memory::allocation_count();
+#endif
+
+    // Everything allocated from the arena last frame was rendered and released with it
+    last_frame_memory = frame_memory.stats();
+    frame_memory.reset();
 
-    ensure_static_meshes();
+    float dt = static_cast<float>(sapp_frame_duration());
 
     // Track mouse position every frame to prevent stale delta accumulation
     static float last_mouse_x = 0.0f;
@@ -83,13 +166,33 @@ void app_runtime::frame() {
     last_mouse_x = input::mouse_x();
     last_mouse_y = input::mouse_y();
 
-    world.update(dt);
+    controller_input_params input_params = poll_controller_input();
+    if (timestep_config.enabled) {
+        int dropped_before = timestep_state.dropped_ticks;
+        int ticks = app::advance_fixed_timestep(timestep_state, timestep_config, dt);
+        if (timestep_state.dropped_ticks != dropped_before) {
+            FL_TRACE_INSTANT("fixed_timestep: catch-up limit, ticks dropped");
+        }
+        for (int i = 0; i < ticks; ++i) {
+            previous_render_state = capture_render_state(world);
+            world.update(timestep_config.tick_dt(), input_params);
+        }
+    } else {
+        world.update(dt, input_params);
+        previous_render_state = capture_render_state(world);
+        timestep_state.last_frame_ticks = 1;
+    }
 
     // Handle F3 key press to toggle debug visualization
     if (input::is_key_pressed(SAPP_KEYCODE_F3)) {
         debug_viz::toggle();
     }
 
+    // F4 starts a trace capture; pressing it again stops and writes the file
+    if (input::is_key_pressed(SAPP_KEYCODE_F4)) {
+        toggle_trace_capture();
+    }
+
     input::update();
 
     gui::begin_frame();
@@ -100,6 +203,8 @@ void app_runtime::frame() {
     ImGuiWindowFlags flags = ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoMove;
 
     if (ImGui::Begin("Debug Panel", nullptr, flags)) {
+        FL_MEMORY_TAG(GUI);
+
         // Vehicle section
         auto vehicle_commands = gui::draw_vehicle_panel(
             vehicle_panel_state, world.character, world.vehicle_params, world.vehicle_reactive);
@@ -120,33 +225,145 @@ void app_runtime::frame() {
         // Apply FOV commands (unidirectional flow: GUI → commands → game state)
         apply_fov_commands(fov_commands);
 
+        // Simulation section
+        draw_simulation_panel();
+
+        // Profiler section (trace capture toggle is the only action it requests)
+        if (gui::draw_profiler_panel(profiler_panel_state)) {
+            toggle_trace_capture();
+        }
+
         // FPS display at bottom
         ImGui::Spacing();
         ImGui::Separator();
         ImGui::Text("FPS: %.1f", 1.0f / sapp_frame_duration());
         gui::plot_histogram("FPS", 1.0f / sapp_frame_duration(), 5.0f, 0.0f, 200.0f, 60);
+
+        // Heap use per subsystem (tag), beside the frame rate it affects
+        gui::draw_memory_panel(memory_panel_state);
+
+        // Renderer counters (previous frame: this frame renders after the panel is built)
+        const render_stats& stats = renderer.stats();
+        ImGui::Text("Draw calls: %d  Meshes: %d  Instances: %d", stats.draw_calls,
+                    stats.meshes_submitted, stats.instances);
+        ImGui::Text("Uploaded: %.1f KB (%d verts, %d indices)",
+                    static_cast<float>(stats.bytes_uploaded) / 1024.0f, stats.vertices,
+                    stats.indices);
+        ImGui::Text("Stream capacity: %.1f KB (%d grows)",
+                    static_cast<float>(stats.stream_capacity) / 1024.0f, stats.stream_grows);
+        if (stats.meshes_dropped > 0 || stats.instances_dropped > 0) {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Dropped: %d meshes, %d instances",
+                               stats.meshes_dropped, stats.instances_dropped);
+        }
+
+        // Transient memory (previous frame); steady-state frames should not touch the heap
+        ImGui::Text("Frame arena: %.1f / %.0f KB (peak %.1f KB, %d grows)",
+                    static_cast<float>(last_frame_memory.used) / 1024.0f,
+                    static_cast<float>(last_frame_memory.capacity) / 1024.0f,
+                    static_cast<float>(last_frame_memory.peak) / 1024.0f, last_frame_memory.grows);
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+        ImGui::Text("Heap allocations: %llu",
+                    static_cast<unsigned long long>(last_frame_allocations));
+#endif
     }
     ImGui::End();
 
-    render_world();
-}
+    if (timestep_config.enabled) {
+        // Render between the last two ticks, then restore the authoritative tick state so the
+        // simulation never integrates from an interpolated pose
+        world_render_state current_render_state = capture_render_state(world);
+        float alpha = app::interpolation_alpha(timestep_state, timestep_config);
+        apply_render_state(world, interpolate_render_state(previous_render_state,
+                                                           current_render_state, alpha));
+        render_world();
+        apply_render_state(world, current_render_state);
+    } else {
+        render_world();
+    }
 
-void app_runtime::handle_event(const sapp_event* e) {
-    gui::handle_event(e);
-    input::process_event(e);
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+    last_frame_allocations = memory::allocation_count() - allocations_at_start;
+#endif
+#if FROGLORDS_MEMORY_TRACKING
+    memory::end_frame();
+#endif
+    FL_PROFILE_FRAME_END();
 }
 
-void app_runtime::ensure_static_meshes() {
-    if (static_meshes_initialized) {
+void app_runtime::toggle_trace_capture() {
+#if FROGLORDS_PROFILE
+    if (!trace::is_capturing()) {
+        trace::start_capture();
+        profiler_panel_state.trace_status.clear();
         return;
     }
 
-    unit_circle = foundation::generate_circle(glm::vec3(0.0f), {1.0f});
-    unit_sphere_8 = foundation::generate_sphere({8, 8, 1.0f});
-    unit_sphere_6 = foundation::generate_sphere({6, 6, 1.0f});
-    unit_sphere_4 = foundation::generate_sphere({4, 4, 1.0f});
+    trace::stop_capture();
+    trace::capture_stats capture = trace::stats();
+    bool saved = trace::write_chrome_json(TRACE_CAPTURE_PATH);
+    char status[256];
+    std::snprintf(status, sizeof(status), "%s %s (%u events, %u dropped)",
+                  saved ? "Saved" : "Failed to write", TRACE_CAPTURE_PATH, capture.events,
+                  capture.dropped);
+    profiler_panel_state.trace_status = status;
+#endif
+}
+
+void app_runtime::draw_simulation_panel() {
+    if (!ImGui::CollapsingHeader("Simulation", ImGuiTreeNodeFlags_DefaultOpen))
+        return;
 
-    static_meshes_initialized = true;
+    if (ImGui::Checkbox("Fixed Timestep", &timestep_config.enabled) && timestep_config.enabled) {
+        // Start from the live state so the first interpolated frame doesn't blend in a stale pose
+        timestep_state.accumulator = 0.0f;
+        previous_render_state = capture_render_state(world);
+    }
+    if (timestep_config.enabled) {
+        ImGui::SliderFloat("Tick Rate (Hz)", &timestep_config.tick_rate, 10.0f, 240.0f, "%.0f",
+                           ImGuiSliderFlags_AlwaysClamp);
+        ImGui::SliderInt("Max Catch-up Steps", &timestep_config.max_catchup_steps, 1, 16, "%d",
+                         ImGuiSliderFlags_AlwaysClamp);
+    }
+    // Discrete push-out tunnels through thin walls at low tick rates; compare both here
+    ImGui::Checkbox("Swept Collision", &world.character.swept_collision);
+    contact_cache& cache = world.character.collision_cache;
+    ImGui::Text("Contact cache: %.1f%% hits, %d boxes (%llu lookups, %llu overflows)",
+                static_cast<double>(cache.hit_rate() * 100.0f),
+                static_cast<int>(cache.candidate_count),
+                static_cast<unsigned long long>(cache.lookups),
+                static_cast<unsigned long long>(cache.overflows));
+    ImGui::SameLine();
+    if (ImGui::Button("Reset##contact_cache")) {
+        cache.reset_stats();
+    }
+    ImGui::Text("Ticks this frame: %d  Dropped: %d", timestep_state.last_frame_ticks,
+                timestep_state.dropped_ticks);
+
+    if (world.streamer) {
+        const app::level_streaming_stats& stream = world.streamer->stats();
+        ImGui::Text("Chunks: %d resident, %d loading (%.1f / %.0f MiB, %d boxes)",
+                    stream.resident_chunks, stream.loading_chunks,
+                    static_cast<double>(stream.resident_bytes) / (1024.0 * 1024.0),
+                    static_cast<double>(world.streamer->settings.memory_budget) /
+                        (1024.0 * 1024.0),
+                    static_cast<int>(stream.resident_boxes));
+        ImGui::Text("Merged collision: %.1f MiB  Evicted, still mapped: %.1f MiB",
+                    static_cast<double>(stream.merged_bytes) / (1024.0 * 1024.0),
+                    static_cast<double>(stream.retained_bytes) / (1024.0 * 1024.0));
+        ImGui::Text("Chunk load: %.1f ms last, %.1f avg, %.1f max (merge %.1f ms)",
+                    stream.last_load_ms, stream.average_load_ms, stream.max_load_ms,
+                    stream.last_merge_ms);
+        ImGui::Text("Loads %llu  Evictions %llu  Over budget %llu  Failed %llu",
+                    static_cast<unsigned long long>(stream.loads),
+                    static_cast<unsigned long long>(stream.evictions),
+                    static_cast<unsigned long long>(stream.over_budget),
+                    static_cast<unsigned long long>(stream.failures));
+    }
+}
+
+void app_runtime::handle_event(const sapp_event* e) {
+    gui::handle_event(e);
+    input::process_event(e);
 }
 
 void app_runtime::apply_parameter_commands(const std::vector<gui::parameter_command>& commands) {
@@ -222,6 +439,9 @@ void app_runtime::apply_camera_commands(const std::vector<gui::camera_command>&
         case gui::camera_parameter_type::MODE:
             world.cam_follow.mode = cmd.mode;
             break;
+        case gui::camera_parameter_type::AVOID_OCCLUSION:
+            world.cam_follow.avoid_occlusion = cmd.value != 0.0f;
+            break;
         }
     }
 }
@@ -246,6 +466,8 @@ void app_runtime::apply_fov_commands(const std::vector<gui::fov_command>& comman
 }
 
 void app_runtime::render_world() {
+    FL_PROFILE_ZONE("render_world");
+
     sg_pass pass = {};
     pass.action = pass_action;
     pass.swapchain = sglue_swapchain();
@@ -253,23 +475,44 @@ void app_runtime::render_world() {
 
     float aspect = static_cast<float>(sapp_width()) / static_cast<float>(sapp_height());
 
+    // Release the GPU buffers of scene objects removed since the last frame (streamed chunks)
+    for (int handle : world.scn.retired_handles()) {
+        renderer.destroy_instanced_mesh(instanced_mesh_handle{handle});
+    }
+    world.scn.clear_retired_handles();
+
+    // All geometry accumulates for one upload per frame (drawn at end_frame)
+    renderer.begin_frame(world.cam, aspect);
+
+    // Scene meshes are static: upload once to immutable buffers, then draw as single instances
+    // (only the transform and color stream each frame)
     glm::vec4 color(wireframe_color[0], wireframe_color[1], wireframe_color[2], wireframe_color[3]);
-    for (const auto& mesh : world.scn.objects()) {
-        renderer.draw(mesh, world.cam, aspect, color);
+    const auto& objects = world.scn.objects();
+    for (size_t i = 0; i < objects.size(); ++i) {
+        if (world.scn.render_handle(i) < 0) {
+            world.scn.set_render_handle(
+                i, renderer.create_instanced_mesh(objects[i].vertices, objects[i].indices).index);
+        }
+        renderer.submit_instance(instanced_mesh_handle{world.scn.render_handle(i)},
+                                 objects[i].get_model_matrix(), color);
     }
 
     // Debug visualization (toggle with F3)
     if (debug_viz::is_enabled()) {
-        debug::draw_context debug_ctx{renderer,      world.cam,     aspect,       unit_circle,
-                                      unit_sphere_8, unit_sphere_6, unit_sphere_4};
+        FL_MEMORY_TAG(DEBUG);
+        debug::draw_context debug_ctx{renderer, world.cam, aspect, debug_meshes};
 
-        // Generate all debug primitives from the current world state.
-        app::generate_debug_primitives(world.debug_list, world);
+        // Generate all debug primitives from the current world state, into the frame arena
+        // (released by the next frame's reset, so nothing here touches the heap)
+        debug::debug_primitive_list debug_list(&frame_memory);
+        app::generate_debug_primitives(debug_list, world, jobs.get());
 
         // Pass the populated list to the dumb renderer.
-        debug::draw_primitives(debug_ctx, world.debug_list);
+        debug::draw_primitives(debug_ctx, debug_list);
     }
 
+    renderer.end_frame();
+
     gui::render();
 
     sg_end_pass();
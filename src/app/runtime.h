@@ -2,12 +2,20 @@
 
 #include "sokol_gfx.h"
 #include "app/game_world.h"
+#include "app/fixed_timestep.h"
 #include "rendering/renderer.h"
+#include "rendering/debug_draw.h"
 #include "foundation/procedural_mesh.h"
+#include "foundation/frame_arena.h"
+#include "foundation/job_system.h"
 #include "gui/camera_panel.h"
 #include "gui/vehicle_panel.h"
 #include "gui/fov_panel.h"
+#include "gui/profiler_panel.h"
+#include "gui/memory_panel.h"
 #include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
 
 struct sapp_event;
 
@@ -17,30 +25,45 @@ struct app_runtime {
     void frame();
     void handle_event(const sapp_event* e);
 
+    // Level to load at initialize instead of the built-in test level (compiled level file,
+    // or a chunk manifest when `streamed`); `path` must outlive initialize
+    void set_startup_level(const char* path, bool streamed);
+
   private:
-    void ensure_static_meshes();
+    void load_startup_level();
     void render_world();
+    void draw_simulation_panel();
+    void toggle_trace_capture();
     void apply_parameter_commands(const std::vector<gui::parameter_command>& commands);
     void apply_camera_commands(const std::vector<gui::camera_command>& commands);
     void apply_fov_commands(const std::vector<gui::fov_command>& commands);
 
     bool initialized = false;
+    const char* startup_level = nullptr;
+    bool startup_level_streamed = false;
 
     sg_pass_action pass_action{};
 
+    std::unique_ptr<job_system> jobs; // worker threads for parallel sections
     game_world world;
+    app::fixed_timestep_config timestep_config{};
+    app::fixed_timestep_state timestep_state{};
+    world_render_state previous_render_state{}; // state at the start of the latest tick
     wireframe_renderer renderer{};
     gui::camera_panel_state camera_panel_state{};
     gui::vehicle_panel_state vehicle_panel_state{};
     gui::fov_panel_state fov_panel_state{};
+    gui::profiler_panel_state profiler_panel_state{};
+    gui::memory_panel_state memory_panel_state{};
 
     float wireframe_color[4] = {1.0f, 1.0f, 1.0f, 1.0f};
 
-    foundation::wireframe_mesh unit_circle{};
-    foundation::wireframe_mesh unit_sphere_8{};
-    foundation::wireframe_mesh unit_sphere_6{};
-    foundation::wireframe_mesh unit_sphere_4{};
-    bool static_meshes_initialized = false;
+    debug::instanced_meshes debug_meshes{};
+
+    // Transient per-frame data (debug primitives); reset at the start of every frame
+    foundation::frame_arena frame_memory;
+    foundation::frame_arena_stats last_frame_memory{}; // previous frame, for the panel
+    uint64_t last_frame_allocations = 0;               // heap allocations in the previous frame
 };
 
 app_runtime& runtime();
@@ -0,0 +1,370 @@
+#include "app/stress_level.h"
+#include "foundation/collision_primitives.h"
+#include "foundation/debug_assert.h"
+#include "foundation/procedural_mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace app {
+
+namespace {
+
+// Ground slab: top face at y = 0 (matches setup_test_level)
+constexpr float GROUND_HALF_THICKNESS = 0.1f;
+
+// TUNED: City blocks (one cell = one block: 4x4 lots, then a street)
+constexpr int CITY_LOTS = 4;                // per block side
+constexpr float CITY_LOT_PITCH = 9.0f;      // meters
+constexpr float CITY_STREET_WIDTH = 12.0f;  // meters
+constexpr float CITY_MIN_HALF_WIDTH = 2.5f; // meters (lot half-size is 4.5)
+constexpr float CITY_MAX_HALF_WIDTH = 4.0f;
+constexpr float CITY_MIN_HEIGHT = 4.0f;  // meters
+constexpr float CITY_MAX_HEIGHT = 40.0f; // meters (rare: heights are skewed low)
+constexpr float CITY_ROOF_INSET = 0.3f;  // meters (roof slab inside the walls)
+constexpr float CITY_ROOF_HALF_THICKNESS = 0.1f;
+constexpr float CITY_BLOCK_SIZE = CITY_LOTS * CITY_LOT_PITCH + CITY_STREET_WIDTH;
+
+// TUNED: Clutter (one box per cell; same density as the collision benchmarks' random worlds)
+constexpr float CLUTTER_CELL = 4.0f;            // meters
+constexpr float CLUTTER_MIN_HALF_EXTENT = 0.1f; // meters
+constexpr float CLUTTER_MAX_HALF_EXTENT = 1.5f;
+constexpr float CLUTTER_MAX_LIFT = 2.0f; // meters (boxes float up to this above the ground)
+
+// TUNED: Staircases (one per cell)
+constexpr int STAIR_STEPS = 8;
+constexpr float STAIR_CELL = 16.0f;    // meters
+constexpr float STAIR_MIN_RISE = 0.1f; // meters (test level steps rise 0.15)
+constexpr float STAIR_MAX_RISE = 0.35f;
+constexpr float STAIR_MIN_TREAD = 0.6f; // meters
+constexpr float STAIR_MAX_TREAD = 1.2f;
+constexpr float STAIR_MIN_HALF_WIDTH = 0.5f; // meters
+constexpr float STAIR_MAX_HALF_WIDTH = 2.0f;
+
+// TUNED: Corridors (one cell = one segment: a wall on each side, each split by a doorway)
+constexpr float CORRIDOR_LENGTH = 32.0f;    // meters (cell size along X)
+constexpr float CORRIDOR_PITCH = 8.0f;      // meters (cell size along Z)
+constexpr float CORRIDOR_HALF_WIDTH = 2.5f; // meters (center line to wall)
+constexpr float CORRIDOR_WALL_HALF_THICKNESS = 0.1f;
+constexpr float CORRIDOR_WALL_HEIGHT = 3.0f; // meters
+constexpr float CORRIDOR_DOOR_WIDTH = 2.0f;  // meters
+constexpr float CORRIDOR_DOOR_MARGIN = 2.0f; // meters (shortest wall piece beside a door)
+
+struct layout_info {
+    const char* name;
+    float cell_x; // meters
+    float cell_z;
+    size_t boxes_per_cell;
+};
+
+const layout_info& info(stress_layout layout) {
+    static const layout_info layouts[] = {
+        {"city", CITY_BLOCK_SIZE, CITY_BLOCK_SIZE, CITY_LOTS * CITY_LOTS * 2},
+        {"clutter", CLUTTER_CELL, CLUTTER_CELL, 1},
+        {"stairs", STAIR_CELL, STAIR_CELL, STAIR_STEPS},
+        {"corridors", CORRIDOR_LENGTH, CORRIDOR_PITCH, 4},
+    };
+    return layouts[static_cast<size_t>(layout)];
+}
+
+// splitmix64: std distributions differ between standard libraries, which would make one
+// level name mean different scenes on different compilers
+struct stress_rng {
+    uint64_t state;
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // [0, 1) with 24 bits (every value exactly representable as float)
+    float unit() { return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f); }
+
+    float range(float lo, float hi) { return lo + (hi - lo) * unit(); }
+};
+
+collision_box make_box(const glm::vec3& center, const glm::vec3& half_extents,
+                       collision_surface_type type) {
+    collision_box box;
+    box.bounds.center = center;
+    box.bounds.half_extents = half_extents;
+    box.type = type;
+    return box;
+}
+
+// Cell contents; every box stays inside the cell's XZ rectangle (corner at `origin`), so
+// skipping cells keeps an area clear
+void emit_city_block(const glm::vec3& origin, stress_rng& rng, std::vector<collision_box>& out) {
+    float first_lot = CITY_STREET_WIDTH * 0.5f + CITY_LOT_PITCH * 0.5f;
+    for (int lz = 0; lz < CITY_LOTS; ++lz) {
+        for (int lx = 0; lx < CITY_LOTS; ++lx) {
+            glm::vec3 lot = origin + glm::vec3(first_lot + static_cast<float>(lx) * CITY_LOT_PITCH,
+                                               0.0f,
+                                               first_lot + static_cast<float>(lz) * CITY_LOT_PITCH);
+            float hx = rng.range(CITY_MIN_HALF_WIDTH, CITY_MAX_HALF_WIDTH);
+            float hz = rng.range(CITY_MIN_HALF_WIDTH, CITY_MAX_HALF_WIDTH);
+            float skew = rng.unit();
+            float height = CITY_MIN_HEIGHT + (CITY_MAX_HEIGHT - CITY_MIN_HEIGHT) * skew * skew;
+
+            out.push_back(make_box(lot + glm::vec3(0.0f, height * 0.5f, 0.0f),
+                                   glm::vec3(hx, height * 0.5f, hz),
+                                   collision_surface_type::WALL));
+            out.push_back(make_box(lot + glm::vec3(0.0f, height + CITY_ROOF_HALF_THICKNESS, 0.0f),
+                                   glm::vec3(hx - CITY_ROOF_INSET, CITY_ROOF_HALF_THICKNESS,
+                                             hz - CITY_ROOF_INSET),
+                                   collision_surface_type::FLOOR));
+        }
+    }
+}
+
+void emit_clutter(const glm::vec3& origin, stress_rng& rng, std::vector<collision_box>& out) {
+    glm::vec3 half(rng.range(CLUTTER_MIN_HALF_EXTENT, CLUTTER_MAX_HALF_EXTENT),
+                   rng.range(CLUTTER_MIN_HALF_EXTENT, CLUTTER_MAX_HALF_EXTENT),
+                   rng.range(CLUTTER_MIN_HALF_EXTENT, CLUTTER_MAX_HALF_EXTENT));
+    float cell_half = CLUTTER_CELL * 0.5f;
+    glm::vec3 center = origin + glm::vec3(cell_half, 0.0f, cell_half);
+    center.x += rng.range(-1.0f, 1.0f) * (cell_half - half.x);
+    center.z += rng.range(-1.0f, 1.0f) * (cell_half - half.z);
+    center.y = half.y + rng.range(0.0f, CLUTTER_MAX_LIFT);
+
+    float pick = rng.unit();
+    collision_surface_type type = pick < 0.5f   ? collision_surface_type::WALL
+                                  : pick < 0.8f ? collision_surface_type::FLOOR
+                                                : collision_surface_type::PLATFORM;
+    out.push_back(make_box(center, half, type));
+}
+
+void emit_staircase(const glm::vec3& origin, stress_rng& rng, std::vector<collision_box>& out) {
+    static const glm::vec3 directions[] = {
+        {1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}};
+    glm::vec3 forward = directions[rng.next() & 3];
+    glm::vec3 across(std::abs(forward.z), 0.0f, std::abs(forward.x));
+    float rise = rng.range(STAIR_MIN_RISE, STAIR_MAX_RISE);
+    float tread = rng.range(STAIR_MIN_TREAD, STAIR_MAX_TREAD);
+    float half_width = rng.range(STAIR_MIN_HALF_WIDTH, STAIR_MAX_HALF_WIDTH);
+
+    glm::vec3 center = origin + glm::vec3(STAIR_CELL * 0.5f, 0.0f, STAIR_CELL * 0.5f);
+    float middle = static_cast<float>(STAIR_STEPS - 1) * 0.5f;
+    for (int i = 0; i < STAIR_STEPS; ++i) {
+        // Solid steps from the ground up, like the test level's
+        float height = rise * static_cast<float>(i + 1);
+        glm::vec3 step = center + forward * ((static_cast<float>(i) - middle) * tread);
+        step.y = height * 0.5f;
+        glm::vec3 half = glm::abs(forward) * (tread * 0.5f) + across * half_width;
+        half.y = height * 0.5f;
+        out.push_back(make_box(step, half, collision_surface_type::FLOOR));
+    }
+}
+
+void emit_corridor(const glm::vec3& origin, stress_rng& rng, std::vector<collision_box>& out) {
+    float wall_y = CORRIDOR_WALL_HEIGHT * 0.5f;
+    float center_z = origin.z + CORRIDOR_PITCH * 0.5f;
+    for (float side : {-1.0f, 1.0f}) {
+        float z = center_z + side * CORRIDOR_HALF_WIDTH;
+        float door_half = CORRIDOR_DOOR_WIDTH * 0.5f;
+        float door = rng.range(CORRIDOR_DOOR_MARGIN + door_half,
+                               CORRIDOR_LENGTH - CORRIDOR_DOOR_MARGIN - door_half);
+
+        float pieces[2][2] = {{0.0f, door - door_half}, {door + door_half, CORRIDOR_LENGTH}};
+        for (const auto& piece : pieces) {
+            float half_length = (piece[1] - piece[0]) * 0.5f;
+            out.push_back(make_box(
+                glm::vec3(origin.x + piece[0] + half_length, wall_y, z),
+                glm::vec3(half_length, wall_y, CORRIDOR_WALL_HALF_THICKNESS),
+                collision_surface_type::WALL));
+        }
+    }
+}
+
+// Cells along one axis whose span overlaps the spawn clearance
+int spawn_cells(int count, float cell) {
+    float start = -static_cast<float>(count) * cell * 0.5f;
+    int overlapping = 0;
+    for (int i = 0; i < count; ++i) {
+        float lo = start + static_cast<float>(i) * cell;
+        overlapping += (lo < STRESS_SPAWN_CLEARANCE && lo + cell > -STRESS_SPAWN_CLEARANCE);
+    }
+    return overlapping;
+}
+
+// Outline of every box, batched; vertices relative to each batch's center
+void build_outlines(const std::vector<collision_box>& boxes,
+                    std::vector<foundation::wireframe_mesh>& out) {
+    // Corner k: +x if bit 0, +y if bit 1, -z if bit 2 (generate_box's vertex order)
+    static const int box_edges[12][2] = {{0, 1}, {1, 5}, {5, 4}, {4, 0}, {2, 3}, {3, 7},
+                                         {7, 6}, {6, 2}, {0, 2}, {1, 3}, {5, 7}, {4, 6}};
+
+    for (size_t first = 0; first < boxes.size(); first += STRESS_MESH_BATCH) {
+        size_t last = std::min(first + STRESS_MESH_BATCH, boxes.size());
+        glm::vec3 lo(std::numeric_limits<float>::max());
+        glm::vec3 hi(-std::numeric_limits<float>::max());
+        for (size_t i = first; i < last; ++i) {
+            lo = glm::min(lo, boxes[i].bounds.center - boxes[i].bounds.half_extents);
+            hi = glm::max(hi, boxes[i].bounds.center + boxes[i].bounds.half_extents);
+        }
+
+        foundation::wireframe_mesh mesh;
+        mesh.position = (lo + hi) * 0.5f;
+        mesh.vertices.reserve((last - first) * 8);
+        mesh.edges.reserve((last - first) * 12);
+        for (size_t i = first; i < last; ++i) {
+            int base = static_cast<int>(mesh.vertices.size());
+            glm::vec3 center = boxes[i].bounds.center - mesh.position;
+            const glm::vec3& half = boxes[i].bounds.half_extents;
+            for (int k = 0; k < 8; ++k) {
+                mesh.vertices.push_back(center + glm::vec3((k & 1) ? half.x : -half.x,
+                                                           (k & 2) ? half.y : -half.y,
+                                                           (k & 4) ? -half.z : half.z));
+            }
+            for (const auto& e : box_edges) {
+                mesh.edges.emplace_back(base + e[0], base + e[1]);
+            }
+        }
+        out.push_back(std::move(mesh));
+    }
+}
+
+} // namespace
+
+void generate_stress_level(const stress_level_params& params, level_description& out) {
+    FL_PRECONDITION(params.box_count >= 1, "stress level needs at least the ground box");
+    FL_PRECONDITION(params.box_count <= std::numeric_limits<uint32_t>::max(),
+                    "box indices are 32-bit");
+
+    const layout_info& layout = info(params.layout);
+    size_t cells_needed =
+        (params.box_count - 1 + layout.boxes_per_cell - 1) / layout.boxes_per_cell;
+
+    // Smallest roughly square grid with enough cells once the spawn area is skipped
+    int columns = std::max(1, static_cast<int>(std::ceil(std::sqrt(
+                                  static_cast<double>(cells_needed) * layout.cell_z /
+                                  layout.cell_x))));
+    int rows = std::max(1, static_cast<int>((cells_needed + columns - 1) / columns));
+    auto usable = [&]() {
+        return static_cast<size_t>(columns) * static_cast<size_t>(rows) -
+               static_cast<size_t>(spawn_cells(columns, layout.cell_x)) *
+                   static_cast<size_t>(spawn_cells(rows, layout.cell_z));
+    };
+    while (usable() < cells_needed) {
+        (columns * layout.cell_x <= rows * layout.cell_z ? columns : rows) += 1;
+    }
+
+    float width = static_cast<float>(columns) * layout.cell_x;
+    float depth = static_cast<float>(rows) * layout.cell_z;
+
+    out.boxes.clear();
+    out.meshes.clear();
+    out.boxes.reserve(params.box_count + layout.boxes_per_cell);
+    out.boxes.push_back(make_box(glm::vec3(0.0f, -GROUND_HALF_THICKNESS, 0.0f),
+                                 glm::vec3(width * 0.5f, GROUND_HALF_THICKNESS, depth * 0.5f),
+                                 collision_surface_type::FLOOR));
+
+    stress_rng rng{params.seed};
+    for (int row = 0; row < rows && out.boxes.size() < params.box_count; ++row) {
+        for (int column = 0; column < columns && out.boxes.size() < params.box_count;
+             ++column) {
+            glm::vec3 origin(-width * 0.5f + static_cast<float>(column) * layout.cell_x, 0.0f,
+                             -depth * 0.5f + static_cast<float>(row) * layout.cell_z);
+            bool spawn = origin.x < STRESS_SPAWN_CLEARANCE &&
+                         origin.x + layout.cell_x > -STRESS_SPAWN_CLEARANCE &&
+                         origin.z < STRESS_SPAWN_CLEARANCE &&
+                         origin.z + layout.cell_z > -STRESS_SPAWN_CLEARANCE;
+            if (spawn) {
+                continue;
+            }
+
+            switch (params.layout) {
+            case stress_layout::CITY_GRID:
+                emit_city_block(origin, rng, out.boxes);
+                break;
+            case stress_layout::CLUTTER:
+                emit_clutter(origin, rng, out.boxes);
+                break;
+            case stress_layout::STAIRCASES:
+                emit_staircase(origin, rng, out.boxes);
+                break;
+            case stress_layout::CORRIDORS:
+                emit_corridor(origin, rng, out.boxes);
+                break;
+            }
+        }
+    }
+
+    // The last cell may overshoot the count
+    FL_ASSERT(out.boxes.size() >= params.box_count, "stress grid sized too small");
+    out.boxes.resize(params.box_count);
+
+    if (params.meshes) {
+        build_outlines(out.boxes, out.meshes);
+    }
+}
+
+bool parse_stress_level_name(const char* name, stress_level_params& out) {
+    const char* slash = std::strchr(name, '/');
+    if (slash == nullptr) {
+        return false;
+    }
+
+    stress_level_params params;
+    bool found = false;
+    for (stress_layout layout : {stress_layout::CITY_GRID, stress_layout::CLUTTER,
+                                 stress_layout::STAIRCASES, stress_layout::CORRIDORS}) {
+        const char* layout_name = info(layout).name;
+        if (std::strlen(layout_name) == static_cast<size_t>(slash - name) &&
+            std::strncmp(name, layout_name, std::strlen(layout_name)) == 0) {
+            params.layout = layout;
+            found = true;
+        }
+    }
+    if (!found || slash[1] < '0' || slash[1] > '9') {
+        return false;
+    }
+
+    char* end = nullptr;
+    unsigned long long count = std::strtoull(slash + 1, &end, 10);
+    if (*end == 'k') {
+        count *= 1000ull;
+        ++end;
+    } else if (*end == 'm') {
+        count *= 1000000ull;
+        ++end;
+    }
+    if (count < 1 || count > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    params.box_count = static_cast<size_t>(count);
+
+    if (*end == '/') {
+        const char* seed = end + 1;
+        if (*seed < '0' || *seed > '9') {
+            return false;
+        }
+        unsigned long long value = std::strtoull(seed, &end, 10);
+        if (value > std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+        params.seed = static_cast<uint32_t>(value);
+    }
+    if (*end != '\0') {
+        return false;
+    }
+
+    params.meshes = out.meshes;
+    out = params;
+    return true;
+}
+
+std::string stress_level_name(const stress_level_params& params) {
+    return std::string(stress_layout_name(params.layout)) + "/" +
+           std::to_string(params.box_count) + "/" + std::to_string(params.seed);
+}
+
+const char* stress_layout_name(stress_layout layout) {
+    return info(layout).name;
+}
+
+} // namespace app
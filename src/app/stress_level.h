@@ -0,0 +1,54 @@
+#pragma once
+
+#include "app/level_file.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Procedural stress levels: reproducible scenes of 1k to 1M+ collision boxes (with matching
+// wireframe outlines) for benchmarking collision and rendering at scale. A scene is fully
+// determined by its layout, box count and seed, so it is referred to by name, e.g.
+// "city/100000" or "clutter/1m/7" (see parse_stress_level_name).
+
+namespace app {
+
+enum class stress_layout {
+    CITY_GRID,  // blocks of 4x4 buildings (wall box + floor roof) separated by streets
+    CLUTTER,    // one random box per 4 m cell: mixed sizes, heights and surface types
+    STAIRCASES, // field of 8-step staircases, each climbing in a random direction
+    CORRIDORS   // parallel corridors along X: long wall runs with random doorways
+};
+
+struct stress_level_params {
+    stress_layout layout = stress_layout::CLUTTER;
+    size_t box_count = 10000; // exact, including the ground box
+    uint32_t seed = 1;
+    // One outline per box, batched into meshes of STRESS_MESH_BATCH boxes. Collision-only
+    // users skip them (a million outlines are ~200 MB).
+    bool meshes = true;
+};
+
+// Boxes per generated mesh: few enough meshes that scene and renderer bookkeeping stay cheap,
+// small enough that each one is spatially compact (boxes are emitted cell by cell)
+constexpr size_t STRESS_MESH_BATCH = 1024;
+
+// Half-size of the square around the origin (where the character spawns) kept clear of
+// everything but the ground, in meters
+constexpr float STRESS_SPAWN_CLEARANCE = 8.0f;
+
+// Generate the scene described by `params` into `out` (replacing its contents). The ground
+// is box 0, top face at y = 0, covering the whole footprint. Output depends only on params
+// (no std distributions), so a name means the same scene with any compiler.
+void generate_stress_level(const stress_level_params& params, level_description& out);
+
+// Parse "<layout>/<count>[/<seed>]": layout is city, clutter, stairs or corridors; count may
+// end in k (thousands) or m (millions); seed defaults to 1. out.meshes is left as is.
+// Returns false on anything else.
+bool parse_stress_level_name(const char* name, stress_level_params& out);
+
+// Canonical name of params ("city/100000/1"), accepted by parse_stress_level_name
+std::string stress_level_name(const stress_level_params& params);
+
+const char* stress_layout_name(stress_layout layout);
+
+} // namespace app
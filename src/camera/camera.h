@@ -30,6 +30,9 @@ class camera {
     /// Get current camera eye position in world space
     const glm::vec3& get_position() const { return eye_pos; }
 
+    /// Get current camera look-at target in world space
+    const glm::vec3& get_target() const { return center; }
+
     /// Get current field of view in degrees
     float get_fov() const { return fov_degrees; }
 
@@ -1,4 +1,5 @@
 #include "camera/camera_follow.h"
+#include "foundation/collision_query.h"
 #include "foundation/math_utils.h"
 #include "foundation/debug_assert.h"
 #include <algorithm>
@@ -66,6 +67,24 @@ glm::vec3 camera_follow::compute_eye_position(const glm::vec3& target_position)
     return result;
 }
 
+glm::vec3 camera_follow::resolve_occlusion(const glm::vec3& look_target, const glm::vec3& eye,
+                                           const collision_world& world) const {
+    glm::vec3 offset = eye - look_target;
+    float eye_distance = glm::length(offset);
+    if (!avoid_occlusion || eye_distance <= 0.0f) {
+        return eye;
+    }
+
+    // A look target already inside geometry casts outward freely (sphere casts ignore
+    // boxes they start in unless moving deeper), so the camera behaves as before there
+    ray view{look_target, offset / eye_distance, eye_distance};
+    cast_hit hit = sphere_cast(world, view, collision_radius);
+    if (!hit.hit) {
+        return eye;
+    }
+    return look_target + view.direction * hit.distance;
+}
+
 glm::vec3 camera_follow::compute_look_target(const glm::vec3& target_position) const {
     FL_PRECONDITION(std::isfinite(target_position.x) && std::isfinite(target_position.y) &&
                         std::isfinite(target_position.z),
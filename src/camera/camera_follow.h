@@ -3,6 +3,8 @@
 #include "foundation/param_meta.h"
 #include <glm/glm.hpp>
 
+struct collision_world;
+
 enum class camera_mode { FREE_ORBIT, LOCK_TO_ORIENTATION };
 
 /// Follow camera component - maintains spherical offset from target
@@ -24,6 +26,11 @@ struct camera_follow {
     float orbit_sensitivity = 0.5f; // degrees per pixel
     float zoom_sensitivity = 0.5f;  // distance per scroll unit
 
+    // Occlusion (opt-in): pull the eye in front of world geometry between it and the look
+    // target. Costs one sphere cast per update when enabled.
+    bool avoid_occlusion = false;
+    float collision_radius = 0.2f; // meters (keeps the near plane out of walls)
+
     // Parameter metadata for GUI presentation
     static inline param_meta make_distance_meta(float min, float max) {
         // GUI requires strict inequality, but runtime allows min == max
@@ -59,6 +66,15 @@ struct camera_follow {
     /// @return Look-at target in world space
     glm::vec3 compute_look_target(const glm::vec3& target_position) const;
 
+    /// Move an eye position toward the look target until no geometry blocks the view
+    /// (sphere cast of collision_radius from target to eye)
+    /// @param look_target Point the camera looks at
+    /// @param eye Desired eye position
+    /// @param world Geometry that can occlude the view
+    /// @return Unobstructed eye position (eye unchanged when the view is clear)
+    glm::vec3 resolve_occlusion(const glm::vec3& look_target, const glm::vec3& eye,
+                                const collision_world& world) const;
+
     /// Compute camera eye position locked behind a direction vector
     /// @param target_position Target world position to follow
     /// @param forward_dir Direction to lock behind (will be normalized)
@@ -2,6 +2,11 @@
 
 #include "foundation/collision_primitives.h"
 #include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class job_system;
 
 struct sphere_collision {
     bool hit = false;
@@ -19,7 +24,93 @@ struct sphere_collision {
     bool is_wall = false;
 };
 
+// Per-body temporal cache of nearby boxes (the `cache` argument of resolve_collisions and
+// move_and_slide). A body resting on or sliding along the same few boxes tick after tick
+// reuses the candidate set gathered for an expanded region around an earlier move, skipping
+// the world query and full-world passes while its moves stay inside that region. Leaving
+// the region, a different world, or build_broadphase refreshes it. Dynamic boxes are never
+// cached (they are queried every resolve). Results are identical with or without a cache.
+// Not shared between threads.
+struct contact_cache {
+    // Statistics (cumulative until reset_stats)
+    uint64_t lookups = 0;     // resolves that consulted the cache
+    uint64_t region_hits = 0; // served from cached candidates (no world query)
+    uint64_t overflows = 0;   // region too crowded to cache; resolved uncached
+
+    float hit_rate() const {
+        return lookups > 0 ? static_cast<float>(region_hits) / static_cast<float>(lookups)
+                           : 0.0f;
+    }
+    void reset_stats() { lookups = region_hits = overflows = 0; }
+    void invalidate() { world = nullptr; }
+
+    // Cached region (maintained by the collision system)
+    static constexpr size_t CAPACITY = 64;
+    const collision_world* world = nullptr;
+    uint64_t revision = 0;
+    size_t box_count = 0;
+    glm::vec3 region_min{0.0f};
+    glm::vec3 region_max{0.0f};
+    uint32_t candidates[CAPACITY]; // world-order indices of boxes overlapping the region
+    size_t candidate_count = 0;
+};
+
+// Build the broadphase BVH and SoA bounds over world.boxes (call after adding/moving boxes)
+void build_broadphase(collision_world& world);
+
+// Give the world a new revision (build_broadphase does this). Call after filling boxes and
+// broadphase some other way, e.g. borrowing them from a level file, so contact caches refill.
+void refresh_world_revision(collision_world& world);
+
+// Dynamic boxes: O(1) add/move/remove in world.dynamic_grid, queried alongside the static
+// boxes by resolve_collisions, sweep_sphere and move_and_slide (not by collision_query casts).
+// Ids of removed boxes are reused. Not thread-safe against concurrent resolves.
+uint32_t add_dynamic_box(collision_world& world, const collision_box& box);
+void move_dynamic_box(collision_world& world, uint32_t id, const aabb& bounds);
+void remove_dynamic_box(collision_world& world, uint32_t id);
+
+// Reads the world only, so any number of threads may resolve against one world at once
+// (each with its own cache, if any)
 sphere_collision resolve_collisions(sphere&, const collision_world&, glm::vec3&, glm::vec3&,
-                                    float wall_threshold);
+                                    float wall_threshold, contact_cache* cache = nullptr);
+
+// One independent sphere for resolve_collisions_batch (in/out like resolve_collisions)
+struct sphere_query {
+    sphere collision_sphere;
+    glm::vec3 position{0.0f};
+    glm::vec3 velocity{0.0f};
+};
+
+// resolve_collisions for every query; contacts[i] belongs to queries[i]. With `jobs`, queries
+// are spread across threads; results are identical either way.
+void resolve_collisions_batch(std::vector<sphere_query>& queries, const collision_world& world,
+                              float wall_threshold, std::vector<sphere_collision>& contacts,
+                              job_system* jobs = nullptr);
 
 sphere_collision resolve_sphere_aabb(const sphere& s, const aabb& box);
+
+// First contact of a sphere moving along a displacement (continuous collision)
+struct sphere_sweep_hit {
+    bool hit = false;
+    float time = 1.0f;      // fraction of the displacement travelled at first contact [0, 1]
+    glm::vec3 normal{0.0f}; // surface normal at contact (points from box toward sphere)
+    const aabb* contact_box = nullptr;
+};
+
+// Time of impact of `s` moving by `displacement` against a box: the exact Minkowski sum (box
+// grown by the radius with rounded edges and corners), so fast spheres cannot skip thin boxes.
+// A sphere already touching the box hits at time 0 only if it is moving into it.
+sphere_sweep_hit sweep_sphere_aabb(const sphere& s, const glm::vec3& displacement,
+                                   const aabb& box);
+
+// Earliest sweep_sphere_aabb hit over the world (broadphase over the swept bounds)
+sphere_sweep_hit sweep_sphere(const sphere& s, const glm::vec3& displacement,
+                              const collision_world& world);
+
+// Continuous alternative to resolve_collisions (same in/out contract): sweeps from the last
+// resolved position (collision_sphere.center) to `position`, stopping at each first contact
+// and sliding the rest of the move along the surface, then settles any residual overlap with
+// the discrete resolver. Thin walls stay solid at any dt.
+sphere_collision move_and_slide(sphere&, const collision_world&, glm::vec3& position,
+                                glm::vec3& velocity, float wall_threshold,
+                                contact_cache* cache = nullptr);
@@ -0,0 +1,64 @@
+#pragma once
+#include "foundation/mapped_array.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Bounding volume hierarchy over collision box bounds (static broadphase)
+//
+// Built once per level with a binned surface area heuristic (SAH). Nodes are stored in a
+// flat depth-first array; the two children of an interior node are adjacent so a node
+// needs only one child index. Each node is 32 bytes (two per cache line).
+
+struct bvh_node {
+    glm::vec3 bounds_min{0.0f};
+    uint32_t first = 0; // interior: index of left child (right = first + 1); leaf: first item
+    glm::vec3 bounds_max{0.0f};
+    uint32_t count = 0; // number of items in leaf (0 = interior node)
+
+    bool is_leaf() const { return count > 0; }
+};
+
+static_assert(sizeof(bvh_node) == 32, "bvh_node must stay 32 bytes (two per cache line)");
+
+// Deepest node build_bvh creates (root = 0); pathological inputs become larger leaves instead.
+// Traversal stacks are sized for it, so a prebuilt tree from a file must not exceed it.
+constexpr int BVH_MAX_DEPTH = 48;
+
+struct collision_bvh {
+    // Arrays may be borrowed from a loaded level file (prebuilt BVH used in place)
+    foundation::mapped_array<bvh_node> nodes;
+    foundation::mapped_array<uint32_t> item_indices; // leaf order → source box index
+
+    // Item bounds copied in leaf order so leaf tests read contiguous memory
+    foundation::mapped_array<glm::vec3> item_min;
+    foundation::mapped_array<glm::vec3> item_max;
+
+    // Source box count at build time; a mismatch means the BVH is stale
+    size_t source_count = 0;
+
+    bool empty() const { return nodes.empty(); }
+};
+
+// Build from per-box bounds (parallel min/max arrays of equal length)
+void build_bvh(collision_bvh& bvh, const std::vector<glm::vec3>& bounds_min,
+               const std::vector<glm::vec3>& bounds_max);
+
+// Collect indices of all items whose bounds overlap [query_min, query_max]
+// Writes at most `capacity` indices (in traversal order) to `out`.
+// Returns the total number of overlapping items, which may exceed `capacity`.
+size_t query_bvh(const collision_bvh& bvh, const glm::vec3& query_min,
+                 const glm::vec3& query_max, uint32_t* out, size_t capacity);
+
+// Segment visitor for traverse_bvh_segment: test the item (source box index) and return the
+// distance to clip the segment to (t_max unchanged on a miss)
+using bvh_segment_visitor = float (*)(void* context, uint32_t item, float t_max);
+
+// Visit every item whose bounds, grown by `inflate` on each side, the segment
+// origin + direction * t (t in [0, t_max]) passes through. Nearer children are visited first
+// and anything beyond the clipped t_max is skipped, so closest-hit queries touch few leaves.
+// Returns the final t_max.
+float traverse_bvh_segment(const collision_bvh& bvh, const glm::vec3& origin,
+                           const glm::vec3& direction, float t_max, float inflate,
+                           bvh_segment_visitor visit, void* context);
@@ -0,0 +1,213 @@
+#include "foundation/collision_grid.h"
+#include "foundation/debug_assert.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace {
+
+// Bucket table stays at least twice the item count (short lists) and never below this
+constexpr size_t MIN_BUCKETS = 64;
+
+// Large primes from Teschner et al., "Optimized Spatial Hashing for Collision Detection of
+// Deformable Objects" (2003)
+uint32_t hash_cell(const int32_t cell[3], size_t bucket_count) {
+    uint32_t h = (static_cast<uint32_t>(cell[0]) * 73856093u) ^
+                 (static_cast<uint32_t>(cell[1]) * 19349663u) ^
+                 (static_cast<uint32_t>(cell[2]) * 83492791u);
+    return h & static_cast<uint32_t>(bucket_count - 1);
+}
+
+int32_t cell_coordinate(float position, float cell_size) {
+    return static_cast<int32_t>(std::floor(position / cell_size));
+}
+
+void compute_cell(const collision_grid& grid, const glm::vec3& bounds_min,
+                  const glm::vec3& bounds_max, int32_t cell[3]) {
+    glm::vec3 center = (bounds_min + bounds_max) * 0.5f;
+    for (int axis = 0; axis < 3; ++axis) {
+        cell[axis] = cell_coordinate(center[axis], grid.cell_size);
+    }
+}
+
+bool same_cell(const int32_t a[3], const int32_t b[3]) {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+void link(collision_grid& grid, uint32_t id) {
+    grid_item& item = grid.items[id];
+    item.bucket = hash_cell(item.cell, grid.buckets.size());
+    item.prev = GRID_NONE;
+    item.next = grid.buckets[item.bucket];
+    if (item.next != GRID_NONE) {
+        grid.items[item.next].prev = id;
+    }
+    grid.buckets[item.bucket] = id;
+}
+
+void unlink(collision_grid& grid, uint32_t id) {
+    grid_item& item = grid.items[id];
+    if (item.prev != GRID_NONE) {
+        grid.items[item.prev].next = item.next;
+    } else {
+        grid.buckets[item.bucket] = item.next;
+    }
+    if (item.next != GRID_NONE) {
+        grid.items[item.next].prev = item.prev;
+    }
+}
+
+// Grow the bucket table and relink every live item (amortized O(1) per insert)
+void rehash(collision_grid& grid, size_t bucket_count) {
+    grid.buckets.assign(bucket_count, GRID_NONE);
+    for (uint32_t id = 0; id < grid.items.size(); ++id) {
+        if (grid.items[id].bucket != GRID_NONE) {
+            link(grid, id);
+        }
+    }
+}
+
+void validate_bounds(const glm::vec3& bounds_min, const glm::vec3& bounds_max) {
+    FL_ASSERT_FINITE(bounds_min, "grid item bounds_min");
+    FL_ASSERT_FINITE(bounds_max, "grid item bounds_max");
+    FL_PRECONDITION(!glm::any(glm::greaterThan(bounds_min, bounds_max)),
+                    "grid item bounds must be ordered");
+}
+
+bool overlaps(const grid_item& item, const glm::vec3& query_min, const glm::vec3& query_max) {
+    return !glm::any(glm::greaterThan(item.bounds_min, query_max)) &&
+           !glm::any(glm::lessThan(item.bounds_max, query_min));
+}
+
+} // namespace
+
+uint32_t grid_insert(collision_grid& grid, const glm::vec3& bounds_min,
+                     const glm::vec3& bounds_max) {
+    validate_bounds(bounds_min, bounds_max);
+    FL_PRECONDITION(grid.cell_size > 0.0f, "grid cell_size must be positive");
+
+    uint32_t id = grid.free_head;
+    if (id != GRID_NONE) {
+        grid.free_head = grid.items[id].next;
+    } else {
+        FL_PRECONDITION(grid.items.size() < GRID_NONE, "grid item ids exhausted");
+        id = static_cast<uint32_t>(grid.items.size());
+        grid.items.emplace_back();
+    }
+    grid.live_count++;
+
+    size_t wanted = std::max(MIN_BUCKETS, std::bit_ceil(grid.live_count * 2));
+    if (grid.buckets.size() < wanted) {
+        rehash(grid, wanted);
+    }
+
+    grid_item& item = grid.items[id];
+    item.bounds_min = bounds_min;
+    item.bounds_max = bounds_max;
+    compute_cell(grid, bounds_min, bounds_max, item.cell);
+    grid.max_half_extents = glm::max(grid.max_half_extents, (bounds_max - bounds_min) * 0.5f);
+    link(grid, id);
+    return id;
+}
+
+void grid_move(collision_grid& grid, uint32_t id, const glm::vec3& bounds_min,
+               const glm::vec3& bounds_max) {
+    FL_PRECONDITION(grid.contains(id), "grid_move on a removed or unknown id");
+    validate_bounds(bounds_min, bounds_max);
+
+    grid_item& item = grid.items[id];
+    item.bounds_min = bounds_min;
+    item.bounds_max = bounds_max;
+    grid.max_half_extents = glm::max(grid.max_half_extents, (bounds_max - bounds_min) * 0.5f);
+
+    int32_t cell[3];
+    compute_cell(grid, bounds_min, bounds_max, cell);
+    if (same_cell(cell, item.cell)) {
+        return; // Common case: small per-tick moves stay in the cell
+    }
+    unlink(grid, id);
+    std::copy(cell, cell + 3, item.cell);
+    link(grid, id);
+}
+
+void grid_remove(collision_grid& grid, uint32_t id) {
+    FL_PRECONDITION(grid.contains(id), "grid_remove on a removed or unknown id");
+    unlink(grid, id);
+    grid_item& item = grid.items[id];
+    item.bucket = GRID_NONE;
+    item.prev = GRID_NONE;
+    item.next = grid.free_head;
+    grid.free_head = id;
+    grid.live_count--;
+    if (grid.live_count == 0) {
+        grid.max_half_extents = glm::vec3(0.0f);
+    }
+}
+
+void grid_clear(collision_grid& grid) {
+    grid.items.clear();
+    std::fill(grid.buckets.begin(), grid.buckets.end(), GRID_NONE);
+    grid.free_head = GRID_NONE;
+    grid.live_count = 0;
+    grid.max_half_extents = glm::vec3(0.0f);
+}
+
+size_t query_grid(const collision_grid& grid, const glm::vec3& query_min,
+                  const glm::vec3& query_max, uint32_t* out, size_t capacity) {
+    if (grid.live_count == 0) {
+        return 0;
+    }
+
+    // Centers of overlapping items lie within the query grown by the largest half extent
+    int32_t cell_min[3];
+    int32_t cell_max[3];
+    double cell_count = 1.0;
+    for (int axis = 0; axis < 3; ++axis) {
+        cell_min[axis] =
+            cell_coordinate(query_min[axis] - grid.max_half_extents[axis], grid.cell_size);
+        cell_max[axis] =
+            cell_coordinate(query_max[axis] + grid.max_half_extents[axis], grid.cell_size);
+        cell_count *= static_cast<double>(cell_max[axis]) - cell_min[axis] + 1.0;
+    }
+
+    size_t count = 0;
+    auto emit = [&](uint32_t id) {
+        if (count < capacity) {
+            out[count] = id;
+        }
+        count++;
+    };
+
+    // Queries spanning more cells than there are items are cheaper as a scan (already in
+    // id order)
+    if (cell_count > static_cast<double>(grid.items.size())) {
+        for (uint32_t id = 0; id < grid.items.size(); ++id) {
+            const grid_item& item = grid.items[id];
+            if (item.bucket != GRID_NONE && overlaps(item, query_min, query_max)) {
+                emit(id);
+            }
+        }
+        return count;
+    }
+
+    int32_t cell[3];
+    for (cell[0] = cell_min[0]; cell[0] <= cell_max[0]; ++cell[0]) {
+        for (cell[1] = cell_min[1]; cell[1] <= cell_max[1]; ++cell[1]) {
+            for (cell[2] = cell_min[2]; cell[2] <= cell_max[2]; ++cell[2]) {
+                // Only items of this exact cell: cells sharing the bucket are visited (and
+                // report their items) on their own iteration
+                uint32_t id = grid.buckets[hash_cell(cell, grid.buckets.size())];
+                while (id != GRID_NONE) {
+                    const grid_item& item = grid.items[id];
+                    if (same_cell(item.cell, cell) && overlaps(item, query_min, query_max)) {
+                        emit(id);
+                    }
+                    id = item.next;
+                }
+            }
+        }
+    }
+
+    std::sort(out, out + std::min(count, capacity));
+    return count;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Uniform spatial hash grid over moving box bounds (dynamic broadphase)
+//
+// Loose grid: each item lives in the one cell holding its center, and queries widen by the
+// largest half extent seen, so moving an item touches at most two bucket lists and never
+// depends on its size. Cells hash into a power-of-two bucket table (several cells may share
+// a bucket); buckets are intrusive doubly-linked lists through the item array, so insert,
+// move and remove are O(1) and never allocate once the arrays have grown.
+
+constexpr uint32_t GRID_NONE = ~0u;
+
+struct grid_item {
+    glm::vec3 bounds_min{0.0f};
+    uint32_t prev = GRID_NONE; // bucket list links; `next` doubles as the free-list link
+    glm::vec3 bounds_max{0.0f};
+    uint32_t next = GRID_NONE;
+    int32_t cell[3] = {0, 0, 0};
+    uint32_t bucket = GRID_NONE; // GRID_NONE = free slot
+};
+
+struct collision_grid {
+    // TUNED: About the size of the boxes it holds (a few cells per query); set before the
+    // first insert
+    float cell_size = 4.0f; // meters
+
+    std::vector<grid_item> items;  // indexed by id (removed ids are reused, latest first)
+    std::vector<uint32_t> buckets; // head item per bucket (size is a power of two)
+    uint32_t free_head = GRID_NONE;
+    size_t live_count = 0;
+
+    // Largest half extent per axis inserted since the grid was last empty (queries widen by
+    // it so items overlapping from a neighbouring cell are found)
+    glm::vec3 max_half_extents{0.0f};
+
+    size_t size() const { return live_count; }
+    bool empty() const { return live_count == 0; }
+    bool contains(uint32_t id) const {
+        return id < items.size() && items[id].bucket != GRID_NONE;
+    }
+};
+
+// Add an item and return its id (ids of removed items are reused)
+uint32_t grid_insert(collision_grid& grid, const glm::vec3& bounds_min,
+                     const glm::vec3& bounds_max);
+
+// Update an item's bounds (relinks it only when its center changes cell)
+void grid_move(collision_grid& grid, uint32_t id, const glm::vec3& bounds_min,
+               const glm::vec3& bounds_max);
+
+void grid_remove(collision_grid& grid, uint32_t id);
+
+// Remove every item (keeps cell_size and allocated storage)
+void grid_clear(collision_grid& grid);
+
+// Collect ids of all items whose bounds overlap [query_min, query_max] (touching counts)
+// Writes at most `capacity` ids to `out`, sorted ascending when all of them fit.
+// Returns the total number of overlapping items, which may exceed `capacity`.
+size_t query_grid(const collision_grid& grid, const glm::vec3& query_min,
+                  const glm::vec3& query_max, uint32_t* out, size_t capacity);
@@ -1,5 +1,10 @@
 #pragma once
+#include "foundation/collision_bvh.h"
+#include "foundation/collision_grid.h"
+#include "foundation/collision_soa.h"
+#include "foundation/mapped_array.h"
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <vector>
 
 struct sphere {
@@ -12,7 +17,7 @@ enum class collision_surface_type {
     FLOOR,    // Supports standing, slope walking
     WALL,     // Blocks horizontal movement, enables wall-slide
     PLATFORM, // One-way passthrough from below
-    DYNAMIC   // Movable objects (future)
+    DYNAMIC   // Movable objects (collision_world::dynamic_boxes)
 };
 
 struct aabb {
@@ -26,5 +31,24 @@ struct collision_box {
 };
 
 struct collision_world {
-    std::vector<collision_box> boxes;
+    // Static boxes (owned, or borrowed from a loaded level file; see mapped_array)
+    foundation::mapped_array<collision_box> boxes;
+
+    // Broadphase over boxes (rebuild with build_broadphase after editing boxes)
+    // Empty until built; resolution falls back to testing every box
+    collision_bvh bvh;
+
+    // Structure-of-arrays bounds for batch rejection on the exhaustive path (same lifetime
+    // as bvh). Empty until built; resolution then tests boxes one at a time.
+    collision_soa soa;
+
+    // Unique per build_broadphase call (0 = never built); contact caches compare it to tell
+    // a rebuilt or different world from the one they cached
+    uint64_t revision = 0;
+
+    // Moving obstacles, indexed by id (add/move/remove_dynamic_box keep them and the grid in
+    // step; slots of removed boxes are stale until reused). Resolved after the static boxes,
+    // never cached, and edited without any rebuild.
+    std::vector<collision_box> dynamic_boxes;
+    collision_grid dynamic_grid;
 };
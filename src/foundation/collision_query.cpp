@@ -0,0 +1,201 @@
+#include "foundation/collision_query.h"
+#include "foundation/collision.h"
+#include "foundation/debug_assert.h"
+#include "foundation/profiler.h"
+#include "foundation/job_system.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// A query is a BVH descent plus a few box tests (a few hundred ns)
+constexpr size_t QUERY_GRAIN = 64;
+
+// BVH culling computes slab distances with a reciprocal, the box tests with a division; the
+// slack keeps grazing hits from being culled by rounding (BVH and linear results must agree)
+constexpr float CULL_SLACK = 1e-4f; // meters
+
+bool bvh_current(const collision_world& world) {
+    FL_ASSERT(world.bvh.empty() || world.bvh.source_count == world.boxes.size(),
+              "collision BVH is stale (call build_broadphase after editing boxes)");
+    return !world.bvh.empty() && world.bvh.source_count == world.boxes.size();
+}
+
+void validate_ray(const ray& r) {
+    FL_ASSERT_FINITE(r.origin, "ray origin");
+    FL_ASSERT_NORMALIZED(r.direction, "ray direction");
+    FL_PRECONDITION(r.max_distance >= 0.0f && std::isfinite(r.max_distance),
+                    "ray max_distance must be non-negative and finite");
+}
+
+// Keep the nearer hit; equal distances go to the lower box index so BVH and linear
+// traversal (which visit boxes in different orders) agree exactly
+void keep_closest(cast_hit& best, const cast_hit& candidate) {
+    if (!candidate.hit) {
+        return;
+    }
+    if (!best.hit || candidate.distance < best.distance ||
+        (candidate.distance == best.distance && candidate.box_index < best.box_index)) {
+        best = candidate;
+    }
+}
+
+cast_hit raycast_box(const ray& r, const collision_world& world, uint32_t index) {
+    cast_hit result;
+    const aabb& box = world.boxes[index].bounds;
+    const glm::vec3 box_min = box.center - box.half_extents;
+    const glm::vec3 box_max = box.center + box.half_extents;
+
+    // Slab test, tracking which axis the ray enters through for the normal
+    float t_enter = 0.0f;
+    float t_exit = r.max_distance;
+    int enter_axis = -1;
+    for (int axis = 0; axis < 3; ++axis) {
+        float origin = r.origin[axis];
+        float direction = r.direction[axis];
+        if (direction == 0.0f) {
+            if (origin < box_min[axis] || origin > box_max[axis]) {
+                return result;
+            }
+            continue;
+        }
+        float t0 = (box_min[axis] - origin) / direction;
+        float t1 = (box_max[axis] - origin) / direction;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        if (t0 > t_enter) {
+            t_enter = t0;
+            enter_axis = axis;
+        }
+        t_exit = std::min(t_exit, t1);
+        if (t_enter > t_exit) {
+            return result;
+        }
+    }
+
+    result.hit = true;
+    result.distance = t_enter;
+    result.point = r.origin + r.direction * t_enter;
+    result.box_index = index;
+    if (enter_axis >= 0) {
+        result.normal[enter_axis] = r.direction[enter_axis] > 0.0f ? -1.0f : 1.0f;
+    } else {
+        result.normal = -r.direction; // started inside
+    }
+    return result;
+}
+
+cast_hit sphere_cast_box(const ray& r, float radius, const collision_world& world,
+                         uint32_t index) {
+    cast_hit result;
+    const aabb& box = world.boxes[index].bounds;
+    sphere_sweep_hit sweep =
+        sweep_sphere_aabb(sphere{r.origin, radius}, r.direction * r.max_distance, box);
+    if (!sweep.hit) {
+        return result;
+    }
+
+    glm::vec3 center = r.origin + r.direction * (r.max_distance * sweep.time);
+    result.hit = true;
+    result.distance = r.max_distance * sweep.time;
+    result.point =
+        glm::clamp(center, box.center - box.half_extents, box.center + box.half_extents);
+    result.normal = sweep.normal;
+    result.box_index = index;
+    return result;
+}
+
+struct cast_context {
+    const collision_world* world;
+    const ray* r;
+    float radius; // < 0: raycast
+    cast_hit best;
+};
+
+float visit_cast(void* context, uint32_t item, float t_max) {
+    auto& query = *static_cast<cast_context*>(context);
+    cast_hit hit = query.radius < 0.0f
+                       ? raycast_box(*query.r, *query.world, item)
+                       : sphere_cast_box(*query.r, query.radius, *query.world, item);
+    keep_closest(query.best, hit);
+    // Clip to the best hit so far; ties at that distance still reach the visitor
+    return query.best.hit ? std::min(t_max, query.best.distance) : t_max;
+}
+
+cast_hit cast(const collision_world& world, const ray& r, float radius) {
+    cast_context context{&world, &r, radius, {}};
+    if (bvh_current(world)) {
+        traverse_bvh_segment(world.bvh, r.origin, r.direction, r.max_distance,
+                             std::max(radius, 0.0f) + CULL_SLACK, &visit_cast, &context);
+        return context.best;
+    }
+    for (size_t i = 0; i < world.boxes.size(); ++i) {
+        visit_cast(&context, static_cast<uint32_t>(i), r.max_distance);
+    }
+    return context.best;
+}
+
+} // namespace
+
+cast_hit raycast(const collision_world& world, const ray& r) {
+    validate_ray(r);
+    return cast(world, r, -1.0f);
+}
+
+cast_hit sphere_cast(const collision_world& world, const ray& r, float radius) {
+    validate_ray(r);
+    FL_PRECONDITION(radius >= 0.0f && std::isfinite(radius),
+                    "sphere_cast radius must be non-negative and finite");
+    return cast(world, r, radius);
+}
+
+size_t overlap_aabb(const collision_world& world, const glm::vec3& query_min,
+                    const glm::vec3& query_max, std::span<uint32_t> out) {
+    FL_PRECONDITION(!glm::any(glm::greaterThan(query_min, query_max)),
+                    "overlap_aabb bounds must be ordered");
+    if (bvh_current(world)) {
+        // BVH traversal order depends on the tree; sort so both paths return ascending indices
+        size_t count = query_bvh(world.bvh, query_min, query_max, out.data(), out.size());
+        std::sort(out.data(), out.data() + std::min(count, out.size()));
+        return count;
+    }
+
+    size_t found = 0;
+    for (size_t i = 0; i < world.boxes.size(); ++i) {
+        const aabb& box = world.boxes[i].bounds;
+        if (glm::any(glm::greaterThan(box.center - box.half_extents, query_max)) ||
+            glm::any(glm::lessThan(box.center + box.half_extents, query_min))) {
+            continue;
+        }
+        if (found < out.size()) {
+            out[found] = static_cast<uint32_t>(i);
+        }
+        found++;
+    }
+    return found;
+}
+
+void raycast_batch(const collision_world& world, std::span<const ray> rays,
+                   std::span<cast_hit> hits, job_system* jobs) {
+    FL_PROFILE_ZONE("raycast_batch");
+    FL_PRECONDITION(hits.size() >= rays.size(), "raycast_batch needs one hit slot per ray");
+
+    parallel_for(jobs, rays.size(), QUERY_GRAIN, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            hits[i] = raycast(world, rays[i]);
+        }
+    });
+}
+
+void sphere_cast_batch(const collision_world& world, std::span<const ray> rays, float radius,
+                       std::span<cast_hit> hits, job_system* jobs) {
+    FL_PROFILE_ZONE("sphere_cast_batch");
+    FL_PRECONDITION(hits.size() >= rays.size(), "sphere_cast_batch needs one hit slot per ray");
+
+    parallel_for(jobs, rays.size(), QUERY_GRAIN, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            hits[i] = sphere_cast(world, rays[i], radius);
+        }
+    });
+}
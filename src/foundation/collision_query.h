@@ -0,0 +1,51 @@
+#pragma once
+#include "foundation/collision_primitives.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Ray, sphere-cast and overlap queries over a collision_world
+//
+// Read-only and allocation-free: results go to caller-provided spans, so camera placement,
+// ground probes and AI sensors can query any number of times per tick from any thread.
+// Queries traverse the world's BVH when it is current (build_broadphase) and test every box
+// otherwise; both give identical results (ties go to the lowest box index).
+
+class job_system;
+
+struct ray {
+    glm::vec3 origin{0.0f};
+    glm::vec3 direction{0.0f, 0.0f, 1.0f}; // normalized
+    float max_distance = 0.0f;             // meters
+};
+
+struct cast_hit {
+    bool hit = false;
+    float distance = 0.0f;  // meters along the ray (sphere casts: distance the center moved)
+    glm::vec3 point{0.0f};  // contact point on the box surface
+    glm::vec3 normal{0.0f}; // box surface normal at the contact (faces the caster)
+    uint32_t box_index = 0; // into collision_world::boxes
+};
+
+// Closest box the ray hits within max_distance. A ray starting inside a box hits it at
+// distance 0 with the normal facing back along the ray.
+cast_hit raycast(const collision_world& world, const ray& r);
+
+// Closest box a sphere of `radius` touches while its center moves along the ray. A sphere
+// already touching a box only hits it (at distance 0) when moving into it, as in
+// sweep_sphere_aabb.
+cast_hit sphere_cast(const collision_world& world, const ray& r, float radius);
+
+// Indices of boxes whose bounds overlap [query_min, query_max] (touching counts). Writes at
+// most out.size() indices, in ascending order, and returns the total overlap count, which
+// may be larger. When truncated, which overlaps are written depends on the broadphase.
+size_t overlap_aabb(const collision_world& world, const glm::vec3& query_min,
+                    const glm::vec3& query_max, std::span<uint32_t> out);
+
+// One query per ray; hits[i] belongs to rays[i] (hits needs at least rays.size() entries).
+// With `jobs`, rays are spread across threads; results are identical either way.
+void raycast_batch(const collision_world& world, std::span<const ray> rays,
+                   std::span<cast_hit> hits, job_system* jobs = nullptr);
+void sphere_cast_batch(const collision_world& world, std::span<const ray> rays, float radius,
+                       std::span<cast_hit> hits, job_system* jobs = nullptr);
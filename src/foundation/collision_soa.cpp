@@ -0,0 +1,146 @@
+#include "foundation/collision_soa.h"
+#include "foundation/debug_assert.h"
+#include <algorithm>
+#include <cfloat>
+
+// The AVX2 kernel is compiled for its own function only (target attribute; MSVC accepts the
+// intrinsics without /arch), so nothing else in the build can emit AVX2 instructions, and it
+// runs only when the CPU reports AVX2
+#if FROGLORDS_AVX2 && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64))
+#define FL_SOA_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define FL_TARGET_AVX2
+#else
+#define FL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define FL_SOA_AVX2 0
+#endif
+
+#if FL_SOA_AVX2
+
+namespace {
+
+bool cpu_has_avx2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    // AVX state must also be enabled by the OS (OSXSAVE, and XCR0 saving XMM and YMM)
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// Read once at startup; false (scalar) for anything that runs before it is initialized
+const bool AVX2_SUPPORTED = cpu_has_avx2();
+
+FL_TARGET_AVX2 uint32_t sphere_overlap_mask_avx2(const collision_soa& soa, size_t first,
+                                                 const glm::vec3& center, float radius) {
+    __m256 cx = _mm256_set1_ps(center.x);
+    __m256 cy = _mm256_set1_ps(center.y);
+    __m256 cz = _mm256_set1_ps(center.z);
+
+    // Closest point on each box: max(min, min(center, max))
+    __m256 px = _mm256_max_ps(_mm256_loadu_ps(&soa.min_x[first]),
+                              _mm256_min_ps(cx, _mm256_loadu_ps(&soa.max_x[first])));
+    __m256 py = _mm256_max_ps(_mm256_loadu_ps(&soa.min_y[first]),
+                              _mm256_min_ps(cy, _mm256_loadu_ps(&soa.max_y[first])));
+    __m256 pz = _mm256_max_ps(_mm256_loadu_ps(&soa.min_z[first]),
+                              _mm256_min_ps(cz, _mm256_loadu_ps(&soa.max_z[first])));
+
+    __m256 dx = _mm256_sub_ps(cx, px);
+    __m256 dy = _mm256_sub_ps(cy, py);
+    __m256 dz = _mm256_sub_ps(cz, pz);
+
+    // Separate mul/add (no FMA) keeps rounding identical to the scalar path
+    __m256 distance_squared = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+
+    __m256 hit = _mm256_cmp_ps(distance_squared, _mm256_set1_ps(radius * radius), _CMP_LT_OQ);
+    return static_cast<uint32_t>(_mm256_movemask_ps(hit));
+}
+
+} // namespace
+
+#endif
+
+void build_collision_soa(collision_soa& soa, const std::vector<glm::vec3>& bounds_min,
+                         const std::vector<glm::vec3>& bounds_max) {
+    FL_PRECONDITION(bounds_min.size() == bounds_max.size(),
+                    "bounds_min and bounds_max must have equal length");
+
+    size_t count = bounds_min.size();
+    size_t padded = (count + SOA_LANES - 1) / SOA_LANES * SOA_LANES;
+
+    // Padding lanes are inverted (empty) boxes: the closest point clamps to ±FLT_MAX,
+    // so the squared distance overflows to +inf and never passes the radius test
+    soa.min_x.assign(padded, FLT_MAX);
+    soa.min_y.assign(padded, FLT_MAX);
+    soa.min_z.assign(padded, FLT_MAX);
+    soa.max_x.assign(padded, -FLT_MAX);
+    soa.max_y.assign(padded, -FLT_MAX);
+    soa.max_z.assign(padded, -FLT_MAX);
+    soa.source_count = count;
+
+    for (size_t i = 0; i < count; ++i) {
+        soa.min_x[i] = bounds_min[i].x;
+        soa.min_y[i] = bounds_min[i].y;
+        soa.min_z[i] = bounds_min[i].z;
+        soa.max_x[i] = bounds_max[i].x;
+        soa.max_y[i] = bounds_max[i].y;
+        soa.max_z[i] = bounds_max[i].z;
+    }
+}
+
+uint32_t sphere_overlap_mask_scalar(const collision_soa& soa, size_t first,
+                                    const glm::vec3& center, float radius) {
+    FL_PRECONDITION(first % SOA_LANES == 0, "first must be lane-aligned");
+    FL_PRECONDITION(first + SOA_LANES <= soa.padded_count(), "block must be in range");
+
+    // Operation order mirrors resolve_sphere_aabb so results match bit-for-bit
+    float radius_squared = radius * radius;
+    uint32_t mask = 0;
+    for (size_t lane = 0; lane < SOA_LANES; ++lane) {
+        size_t i = first + lane;
+        float dx = center.x - std::max(soa.min_x[i], std::min(center.x, soa.max_x[i]));
+        float dy = center.y - std::max(soa.min_y[i], std::min(center.y, soa.max_y[i]));
+        float dz = center.z - std::max(soa.min_z[i], std::min(center.z, soa.max_z[i]));
+        float distance_squared = dx * dx + dy * dy + dz * dz;
+        if (distance_squared < radius_squared) {
+            mask |= 1u << lane;
+        }
+    }
+    return mask;
+}
+
+uint32_t sphere_overlap_mask(const collision_soa& soa, size_t first, const glm::vec3& center,
+                             float radius) {
+#if FL_SOA_AVX2
+    if (AVX2_SUPPORTED) {
+        FL_PRECONDITION(first % SOA_LANES == 0, "first must be lane-aligned");
+        FL_PRECONDITION(first + SOA_LANES <= soa.padded_count(), "block must be in range");
+        return sphere_overlap_mask_avx2(soa, first, center, radius);
+    }
+#endif
+    return sphere_overlap_mask_scalar(soa, first, center, radius);
+}
+
+bool sphere_overlap_uses_avx2() {
+#if FL_SOA_AVX2
+    return AVX2_SUPPORTED;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "foundation/mapped_array.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Structure-of-arrays mirror of collision box bounds for batch sphere rejection
+//
+// Each bound component lives in its own array so eight boxes load with one vector
+// instruction. Arrays are padded to a multiple of SOA_LANES with empty boxes
+// (min = +FLT_MAX, max = -FLT_MAX) that can never overlap a sphere.
+
+constexpr size_t SOA_LANES = 8;
+
+struct collision_soa {
+    // Arrays may be borrowed from a loaded level file (see mapped_array)
+    foundation::mapped_array<float> min_x, min_y, min_z;
+    foundation::mapped_array<float> max_x, max_y, max_z;
+
+    // Source box count at build time (arrays are padded beyond this)
+    size_t source_count = 0;
+
+    size_t padded_count() const { return min_x.size(); }
+    bool empty() const { return min_x.empty(); }
+};
+
+// Build from per-box bounds (parallel min/max arrays of equal length)
+void build_collision_soa(collision_soa& soa, const std::vector<glm::vec3>& bounds_min,
+                         const std::vector<glm::vec3>& bounds_max);
+
+// Overlap mask for the SOA_LANES boxes starting at `first` (must be a multiple of SOA_LANES)
+// Bit i is set when box first + i overlaps the sphere, using the exact test of
+// resolve_sphere_aabb (squared distance to closest point strictly less than radius²).
+// Runs the AVX2 kernel when it is built in (FROGLORDS_AVX2, x86) and the CPU supports it,
+// otherwise the scalar kernel.
+uint32_t sphere_overlap_mask(const collision_soa& soa, size_t first, const glm::vec3& center,
+                             float radius);
+
+// True when sphere_overlap_mask runs the AVX2 kernel on this machine
+bool sphere_overlap_uses_avx2();
+
+// Portable reference kernel (same results as the SIMD path)
+uint32_t sphere_overlap_mask_scalar(const collision_soa& soa, size_t first,
+                                    const glm::vec3& center, float radius);
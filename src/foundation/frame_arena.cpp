@@ -0,0 +1,80 @@
+#include "foundation/frame_arena.h"
+#include "foundation/debug_assert.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace foundation {
+
+namespace {
+
+// First address at or after `base + offset` with the given alignment, as an offset from base
+size_t align_offset(const std::byte* base, size_t offset, size_t alignment) {
+    uintptr_t address = reinterpret_cast<uintptr_t>(base) + offset;
+    uintptr_t aligned = (address + (alignment - 1)) & ~(static_cast<uintptr_t>(alignment) - 1);
+    return offset + static_cast<size_t>(aligned - address);
+}
+
+} // namespace
+
+frame_arena::frame_arena(size_t capacity)
+    : block(std::make_unique_for_overwrite<std::byte[]>(capacity))
+    , capacity(capacity) {
+    FL_PRECONDITION(capacity > 0, "frame_arena needs a non-empty block");
+}
+
+void frame_arena::reset() {
+    size_t used = offset + overflow_bytes;
+    peak = std::max(peak, used);
+
+    // Outgrown: one reallocation now so the following frames fit in a single block
+    if (!overflow.empty()) {
+        capacity = std::bit_ceil(used);
+        block = std::make_unique_for_overwrite<std::byte[]>(capacity);
+        ++grows;
+        overflow.clear();
+    }
+
+    offset = 0;
+    overflow_bytes = 0;
+}
+
+frame_arena_stats frame_arena::stats() const {
+    frame_arena_stats result;
+    result.used = offset + overflow_bytes;
+    result.capacity = capacity;
+    result.peak = std::max(peak, result.used);
+    result.overflow_bytes = overflow_bytes;
+    result.grows = grows;
+    return result;
+}
+
+void* frame_arena::do_allocate(size_t bytes, size_t alignment) {
+    FL_PRECONDITION(std::has_single_bit(alignment), "alignment must be a power of two");
+
+    size_t start = align_offset(block.get(), offset, alignment);
+    if (start + bytes > capacity) {
+        return allocate_overflow(bytes, alignment);
+    }
+    offset = start + bytes;
+    return block.get() + start;
+}
+
+void* frame_arena::allocate_overflow(size_t bytes, size_t alignment) {
+    // Sized for this request only: overflow is the warm-up case, fixed by the next reset
+    size_t size = bytes + alignment;
+    overflow.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+    overflow_bytes += size;
+    std::byte* base = overflow.back().get();
+    return base + align_offset(base, 0, alignment);
+}
+
+void frame_arena::do_deallocate(void*, size_t, size_t) {
+    // Everything is released together by reset()
+}
+
+bool frame_arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+} // namespace foundation
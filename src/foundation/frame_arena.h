@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace foundation {
+
+struct frame_arena_stats {
+    size_t used = 0;           // bytes handed out since the last reset (including padding)
+    size_t capacity = 0;       // main block size
+    size_t peak = 0;           // most bytes used in any one frame
+    size_t overflow_bytes = 0; // bytes in extra blocks this frame (0 once the block has grown)
+    int grows = 0;             // main block reallocations since construction
+};
+
+// Linear allocator for data that lives for one frame
+//
+// Allocation bumps an offset into one contiguous block; nothing is freed individually and
+// reset() releases everything at once. A frame that outgrows the block is served from extra
+// heap blocks, and the next reset() replaces the main block with one large enough for that
+// frame, so after warm-up a frame does no heap allocation at all.
+//
+// Usable directly (allocate_array) or as a std::pmr::memory_resource, so std::pmr containers
+// and strings can live in it. Deallocation is a no-op: containers that grow leave their old
+// buffers behind until reset, so reserve up front where the size is known.
+//
+// Not thread-safe: owned and used by one thread (the main thread's frame). Anything
+// allocated from the arena must be dead before reset().
+class frame_arena : public std::pmr::memory_resource {
+  public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+    explicit frame_arena(size_t capacity = DEFAULT_CAPACITY);
+
+    frame_arena(const frame_arena&) = delete;
+    frame_arena& operator=(const frame_arena&) = delete;
+
+    // Start a new frame: invalidates every allocation, grows the block if the frame overflowed
+    void reset();
+
+    // Uninitialized storage for `count` objects of a trivially destructible type
+    template <typename T>
+    std::span<T> allocate_array(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "the arena never runs destructors");
+        return {static_cast<T*>(allocate(count * sizeof(T), alignof(T))), count};
+    }
+
+    frame_arena_stats stats() const;
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    void* allocate_overflow(size_t bytes, size_t alignment);
+
+    std::unique_ptr<std::byte[]> block;
+    size_t capacity = 0;
+    size_t offset = 0;
+
+    // Extra blocks for the current frame only (freed by reset)
+    std::vector<std::unique_ptr<std::byte[]>> overflow;
+    size_t overflow_bytes = 0;
+
+    size_t peak = 0;
+    int grows = 0;
+};
+
+} // namespace foundation
@@ -0,0 +1,241 @@
+#include "foundation/job_system.h"
+#include "foundation/trace.h"
+#include <string>
+
+namespace {
+
+// Identifies which job_system (if any) the calling thread works for, and its deque
+thread_local const job_system* local_system = nullptr;
+thread_local int local_queue = 0;
+
+// Per-thread steal start so idle threads don't all hammer the same victim
+thread_local uint32_t steal_seed = 0x9e3779b9u;
+
+uint32_t next_steal_seed() {
+    steal_seed ^= steal_seed << 13;
+    steal_seed ^= steal_seed >> 17;
+    steal_seed ^= steal_seed << 5;
+    return steal_seed;
+}
+
+// Spins on an empty queue before a worker goes to sleep (covers the gap between a parallel_for
+// finishing and the next one starting without paying a wake-up)
+constexpr int IDLE_SPINS = 256;
+
+} // namespace
+
+job_graph::node_id job_graph::add(std::function<void()> work) {
+    FL_PRECONDITION(static_cast<bool>(work), "job_graph node needs work");
+    nodes.push_back(node{std::move(work), {}, 0});
+    return static_cast<node_id>(nodes.size() - 1);
+}
+
+void job_graph::precede(node_id before, node_id after) {
+    FL_PRECONDITION(before < nodes.size() && after < nodes.size(), "job_graph node out of range");
+    FL_PRECONDITION(before != after, "job_graph node cannot precede itself");
+    nodes[before].successors.push_back(after);
+    nodes[after].predecessors++;
+}
+
+void job_graph::clear() {
+    nodes.clear();
+}
+
+int job_system::default_worker_threads() {
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    return hardware > 1 ? hardware - 1 : 0;
+}
+
+job_system::job_system(int worker_threads) {
+    FL_PRECONDITION(worker_threads >= 0, "worker_threads must be non-negative");
+
+    for (int i = 0; i <= worker_threads; ++i) {
+        queues.push_back(std::make_unique<worker_queue>());
+    }
+    threads.reserve(static_cast<size_t>(worker_threads));
+    for (int i = 1; i <= worker_threads; ++i) {
+        threads.emplace_back(&job_system::worker_main, this, i);
+    }
+}
+
+job_system::~job_system() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+int job_system::current_queue() const {
+    // Threads outside the system (or the owner) share deque 0; it is locked like any other
+    return local_system == this ? local_queue : 0;
+}
+
+void job_system::push(const task& t) {
+    t.pending->fetch_add(1, std::memory_order_relaxed);
+
+    worker_queue& queue = *queues[static_cast<size_t>(current_queue())];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(t);
+    }
+
+    // Pairs with the sleeping/queued check in worker_main: either the worker sees this task
+    // before sleeping, or we see it sleeping and wake it
+    queued.fetch_add(1, std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_seq_cst) > 0) {
+        { std::lock_guard<std::mutex> lock(sleep_mutex); }
+        wake.notify_one();
+    }
+}
+
+bool job_system::try_take(task& out) {
+    if (queued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    // Own deque first, newest task (its data is still in cache)
+    size_t self = static_cast<size_t>(current_queue());
+    {
+        worker_queue& queue = *queues[self];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            out = queue.tasks.back();
+            queue.tasks.pop_back();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal the oldest task (largest remaining range) from another deque
+    size_t count = queues.size();
+    size_t start = next_steal_seed() % count;
+    for (size_t i = 0; i < count; ++i) {
+        size_t victim = (start + i) % count;
+        if (victim == self) {
+            continue;
+        }
+        worker_queue& queue = *queues[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            out = queue.tasks.front();
+            queue.tasks.pop_front();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void job_system::execute(const task& t) {
+    t.run(*this, t);
+    t.pending->fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void job_system::wait(const std::atomic<size_t>& pending) {
+    task t;
+    while (pending.load(std::memory_order_acquire) != 0) {
+        if (try_take(t)) {
+            execute(t);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void job_system::worker_main(int index) {
+    local_system = this;
+    local_queue = index;
+    steal_seed ^= static_cast<uint32_t>(index) * 0x85ebca6bu;
+#if FROGLORDS_PROFILE
+    std::string name = "job worker " + std::to_string(index);
+    FL_TRACE_THREAD_NAME(name.c_str());
+#endif
+
+    task t;
+    int idle = 0;
+    for (;;) {
+        if (try_take(t)) {
+            execute(t);
+            idle = 0;
+            continue;
+        }
+        if (++idle < IDLE_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        sleeping.fetch_add(1, std::memory_order_seq_cst);
+        wake.wait(lock,
+                  [this] { return stopping || queued.load(std::memory_order_seq_cst) > 0; });
+        sleeping.fetch_sub(1, std::memory_order_relaxed);
+        if (stopping) {
+            return;
+        }
+        idle = 0;
+    }
+}
+
+void job_system::run_graph_node(job_system& jobs, const task& self) {
+    auto& graph = *static_cast<job_graph*>(self.context);
+    const job_graph::node& n = graph.nodes[self.begin];
+    n.work();
+
+    // Release successors whose last predecessor this was
+    for (job_graph::node_id successor : n.successors) {
+        if (graph.remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            jobs.push(task{&run_graph_node, &graph, successor, successor + 1, self.pending});
+        }
+    }
+}
+
+void job_system::run(job_graph& graph) {
+    size_t count = graph.nodes.size();
+    if (count == 0) {
+        return;
+    }
+
+    if (graph.remaining_capacity < count) {
+        graph.remaining = std::make_unique<std::atomic<uint32_t>[]>(count);
+        graph.remaining_capacity = count;
+    }
+
+    // Kahn's order doubles as the cycle check (a cycle would leave nodes that never run)
+    std::vector<job_graph::node_id>& ready = graph.ready;
+    std::vector<job_graph::node_id>& roots = graph.roots;
+    std::vector<uint32_t>& unvisited = graph.unvisited;
+    ready.clear();
+    unvisited.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        unvisited[i] = graph.nodes[i].predecessors;
+        graph.remaining[i].store(graph.nodes[i].predecessors, std::memory_order_relaxed);
+        if (unvisited[i] == 0) {
+            ready.push_back(static_cast<job_graph::node_id>(i));
+        }
+    }
+    roots.assign(ready.begin(), ready.end());
+    size_t visited = 0;
+    while (!ready.empty()) {
+        job_graph::node_id id = ready.back();
+        ready.pop_back();
+        visited++;
+        for (job_graph::node_id successor : graph.nodes[id].successors) {
+            if (--unvisited[successor] == 0) {
+                ready.push_back(successor);
+            }
+        }
+    }
+    FL_PRECONDITION(visited == count, "job_graph must not contain cycles");
+
+    // One count for the caller's hold plus one per pushed node; released below
+    std::atomic<size_t> pending{1};
+    for (job_graph::node_id root : roots) {
+        push(task{&run_graph_node, &graph, root, root + 1, &pending});
+    }
+    pending.fetch_sub(1, std::memory_order_acq_rel);
+    wait(pending);
+}
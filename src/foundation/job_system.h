@@ -0,0 +1,193 @@
+#pragma once
+#include "foundation/debug_assert.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Work-stealing job scheduler for fanning simulation work out across cores
+//
+// Every participating thread (the spawned workers plus the thread that owns the job_system)
+// has its own task deque. A thread pushes and pops at the back of its own deque (newest
+// first, still cache-warm); an idle thread steals from the front of another's (oldest first,
+// usually the biggest remaining piece). A thread waiting for its jobs runs other jobs instead
+// of blocking, so parallel_for and graph runs can nest inside jobs.
+//
+// parallel_for splits its range recursively: a task larger than the grain pushes its upper
+// half and keeps the lower one, so thieves take large pieces while the owner works down to
+// grain-sized chunks. Ranges at or below the grain run inline without touching the queues.
+//
+// Deques are mutex-guarded: tasks are grain-sized (microseconds), so the lock is never the
+// bottleneck. Idle workers sleep on a condition variable rather than spinning.
+//
+// Usage:
+//   job_system jobs;                      // hardware threads - 1 workers
+//   jobs.parallel_for(count, 1024, [&](size_t begin, size_t end) { ... });
+//
+//   job_graph graph;
+//   auto a = graph.add([&] { ... });
+//   auto b = graph.add([&] { ... });
+//   graph.precede(a, b);                  // b starts after a finishes
+//   jobs.run(graph);                      // returns when every node has run
+
+class job_system;
+
+// Jobs with ordering constraints, run as a unit by job_system::run
+// Nodes without unfinished predecessors run in parallel. Reusable: run it again, or clear()
+// and rebuild. Must not contain cycles.
+class job_graph {
+  public:
+    using node_id = uint32_t;
+
+    node_id add(std::function<void()> work);
+
+    // `after` starts only once `before` has finished
+    void precede(node_id before, node_id after);
+
+    size_t size() const { return nodes.size(); }
+    void clear();
+
+  private:
+    friend class job_system;
+
+    struct node {
+        std::function<void()> work;
+        std::vector<node_id> successors;
+        uint32_t predecessors = 0;
+    };
+
+    std::vector<node> nodes;
+    std::unique_ptr<std::atomic<uint32_t>[]> remaining; // per node, reset by each run
+    size_t remaining_capacity = 0;
+
+    // Scratch for run()'s cycle check, kept so reruns of the same graph don't allocate
+    std::vector<node_id> ready;
+    std::vector<node_id> roots;
+    std::vector<uint32_t> unvisited;
+};
+
+class job_system {
+  public:
+    // Worker threads spawned in addition to the owning thread; 0 runs everything inline
+    explicit job_system(int worker_threads = default_worker_threads());
+    ~job_system();
+
+    job_system(const job_system&) = delete;
+    job_system& operator=(const job_system&) = delete;
+
+    // Hardware threads minus the owning thread (at least 0)
+    static int default_worker_threads();
+
+    // Threads that execute jobs: workers + the owning thread
+    int thread_count() const { return static_cast<int>(queues.size()); }
+
+    // Call body(begin, end) over disjoint sub-ranges covering [0, count), each at most
+    // `grain` long; returns when all have finished. Body must be safe to run concurrently.
+    template <typename F>
+    void parallel_for(size_t count, size_t grain, F&& body);
+
+    // Run every node of the graph respecting precede() ordering; returns when all have run
+    void run(job_graph& graph);
+
+  private:
+    // Fixed-size unit of queued work; run() receives the task that was queued
+    struct task {
+        void (*run)(job_system& jobs, const task& self);
+        void* context;
+        size_t begin;
+        size_t end;
+        std::atomic<size_t>* pending; // decremented once run returns
+    };
+
+    struct worker_queue {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    template <typename F>
+    struct range_context {
+        F* body;
+        size_t grain;
+    };
+
+    template <typename F>
+    static void run_range(job_system& jobs, const task& self);
+    static void run_graph_node(job_system& jobs, const task& self);
+
+    // Queue on the calling thread's deque (counts toward self.pending)
+    void push(const task& t);
+    bool try_take(task& out);
+    void execute(const task& t);
+    // Run queued jobs until pending reaches zero
+    void wait(const std::atomic<size_t>& pending);
+    void worker_main(int index);
+    int current_queue() const;
+
+    std::vector<std::unique_ptr<worker_queue>> queues; // [0] = owning thread
+    std::vector<std::thread> threads;
+
+    std::atomic<size_t> queued{0}; // tasks sitting in any deque
+    std::atomic<int> sleeping{0};
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    bool stopping = false; // guarded by sleep_mutex
+};
+
+template <typename F>
+void job_system::run_range(job_system& jobs, const task& self) {
+    const auto& context = *static_cast<const range_context<F>*>(self.context);
+    size_t begin = self.begin;
+    size_t end = self.end;
+    while (end - begin > context.grain) {
+        size_t middle = begin + (end - begin) / 2;
+        jobs.push(task{self.run, self.context, middle, end, self.pending});
+        end = middle;
+    }
+    (*context.body)(begin, end);
+}
+
+template <typename F>
+void job_system::parallel_for(size_t count, size_t grain, F&& body) {
+    FL_PRECONDITION(grain > 0, "parallel_for grain must be positive");
+    if (count == 0) {
+        return;
+    }
+    if (count <= grain) {
+        body(size_t{0}, count);
+        return;
+    }
+    if (threads.empty()) {
+        for (size_t begin = 0; begin < count; begin += grain) {
+            body(begin, begin + std::min(grain, count - begin));
+        }
+        return;
+    }
+
+    using body_type = std::remove_reference_t<F>;
+    range_context<body_type> context{&body, grain};
+    std::atomic<size_t> pending{1};
+    execute(task{&run_range<body_type>, &context, 0, count, &pending});
+    wait(pending);
+}
+
+// parallel_for on `jobs`, or grain-sized chunks in order on the caller when jobs is null
+template <typename F>
+void parallel_for(job_system* jobs, size_t count, size_t grain, F&& body) {
+    FL_PRECONDITION(grain > 0, "parallel_for grain must be positive");
+    if (jobs != nullptr) {
+        jobs->parallel_for(count, grain, std::forward<F>(body));
+        return;
+    }
+    for (size_t begin = 0; begin < count; begin += grain) {
+        body(begin, begin + std::min(grain, count - begin));
+    }
+}
@@ -0,0 +1,163 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Array that either owns its elements (a std::vector) or borrows a read-only array owned by
+// someone else, typically a memory-mapped level file used in place.
+//
+// Reads never copy and cost the same as std::vector. Any mutation of a borrowed array first
+// copies the elements into owned storage (copy-on-write), so code that builds arrays with
+// push_back/resize keeps working on loaded data. Copies of a borrowing array borrow the same
+// memory; the lender must outlive every borrower.
+
+namespace foundation {
+
+template <typename T>
+class mapped_array {
+    static_assert(std::is_trivially_copyable_v<T>, "mapped_array elements are used in place");
+
+  public:
+    mapped_array() = default;
+    mapped_array(const mapped_array& other)
+        : owned(other.owned)
+        , view_data(other.view_data)
+        , view_size(other.view_size)
+        , borrowing(other.borrowing) {
+        sync();
+    }
+    mapped_array(mapped_array&& other) noexcept
+        : owned(std::move(other.owned))
+        , view_data(other.view_data)
+        , view_size(other.view_size)
+        , borrowing(other.borrowing) {
+        sync();
+        other.reset_view();
+    }
+    mapped_array& operator=(const mapped_array& other) {
+        if (this != &other) {
+            owned = other.owned;
+            view_data = other.view_data;
+            view_size = other.view_size;
+            borrowing = other.borrowing;
+            sync();
+        }
+        return *this;
+    }
+    mapped_array& operator=(mapped_array&& other) noexcept {
+        if (this != &other) {
+            owned = std::move(other.owned);
+            view_data = other.view_data;
+            view_size = other.view_size;
+            borrowing = other.borrowing;
+            sync();
+            other.reset_view();
+        }
+        return *this;
+    }
+
+    // Read access (never copies)
+    size_t size() const { return view_size; }
+    bool empty() const { return view_size == 0; }
+    const T* data() const { return view_data; }
+    const T& operator[](size_t i) const { return view_data[i]; }
+    const T& back() const { return view_data[view_size - 1]; }
+    const T* begin() const { return view_data; }
+    const T* end() const { return view_data + view_size; }
+    std::span<const T> span() const { return {view_data, view_size}; }
+
+    // Write access (detaches from borrowed memory first)
+    T* data() { return edit().data(); }
+    T& operator[](size_t i) { return edit()[i]; }
+    T& back() { return edit().back(); }
+    T* begin() { return edit().data(); }
+    T* end() { return edit().data() + owned.size(); }
+
+    void push_back(const T& value) {
+        edit().push_back(value);
+        sync();
+    }
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        T& result = edit().emplace_back(std::forward<Args>(args)...);
+        sync();
+        return result;
+    }
+    void resize(size_t count) {
+        edit().resize(count);
+        sync();
+    }
+    void resize(size_t count, const T& value) {
+        edit().resize(count, value);
+        sync();
+    }
+    void assign(size_t count, const T& value) {
+        release();
+        owned.assign(count, value);
+        sync();
+    }
+    void reserve(size_t count) {
+        edit().reserve(count);
+        sync();
+    }
+    void shrink_to_fit() {
+        edit().shrink_to_fit();
+        sync();
+    }
+    void clear() {
+        release();
+        owned.clear();
+        sync();
+    }
+
+    // Use `items` in place (drops owned elements); `items` must outlive this array and its
+    // copies, or until they are next mutated
+    void borrow(std::span<const T> items) {
+        owned = std::vector<T>();
+        view_data = items.data();
+        view_size = items.size();
+        borrowing = true;
+    }
+    bool is_borrowed() const { return borrowing; }
+
+  private:
+    std::vector<T>& edit() {
+        if (borrowing) {
+            owned.assign(view_data, view_data + view_size);
+            borrowing = false;
+            sync();
+        }
+        return owned;
+    }
+
+    // Stop borrowing without copying (the caller replaces the contents)
+    void release() {
+        if (borrowing) {
+            borrowing = false;
+            view_data = nullptr;
+            view_size = 0;
+        }
+    }
+
+    void sync() {
+        if (!borrowing) {
+            view_data = owned.data();
+            view_size = owned.size();
+        }
+    }
+
+    void reset_view() {
+        view_data = nullptr;
+        view_size = 0;
+        borrowing = false;
+    }
+
+    std::vector<T> owned;
+    const T* view_data = nullptr;
+    size_t view_size = 0;
+    bool borrowing = false;
+};
+
+} // namespace foundation
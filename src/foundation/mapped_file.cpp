@@ -0,0 +1,129 @@
+#include "foundation/mapped_file.h"
+#include <utility>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace foundation {
+
+mapped_file::~mapped_file() {
+    close();
+}
+
+mapped_file::mapped_file(mapped_file&& other) noexcept {
+    *this = std::move(other);
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& other) noexcept {
+    if (this != &other) {
+        close();
+        std::swap(bytes, other.bytes);
+        std::swap(byte_count, other.byte_count);
+#if defined(_WIN32)
+        std::swap(mapping, other.mapping);
+#endif
+    }
+    return *this;
+}
+
+void mapped_file::prefault() const {
+    // Smallest page size of the supported platforms; larger pages are just touched twice
+    constexpr size_t PAGE_BYTES = 4096;
+    unsigned char sum = 0;
+    for (size_t offset = 0; offset < byte_count; offset += PAGE_BYTES) {
+        sum ^= static_cast<const volatile unsigned char*>(bytes)[offset];
+    }
+    static_cast<void>(sum);
+}
+
+#if defined(_WIN32)
+
+bool mapped_file::open(const char* path) {
+    close();
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // The mapping object keeps the file open; the file handle is no longer needed
+    HANDLE view_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (view_mapping == nullptr) {
+        return false;
+    }
+    void* view = MapViewOfFile(view_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(view_mapping);
+        return false;
+    }
+
+    mapping = view_mapping;
+    bytes = static_cast<const unsigned char*>(view);
+    byte_count = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+void mapped_file::close() {
+    if (bytes != nullptr) {
+        UnmapViewOfFile(bytes);
+        CloseHandle(mapping);
+    }
+    bytes = nullptr;
+    byte_count = 0;
+    mapping = nullptr;
+}
+
+#else
+
+bool mapped_file::open(const char* path) {
+    close();
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // The mapping keeps the file referenced after the descriptor closes
+    size_t size = static_cast<size_t>(info.st_size);
+    void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+
+    bytes = static_cast<const unsigned char*>(view);
+    byte_count = size;
+    return true;
+}
+
+void mapped_file::close() {
+    if (bytes != nullptr) {
+        munmap(const_cast<unsigned char*>(bytes), byte_count);
+    }
+    bytes = nullptr;
+    byte_count = 0;
+}
+
+#endif
+
+} // namespace foundation
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+
+// Read-only memory mapping of a whole file
+//
+// The OS pages the file in on first touch, so opening costs the same for any file size and
+// untouched parts are never read. Data stays valid until close() or destruction.
+
+namespace foundation {
+
+class mapped_file {
+  public:
+    mapped_file() = default;
+    ~mapped_file();
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file(mapped_file&& other) noexcept;
+    mapped_file& operator=(mapped_file&& other) noexcept;
+
+    // Map `path` (closing any current mapping). Returns false if the file cannot be opened
+    // or mapped, or is empty.
+    bool open(const char* path);
+    void close();
+
+    // Touch every page so later reads do not fault (call from a loader thread)
+    void prefault() const;
+
+    bool is_open() const { return bytes != nullptr; }
+    const unsigned char* data() const { return bytes; }
+    size_t size() const { return byte_count; }
+
+  private:
+    const unsigned char* bytes = nullptr;
+    size_t byte_count = 0;
+#if defined(_WIN32)
+    void* mapping = nullptr; // file mapping object handle
+#endif
+};
+
+} // namespace foundation
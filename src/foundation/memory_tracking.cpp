@@ -0,0 +1,249 @@
+#include "foundation/memory_tracking.h"
+
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+namespace memory {
+
+namespace {
+
+// constinit: operator new can run before any dynamic initializer
+constinit std::atomic<uint64_t> allocations{0};
+
+} // namespace
+
+uint64_t allocation_count() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace memory
+
+#if FROGLORDS_MEMORY_TRACKING
+
+namespace memory {
+
+namespace detail {
+constinit thread_local tag current = tag::UNTAGGED;
+} // namespace detail
+
+namespace {
+
+// Precedes every allocation; 16 bytes keeps malloc's alignment for the caller's pointer
+struct allocation_header {
+    uint64_t size;   // bytes requested
+    uint32_t offset; // from the malloc'd block to the caller's pointer
+    tag owner;
+};
+
+constexpr size_t HEADER_SIZE = 16;
+static_assert(sizeof(allocation_header) <= HEADER_SIZE);
+
+struct tag_counters {
+    std::atomic<uint64_t> live_bytes{0};
+    std::atomic<uint64_t> peak_bytes{0};
+    std::atomic<uint64_t> live_allocations{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frame_start{0};       // allocations when the current frame began
+    std::atomic<uint64_t> frame_allocations{0}; // last closed frame
+};
+
+constinit tag_counters counters[TAG_COUNT] = {};
+
+constexpr const char* TAG_NAMES[TAG_COUNT] = {"untagged", "collision", "rendering",
+                                              "gui",      "debug",     "mesh"};
+
+void* allocate_aligned(std::size_t size, std::size_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    // Larger alignments than malloc's need slack to slide the pointer forward
+    std::size_t slack = alignment > alignof(std::max_align_t) ? alignment - 1 : 0;
+    auto* block = static_cast<std::byte*>(std::malloc(HEADER_SIZE + slack + size));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    uintptr_t address = reinterpret_cast<uintptr_t>(block) + HEADER_SIZE;
+    address = (address + (alignment - 1)) & ~(static_cast<uintptr_t>(alignment) - 1);
+    auto* p = reinterpret_cast<std::byte*>(address);
+
+    tag owner = detail::current;
+    allocation_header header{size, static_cast<uint32_t>(p - block), owner};
+    std::memcpy(p - HEADER_SIZE, &header, sizeof(header));
+
+    tag_counters& c = counters[static_cast<int>(owner)];
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    c.live_allocations.fetch_add(1, std::memory_order_relaxed);
+    uint64_t live = c.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peak = c.peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !c.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return p;
+}
+
+void release_aligned(void* p) {
+    if (p == nullptr) {
+        return;
+    }
+    auto* bytes = static_cast<std::byte*>(p);
+    allocation_header header;
+    std::memcpy(&header, bytes - HEADER_SIZE, sizeof(header));
+
+    tag_counters& c = counters[static_cast<int>(header.owner)];
+    c.live_bytes.fetch_sub(header.size, std::memory_order_relaxed);
+    c.live_allocations.fetch_sub(1, std::memory_order_relaxed);
+    std::free(bytes - header.offset);
+}
+
+void* allocate(std::size_t size) {
+    return allocate_aligned(size, alignof(std::max_align_t));
+}
+
+void release(void* p) {
+    release_aligned(p);
+}
+
+} // namespace
+
+const char* tag_name(tag t) {
+    int index = static_cast<int>(t);
+    return index >= 0 && index < TAG_COUNT ? TAG_NAMES[index] : "?";
+}
+
+tag_stats stats(tag t) {
+    const tag_counters& c = counters[static_cast<int>(t)];
+    tag_stats result;
+    result.live_bytes = static_cast<size_t>(c.live_bytes.load(std::memory_order_relaxed));
+    result.peak_bytes = static_cast<size_t>(c.peak_bytes.load(std::memory_order_relaxed));
+    result.live_allocations = c.live_allocations.load(std::memory_order_relaxed);
+    result.allocations = c.allocations.load(std::memory_order_relaxed);
+    result.frame_allocations = c.frame_allocations.load(std::memory_order_relaxed);
+    return result;
+}
+
+void end_frame() {
+    for (tag_counters& c : counters) {
+        uint64_t now = c.allocations.load(std::memory_order_relaxed);
+        c.frame_allocations.store(now - c.frame_start.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+        c.frame_start.store(now, std::memory_order_relaxed);
+    }
+}
+
+bool write_report(const char* path) {
+    std::FILE* file = std::fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+
+    std::fprintf(file, "%-10s %14s %14s %12s %14s %12s\n", "tag", "live_bytes", "peak_bytes",
+                 "live_allocs", "allocations", "last_frame");
+    tag_stats total;
+    for (int i = 0; i < TAG_COUNT; ++i) {
+        tag_stats s = stats(static_cast<tag>(i));
+        std::fprintf(file, "%-10s %14zu %14zu %12llu %14llu %12llu\n",
+                     tag_name(static_cast<tag>(i)), s.live_bytes, s.peak_bytes,
+                     static_cast<unsigned long long>(s.live_allocations),
+                     static_cast<unsigned long long>(s.allocations),
+                     static_cast<unsigned long long>(s.frame_allocations));
+        total.live_bytes += s.live_bytes;
+        total.peak_bytes += s.peak_bytes; // sum of per-tag peaks: an upper bound
+        total.live_allocations += s.live_allocations;
+        total.allocations += s.allocations;
+        total.frame_allocations += s.frame_allocations;
+    }
+    std::fprintf(file, "%-10s %14zu %14zu %12llu %14llu %12llu\n", "total", total.live_bytes,
+                 total.peak_bytes, static_cast<unsigned long long>(total.live_allocations),
+                 static_cast<unsigned long long>(total.allocations),
+                 static_cast<unsigned long long>(total.frame_allocations));
+
+    bool ok = std::ferror(file) == 0;
+    return std::fclose(file) == 0 && ok;
+}
+
+} // namespace memory
+
+#else
+
+namespace memory {
+
+namespace {
+
+void* allocate(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    // malloc(0) may return null; operator new must not
+    if (void* p = std::malloc(size != 0 ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* allocate_aligned(std::size_t size, std::size_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+#if defined(_MSC_VER)
+    void* p = _aligned_malloc(size != 0 ? size : 1, alignment);
+#else
+    // aligned_alloc wants a size that is a multiple of the alignment
+    std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+    void* p = std::aligned_alloc(alignment, rounded != 0 ? rounded : alignment);
+#endif
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void release(void* p) {
+    std::free(p);
+}
+
+void release_aligned(void* p) {
+#if defined(_MSC_VER)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+} // namespace
+
+} // namespace memory
+
+#endif
+
+// Replacements for the global allocation functions. The array and nothrow forms are not
+// replaced: the standard library's versions forward to these.
+
+void* operator new(std::size_t size) {
+    return memory::allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return memory::allocate_aligned(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+    memory::release(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    memory::release(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    memory::release_aligned(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    memory::release_aligned(p);
+}
+
+#endif
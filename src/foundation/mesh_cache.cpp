@@ -0,0 +1,107 @@
+#include "foundation/mesh_cache.h"
+#include "foundation/memory_tracking.h"
+#include <algorithm>
+
+namespace foundation {
+
+namespace {
+
+// Shape in the top bits, two 28-bit topology parameters below
+uint64_t make_key(uint64_t kind, uint32_t a, uint32_t b) {
+    constexpr uint32_t PARAM_MASK = (1u << 28) - 1;
+    return (kind << 56) | (static_cast<uint64_t>(a & PARAM_MASK) << 28) | (b & PARAM_MASK);
+}
+
+glm::mat4 scale_translate(const glm::vec3& scale, const glm::vec3& translation) {
+    glm::mat4 m(1.0f);
+    m[0][0] = scale.x;
+    m[1][1] = scale.y;
+    m[2][2] = scale.z;
+    m[3] = glm::vec4(translation, 1.0f);
+    return m;
+}
+
+} // namespace
+
+cached_mesh mesh_cache::sphere(const sphere_config& config) {
+    // generate_sphere clamps tessellation the same way, so equal meshes share a key
+    uint32_t segments = static_cast<uint32_t>(std::max(3, config.segments));
+    uint32_t rings = static_cast<uint32_t>(std::max(3, config.rings));
+    float radius = std::max(config.radius, 0.0f);
+    return {find_or_generate(shape::SPHERE, segments, rings),
+            scale_translate(glm::vec3(radius), glm::vec3(0.0f))};
+}
+
+cached_mesh mesh_cache::box(const box_dimensions& dims) {
+    return {find_or_generate(shape::BOX, 0, 0),
+            scale_translate(glm::vec3(dims.width, dims.height, dims.depth), glm::vec3(0.0f))};
+}
+
+cached_mesh mesh_cache::circle(const glm::vec3& center, const circle_config& config) {
+    uint32_t segments = static_cast<uint32_t>(std::max(0, config.segments));
+    return {find_or_generate(shape::CIRCLE, segments, 0),
+            scale_translate(glm::vec3(config.radius, 1.0f, config.radius), center)};
+}
+
+cached_mesh mesh_cache::arrow_head(const glm::vec3& start, const glm::vec3& end,
+                                   float head_size) {
+    cached_mesh result{find_or_generate(shape::ARROW_HEAD, 0, 0), glm::mat4(0.0f)};
+    arrow_head_transform(start, end, head_size, result.transform);
+    return result;
+}
+
+std::shared_ptr<const wireframe_mesh> mesh_cache::find_or_generate(shape kind, uint32_t a,
+                                                                   uint32_t b) {
+    uint64_t key = make_key(static_cast<uint64_t>(kind), a, b);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = meshes.find(key);
+    if (found != meshes.end()) {
+        ++hits;
+        return found->second;
+    }
+
+    // Generated under the lock: misses are rare (one per distinct key) and this keeps two
+    // threads from generating the same mesh
+    ++misses;
+    FL_MEMORY_TAG(MESH);
+    wireframe_mesh mesh;
+    switch (kind) {
+    case shape::SPHERE:
+        mesh = generate_sphere({static_cast<int>(a), static_cast<int>(b), 1.0f});
+        break;
+    case shape::BOX:
+        mesh = generate_box({1.0f, 1.0f, 1.0f});
+        break;
+    case shape::CIRCLE:
+        mesh = generate_circle(glm::vec3(0.0f), {1.0f, static_cast<int>(a)});
+        break;
+    case shape::ARROW_HEAD:
+        mesh = generate_arrow_head();
+        break;
+    }
+    auto shared = std::make_shared<const wireframe_mesh>(std::move(mesh));
+    meshes.emplace(key, shared);
+    return shared;
+}
+
+mesh_cache_stats mesh_cache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    mesh_cache_stats result;
+    result.hits = hits;
+    result.misses = misses;
+    result.entries = meshes.size();
+    return result;
+}
+
+void mesh_cache::reset_stats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    hits = misses = 0;
+}
+
+void mesh_cache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    meshes.clear();
+}
+
+} // namespace foundation
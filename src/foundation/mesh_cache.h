@@ -0,0 +1,69 @@
+#pragma once
+
+#include "foundation/procedural_mesh.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace foundation {
+
+// Shared unit mesh plus the transform that places it where the generator call would have
+struct cached_mesh {
+    std::shared_ptr<const wireframe_mesh> mesh; // immutable, shared by every request with its key
+    glm::mat4 transform{1.0f};
+};
+
+struct mesh_cache_stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0; // each one generated a mesh
+    size_t entries = 0;  // distinct unit meshes held
+
+    float hit_rate() const {
+        uint64_t requests = hits + misses;
+        return requests > 0 ? static_cast<float>(hits) / static_cast<float>(requests) : 0.0f;
+    }
+};
+
+// Memoized procedural generators
+//
+// Each shape is generated once at unit size and keyed by what changes its topology; size and
+// placement go into the returned transform. A repeat request costs a hash lookup instead of
+// fresh vectors and sin/cos per vertex. Transformed vertices match the direct generator's to
+// float rounding. Thread-safe (one lock per request).
+class mesh_cache {
+  public:
+    // generate_sphere(config), keyed by segments x rings (radius is a uniform scale; radius
+    // <= 0 collapses the sphere to its center)
+    cached_mesh sphere(const sphere_config& config);
+
+    // generate_box(dims): one unit cube for every size
+    cached_mesh box(const box_dimensions& dims);
+
+    // generate_circle(center, config), keyed by segments
+    cached_mesh circle(const glm::vec3& center, const circle_config& config);
+
+    // Head of generate_arrow(start, end, head_size) (generate_arrow_head, placed in the same
+    // basis); the shaft is the line start -> end. Degenerate arrows get a zero transform.
+    cached_mesh arrow_head(const glm::vec3& start, const glm::vec3& end, float head_size);
+
+    mesh_cache_stats stats() const;
+    void reset_stats();
+
+    // Drop every mesh (outstanding cached_mesh handles stay valid)
+    void clear();
+
+  private:
+    enum class shape : uint64_t { SPHERE, BOX, CIRCLE, ARROW_HEAD };
+
+    std::shared_ptr<const wireframe_mesh> find_or_generate(shape kind, uint32_t a, uint32_t b);
+
+    mutable std::mutex mutex;
+    std::unordered_map<uint64_t, std::shared_ptr<const wireframe_mesh>> meshes;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+} // namespace foundation
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Compile-time meshes
+//
+// constexpr counterparts of the procedural_mesh generators for configurations fixed at
+// compile time. Vertices and edges come out in the generators' order; positions match to
+// float rounding (std::sin/cos are not constexpr, so the tables use their own). Edges are
+// stored as upload-ready line-list indices. A table declared constexpr is built by the
+// compiler and lives in read-only memory: using it never generates or allocates.
+
+namespace foundation {
+
+template <size_t VERTEX_COUNT, size_t EDGE_COUNT>
+struct mesh_table {
+    std::array<glm::vec3, VERTEX_COUNT> vertices{};
+    std::array<uint32_t, EDGE_COUNT * 2> indices{}; // two per edge
+
+    std::span<const glm::vec3> vertex_span() const { return vertices; }
+    std::span<const uint32_t> index_span() const { return indices; }
+};
+
+namespace mesh_table_detail {
+
+constexpr double PI = 3.14159265358979323846;
+
+// Taylor series after reduction to [-pi, pi] (error below 1e-12, far under float precision)
+constexpr double sin(double x) {
+    while (x > PI) {
+        x -= 2.0 * PI;
+    }
+    while (x < -PI) {
+        x += 2.0 * PI;
+    }
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 14; ++n) {
+        term *= -x * x / static_cast<double>((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cos(double x) {
+    return sin(x + PI * 0.5);
+}
+
+// Fraction of a full turn as an angle, like the generators' i / count * 2pi
+constexpr double turn(int i, int count) {
+    return static_cast<double>(i) / static_cast<double>(count) * 2.0 * PI;
+}
+
+template <size_t V, size_t E>
+constexpr void add_edge(mesh_table<V, E>& table, size_t& cursor, int v0, int v1) {
+    table.indices[cursor++] = static_cast<uint32_t>(v0);
+    table.indices[cursor++] = static_cast<uint32_t>(v1);
+}
+
+} // namespace mesh_table_detail
+
+// generate_sphere({SEGMENTS, RINGS, 1.0f})
+template <int SEGMENTS, int RINGS>
+constexpr auto make_sphere_table() {
+    static_assert(SEGMENTS >= 3 && RINGS >= 3, "generate_sphere clamps tessellation to 3");
+    namespace detail = mesh_table_detail;
+    constexpr size_t VERTICES = 2 + static_cast<size_t>((RINGS - 1) * SEGMENTS);
+    constexpr size_t EDGES = static_cast<size_t>(SEGMENTS * 3 + (RINGS - 2) * SEGMENTS * 2);
+
+    mesh_table<VERTICES, EDGES> table;
+    size_t v = 0;
+    table.vertices[v++] = glm::vec3(0.0f, 1.0f, 0.0f);
+    for (int r = 1; r < RINGS; r++) {
+        double phi = static_cast<double>(r) / static_cast<double>(RINGS) * detail::PI;
+        double ring_radius = detail::sin(phi);
+        for (int s = 0; s < SEGMENTS; s++) {
+            double theta = detail::turn(s, SEGMENTS);
+            table.vertices[v++] = glm::vec3(static_cast<float>(ring_radius * detail::cos(theta)),
+                                            static_cast<float>(detail::cos(phi)),
+                                            static_cast<float>(ring_radius * detail::sin(theta)));
+        }
+    }
+    table.vertices[v++] = glm::vec3(0.0f, -1.0f, 0.0f);
+
+    int bottom_pole = static_cast<int>(VERTICES) - 1;
+    size_t e = 0;
+    for (int s = 0; s < SEGMENTS; s++) {
+        detail::add_edge(table, e, 0, 1 + s);
+    }
+    for (int r = 0; r < RINGS - 2; r++) {
+        int ring = 1 + r * SEGMENTS;
+        for (int s = 0; s < SEGMENTS; s++) {
+            detail::add_edge(table, e, ring + s, ring + (s + 1) % SEGMENTS);
+            detail::add_edge(table, e, ring + s, ring + SEGMENTS + s);
+        }
+    }
+    int last_ring = 1 + (RINGS - 2) * SEGMENTS;
+    for (int s = 0; s < SEGMENTS; s++) {
+        detail::add_edge(table, e, last_ring + s, last_ring + (s + 1) % SEGMENTS);
+    }
+    for (int s = 0; s < SEGMENTS; s++) {
+        detail::add_edge(table, e, last_ring + s, bottom_pole);
+    }
+    return table;
+}
+
+// generate_box({width, height, depth})
+constexpr mesh_table<8, 12> make_box_table(float width, float height, float depth) {
+    float hx = width * 0.5f;
+    float hy = height * 0.5f;
+    float hz = depth * 0.5f;
+
+    mesh_table<8, 12> table;
+    // Corner k: +x if bit 0, +y if bit 1, -z if bit 2
+    for (int k = 0; k < 8; ++k) {
+        table.vertices[static_cast<size_t>(k)] =
+            glm::vec3((k & 1) ? hx : -hx, (k & 2) ? hy : -hy, (k & 4) ? -hz : hz);
+    }
+    constexpr int EDGES[12][2] = {{0, 1}, {1, 5}, {5, 4}, {4, 0}, {2, 3}, {3, 7},
+                                  {7, 6}, {6, 2}, {0, 2}, {1, 3}, {5, 7}, {4, 6}};
+    size_t e = 0;
+    for (const auto& edge : EDGES) {
+        mesh_table_detail::add_edge(table, e, edge[0], edge[1]);
+    }
+    return table;
+}
+
+// generate_circle(glm::vec3(0.0f), {1.0f, SEGMENTS})
+template <int SEGMENTS>
+constexpr auto make_circle_table() {
+    static_assert(SEGMENTS > 0, "empty circle");
+    namespace detail = mesh_table_detail;
+
+    mesh_table<SEGMENTS, SEGMENTS> table;
+    size_t e = 0;
+    for (int i = 0; i < SEGMENTS; i++) {
+        double angle = detail::turn(i, SEGMENTS);
+        table.vertices[static_cast<size_t>(i)] =
+            glm::vec3(static_cast<float>(detail::cos(angle)), 0.0f,
+                      static_cast<float>(detail::sin(angle)));
+        detail::add_edge(table, e, i, (i + 1) % SEGMENTS);
+    }
+    return table;
+}
+
+// generate_grid_floor(size, DIVISIONS); same float arithmetic, so bit-identical
+template <int DIVISIONS>
+constexpr auto make_grid_table(float size) {
+    static_assert(DIVISIONS > 0, "empty grid");
+    constexpr int WIDTH = DIVISIONS + 1;
+    constexpr size_t VERTICES = static_cast<size_t>(WIDTH * WIDTH);
+    constexpr size_t EDGES = static_cast<size_t>(2 * DIVISIONS * WIDTH);
+
+    float half_size = size * 0.5f;
+    float step = size / static_cast<float>(DIVISIONS);
+
+    mesh_table<VERTICES, EDGES> table;
+    for (int z = 0; z <= DIVISIONS; z++) {
+        for (int x = 0; x <= DIVISIONS; x++) {
+            table.vertices[static_cast<size_t>(z * WIDTH + x)] =
+                glm::vec3(-half_size + static_cast<float>(x) * step, 0.0f,
+                          -half_size + static_cast<float>(z) * step);
+        }
+    }
+
+    size_t e = 0;
+    for (int z = 0; z <= DIVISIONS; z++) {
+        for (int x = 0; x < DIVISIONS; x++) {
+            mesh_table_detail::add_edge(table, e, z * WIDTH + x, z * WIDTH + x + 1);
+        }
+    }
+    for (int z = 0; z < DIVISIONS; z++) {
+        for (int x = 0; x <= DIVISIONS; x++) {
+            mesh_table_detail::add_edge(table, e, z * WIDTH + x, (z + 1) * WIDTH + x);
+        }
+    }
+    return table;
+}
+
+// generate_arrow_head()
+constexpr mesh_table<5, 8> make_arrow_head_table() {
+    namespace detail = mesh_table_detail;
+    constexpr float CONE_RADIUS = 0.3f;
+
+    mesh_table<5, 8> table;
+    table.vertices[0] = glm::vec3(0.0f);
+    size_t e = 0;
+    for (int i = 0; i < 4; i++) {
+        double angle = detail::turn(i, 4);
+        table.vertices[static_cast<size_t>(1 + i)] =
+            glm::vec3(static_cast<float>(CONE_RADIUS * detail::cos(angle)),
+                      static_cast<float>(CONE_RADIUS * detail::sin(angle)), -1.0f);
+        detail::add_edge(table, e, 0, 1 + i);
+    }
+    for (int i = 0; i < 4; i++) {
+        detail::add_edge(table, e, 1 + i, 1 + (i + 1) % 4);
+    }
+    return table;
+}
+
+} // namespace foundation
@@ -1,40 +1,62 @@
 #include "foundation/procedural_mesh.h"
 #include "foundation/math_utils.h"
 #include "foundation/debug_assert.h"
+#include "foundation/memory_tracking.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/constants.hpp>
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
 namespace foundation {
 
-wireframe_mesh::wireframe_mesh()
-    : position(0.0f, 0.0f, 0.0f)
-    , rotation(0.0f, 0.0f, 0.0f)
-    , scale(1.0f, 1.0f, 1.0f) {}
+namespace {
 
-glm::mat4 wireframe_mesh::get_model_matrix() const {
-    glm::mat4 model = glm::mat4(1.0f);
-
-    // Apply transformations: translate, rotate, scale
-    model = glm::translate(model, position);
-
-    // Apply rotations (X, Y, Z order)
-    model = glm::rotate(model, rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
-    model = glm::rotate(model, rotation.y, math::UP);
-    model = glm::rotate(model, rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+// Each generator is written once against a sink: mesh_sink grows a wireframe_mesh,
+// buffer_sink fills caller-provided buffers. reserve() receives the exact *_size() result.
+struct mesh_sink {
+    wireframe_mesh& mesh;
 
-    model = glm::scale(model, scale);
+    void reserve(mesh_size size) {
+        mesh.vertices.reserve(size.vertices);
+        mesh.edges.reserve(size.indices / 2);
+    }
+    void vertex(const glm::vec3& v) { mesh.vertices.push_back(v); }
+    void line(int v0, int v1) { mesh.edges.push_back(edge(v0, v1)); }
+};
+
+template <typename Index>
+struct buffer_sink {
+    mesh_buffers<Index> out;
+    mesh_size written;
+
+    void reserve([[maybe_unused]] mesh_size size) { // checks compile out in release
+        FL_PRECONDITION(out.vertices.size() >= size.vertices && out.indices.size() >= size.indices,
+                        "output buffers smaller than the mesh (see the *_size functions)");
+        FL_PRECONDITION(size.vertices <= size_t(std::numeric_limits<Index>::max()) + 1,
+                        "mesh has more vertices than the index type can address");
+    }
+    void vertex(const glm::vec3& v) { out.vertices[written.vertices++] = v; }
+    void line(int v0, int v1) {
+        out.indices[written.indices++] = static_cast<Index>(v0);
+        out.indices[written.indices++] = static_cast<Index>(v1);
+    }
+};
 
-    return model;
+// Signed angle from start_dir to end_dir about UP
+float arc_angle(const glm::vec3& start_dir, const glm::vec3& end_dir) {
+    float dot_product = glm::dot(start_dir, end_dir);
+    glm::vec3 cross_product = glm::cross(start_dir, end_dir);
+    return std::atan2(glm::dot(cross_product, math::UP), dot_product);
 }
 
-wireframe_mesh generate_sphere(sphere_config config) {
-    wireframe_mesh mesh;
+template <typename Sink>
+void emit_sphere(sphere_config config, Sink& out) {
+    out.reserve(sphere_size(config));
 
     if (config.radius <= 0.0f) {
-        mesh.vertices.push_back(glm::vec3(0.0f));
-        return mesh;
+        out.vertex(glm::vec3(0.0f));
+        return;
     }
 
     int segments = std::max(3, config.segments);
@@ -42,7 +64,7 @@ wireframe_mesh generate_sphere(sphere_config config) {
     float radius = config.radius;
 
     // Generate vertices using UV sphere topology
-    mesh.vertices.push_back(glm::vec3(0.0f, radius, 0.0f));
+    out.vertex(glm::vec3(0.0f, radius, 0.0f));
 
     for (int r = 1; r < rings; r++) {
         float phi = static_cast<float>(r) / static_cast<float>(rings) * glm::pi<float>();
@@ -54,18 +76,18 @@ wireframe_mesh generate_sphere(sphere_config config) {
                 static_cast<float>(s) / static_cast<float>(segments) * 2.0f * glm::pi<float>();
             float x = ring_radius * std::cos(theta);
             float z = ring_radius * std::sin(theta);
-            mesh.vertices.push_back(glm::vec3(x, y, z));
+            out.vertex(glm::vec3(x, y, z));
         }
     }
 
-    mesh.vertices.push_back(glm::vec3(0.0f, -radius, 0.0f));
+    out.vertex(glm::vec3(0.0f, -radius, 0.0f));
 
     int top_pole_index = 0;
-    int bottom_pole_index = static_cast<int>(mesh.vertices.size()) - 1;
+    int bottom_pole_index = 1 + (rings - 1) * segments;
 
     for (int s = 0; s < segments; s++) {
         int vertex_index = 1 + s;
-        mesh.edges.push_back(edge(top_pole_index, vertex_index));
+        out.line(top_pole_index, vertex_index);
     }
 
     for (int r = 0; r < rings - 2; r++) {
@@ -77,8 +99,8 @@ wireframe_mesh generate_sphere(sphere_config config) {
             int next_segment_vertex = current_ring_start + (s + 1) % segments;
             int vertical_vertex = next_ring_start + s;
 
-            mesh.edges.push_back(edge(current_vertex, next_segment_vertex));
-            mesh.edges.push_back(edge(current_vertex, vertical_vertex));
+            out.line(current_vertex, next_segment_vertex);
+            out.line(current_vertex, vertical_vertex);
         }
     }
 
@@ -86,19 +108,18 @@ wireframe_mesh generate_sphere(sphere_config config) {
     for (int s = 0; s < segments; s++) {
         int current_vertex = last_ring_start + s;
         int next_segment_vertex = last_ring_start + (s + 1) % segments;
-        mesh.edges.push_back(edge(current_vertex, next_segment_vertex));
+        out.line(current_vertex, next_segment_vertex);
     }
 
     for (int s = 0; s < segments; s++) {
         int vertex_index = last_ring_start + s;
-        mesh.edges.push_back(edge(vertex_index, bottom_pole_index));
+        out.line(vertex_index, bottom_pole_index);
     }
-
-    return mesh;
 }
 
-wireframe_mesh generate_box(box_dimensions dims) {
-    wireframe_mesh mesh;
+template <typename Sink>
+void emit_box(box_dimensions dims, Sink& out) {
+    out.reserve(box_size());
 
     // Half-extents
     float half_width = dims.width * 0.5f;
@@ -106,46 +127,41 @@ wireframe_mesh generate_box(box_dimensions dims) {
     float half_depth = dims.depth * 0.5f;
 
     // 8 vertices (cube corners)
-    mesh.vertices.push_back(
-        glm::vec3(-half_width, -half_height, half_depth)); // 0: front-bottom-left
-    mesh.vertices.push_back(
-        glm::vec3(half_width, -half_height, half_depth)); // 1: front-bottom-right
-    mesh.vertices.push_back(glm::vec3(-half_width, half_height, half_depth)); // 2: front-top-left
-    mesh.vertices.push_back(glm::vec3(half_width, half_height, half_depth));  // 3: front-top-right
-    mesh.vertices.push_back(
-        glm::vec3(-half_width, -half_height, -half_depth)); // 4: back-bottom-left
-    mesh.vertices.push_back(
-        glm::vec3(half_width, -half_height, -half_depth)); // 5: back-bottom-right
-    mesh.vertices.push_back(glm::vec3(-half_width, half_height, -half_depth)); // 6: back-top-left
-    mesh.vertices.push_back(glm::vec3(half_width, half_height, -half_depth));  // 7: back-top-right
+    out.vertex(glm::vec3(-half_width, -half_height, half_depth));  // 0: front-bottom-left
+    out.vertex(glm::vec3(half_width, -half_height, half_depth));   // 1: front-bottom-right
+    out.vertex(glm::vec3(-half_width, half_height, half_depth));   // 2: front-top-left
+    out.vertex(glm::vec3(half_width, half_height, half_depth));    // 3: front-top-right
+    out.vertex(glm::vec3(-half_width, -half_height, -half_depth)); // 4: back-bottom-left
+    out.vertex(glm::vec3(half_width, -half_height, -half_depth));  // 5: back-bottom-right
+    out.vertex(glm::vec3(-half_width, half_height, -half_depth));  // 6: back-top-left
+    out.vertex(glm::vec3(half_width, half_height, -half_depth));   // 7: back-top-right
 
     // 12 edges
     // Bottom quad
-    mesh.edges.push_back(edge(0, 1));
-    mesh.edges.push_back(edge(1, 5));
-    mesh.edges.push_back(edge(5, 4));
-    mesh.edges.push_back(edge(4, 0));
+    out.line(0, 1);
+    out.line(1, 5);
+    out.line(5, 4);
+    out.line(4, 0);
 
     // Top quad
-    mesh.edges.push_back(edge(2, 3));
-    mesh.edges.push_back(edge(3, 7));
-    mesh.edges.push_back(edge(7, 6));
-    mesh.edges.push_back(edge(6, 2));
+    out.line(2, 3);
+    out.line(3, 7);
+    out.line(7, 6);
+    out.line(6, 2);
 
     // Vertical pillars
-    mesh.edges.push_back(edge(0, 2));
-    mesh.edges.push_back(edge(1, 3));
-    mesh.edges.push_back(edge(5, 7));
-    mesh.edges.push_back(edge(4, 6));
-
-    return mesh;
+    out.line(0, 2);
+    out.line(1, 3);
+    out.line(5, 7);
+    out.line(4, 6);
 }
 
-wireframe_mesh generate_grid_floor(float size, int divisions) {
-    wireframe_mesh mesh;
+template <typename Sink>
+void emit_grid_floor(float size, int divisions, Sink& out) {
+    out.reserve(grid_floor_size(divisions));
 
     if (divisions <= 0) {
-        return mesh;
+        return;
     }
 
     float half_size = size * 0.5f;
@@ -156,7 +172,7 @@ wireframe_mesh generate_grid_floor(float size, int divisions) {
         for (int x = 0; x <= divisions; x++) {
             float px = -half_size + static_cast<float>(x) * step;
             float pz = -half_size + static_cast<float>(z) * step;
-            mesh.vertices.push_back(glm::vec3(px, 0.0f, pz));
+            out.vertex(glm::vec3(px, 0.0f, pz));
         }
     }
 
@@ -167,7 +183,7 @@ wireframe_mesh generate_grid_floor(float size, int divisions) {
         for (int x = 0; x < divisions; x++) {
             int v0 = z * grid_width + x;
             int v1 = z * grid_width + (x + 1);
-            mesh.edges.push_back(edge(v0, v1));
+            out.line(v0, v1);
         }
     }
 
@@ -176,29 +192,28 @@ wireframe_mesh generate_grid_floor(float size, int divisions) {
         for (int x = 0; x <= divisions; x++) {
             int v0 = z * grid_width + x;
             int v1 = (z + 1) * grid_width + x;
-            mesh.edges.push_back(edge(v0, v1));
+            out.line(v0, v1);
         }
     }
-
-    return mesh;
 }
 
-wireframe_mesh generate_arrow(const glm::vec3& start, const glm::vec3& end, float head_size) {
-    wireframe_mesh mesh;
+template <typename Sink>
+void emit_arrow(const glm::vec3& start, const glm::vec3& end, float head_size, Sink& out) {
+    out.reserve(arrow_size(start, end));
 
     glm::vec3 direction = end - start;
     float length = glm::length(direction);
 
     if (length < 0.001f) {
-        return mesh; // Degenerate arrow
+        return; // Degenerate arrow
     }
 
     direction = glm::normalize(direction);
 
     // Arrow shaft (just a line from start to end)
-    mesh.vertices.push_back(start);
-    mesh.vertices.push_back(end);
-    mesh.edges.push_back(edge(0, 1));
+    out.vertex(start);
+    out.vertex(end);
+    out.line(0, 1);
 
     // Cone head at end
     glm::vec3 perpendicular;
@@ -213,32 +228,54 @@ wireframe_mesh generate_arrow(const glm::vec3& start, const glm::vec3& end, floa
     float cone_radius = head_size * 0.3f;
 
     // 4 vertices around cone base
-    int base_start = static_cast<int>(mesh.vertices.size());
+    int base_start = 2;
     for (int i = 0; i < 4; i++) {
         float angle = static_cast<float>(i) / 4.0f * 2.0f * glm::pi<float>();
         glm::vec3 offset =
             cone_radius * (std::cos(angle) * perpendicular + std::sin(angle) * other_perp);
-        mesh.vertices.push_back(cone_base + offset);
+        out.vertex(cone_base + offset);
     }
 
     // Connect cone vertices to tip
     for (int i = 0; i < 4; i++) {
-        mesh.edges.push_back(edge(1, base_start + i));
+        out.line(1, base_start + i);
     }
 
     // Connect cone base vertices
     for (int i = 0; i < 4; i++) {
-        mesh.edges.push_back(edge(base_start + i, base_start + (i + 1) % 4));
+        out.line(base_start + i, base_start + (i + 1) % 4);
     }
+}
 
-    return mesh;
+template <typename Sink>
+void emit_arrow_head(Sink& out) {
+    out.reserve(arrow_head_size());
+
+    // Tip
+    out.vertex(glm::vec3(0.0f));
+
+    // 4 vertices around cone base (same radius ratio and angles as generate_arrow)
+    constexpr float CONE_RADIUS = 0.3f;
+    for (int i = 0; i < 4; i++) {
+        float angle = static_cast<float>(i) / 4.0f * 2.0f * glm::pi<float>();
+        out.vertex(glm::vec3(CONE_RADIUS * std::cos(angle), CONE_RADIUS * std::sin(angle), -1.0f));
+    }
+
+    // Connect cone vertices to tip, then the base ring
+    for (int i = 0; i < 4; i++) {
+        out.line(0, 1 + i);
+    }
+    for (int i = 0; i < 4; i++) {
+        out.line(1 + i, 1 + (i + 1) % 4);
+    }
 }
 
-wireframe_mesh generate_circle(const glm::vec3& center, circle_config config) {
-    wireframe_mesh mesh;
+template <typename Sink>
+void emit_circle(const glm::vec3& center, circle_config config, Sink& out) {
+    out.reserve(circle_size(config));
 
     if (config.segments <= 0) {
-        return mesh;
+        return;
     }
 
     // Generate vertices around circle (horizontal, in XZ plane)
@@ -247,24 +284,23 @@ wireframe_mesh generate_circle(const glm::vec3& center, circle_config config) {
             static_cast<float>(i) / static_cast<float>(config.segments) * 2.0f * glm::pi<float>();
         float x = center.x + config.radius * std::cos(angle);
         float z = center.z + config.radius * std::sin(angle);
-        mesh.vertices.push_back(glm::vec3(x, center.y, z));
+        out.vertex(glm::vec3(x, center.y, z));
     }
 
     // Connect adjacent vertices
     for (int i = 0; i < config.segments; i++) {
-        mesh.edges.push_back(edge(i, (i + 1) % config.segments));
+        out.line(i, (i + 1) % config.segments);
     }
-
-    return mesh;
 }
 
-wireframe_mesh generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
-                            const glm::vec3& end_dir, float radius, int segments) {
-    wireframe_mesh mesh;
+template <typename Sink>
+void emit_arc(const glm::vec3& center, const glm::vec3& start_dir, const glm::vec3& end_dir,
+              float radius, int segments, Sink& out) {
+    out.reserve(arc_size(start_dir, end_dir, radius, segments));
 
     // Runtime guards for release builds (match generate_circle pattern)
     if (segments <= 0 || radius <= 0.0f) {
-        return mesh;
+        return;
     }
 
     // Validate preconditions using project assertion macros
@@ -281,15 +317,13 @@ wireframe_mesh generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
     FL_ASSERT_IN_RANGE(segments, 3, 1024, "segments");
 
     // Compute signed angle between directions
-    float dot_product = glm::dot(start_dir, end_dir);
-    glm::vec3 cross_product = glm::cross(start_dir, end_dir);
-    float angle = std::atan2(glm::dot(cross_product, math::UP), dot_product);
+    float angle = arc_angle(start_dir, end_dir);
 
     // Handle degenerate case: nearly parallel vectors
     // For opposite vectors (180°), atan2(0, -1) = +π, selecting positive sweep
     if (std::abs(angle) < FL_EPSILON) {
         // Parallel vectors: return empty mesh (zero-angle arc is meaningless)
-        return mesh;
+        return;
     }
 
     // Build orthonormal frame for horizontal arc
@@ -302,10 +336,6 @@ wireframe_mesh generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
     // Validate orthonormal frame construction
     fl::verify_coordinate_frame(frame_x, frame_y, math::UP);
 
-    // Reserve capacity to avoid reallocation
-    mesh.vertices.reserve(segments + 1);
-    mesh.edges.reserve(segments);
-
     // Generate arc vertices: P(θ) = center + radius*(cos(θ)*X + sin(θ)*Y)
     // Parameter t ∈ [0,1] sweeps from start_dir to end_dir
     int num_vertices = segments + 1; // Include both endpoints
@@ -314,35 +344,28 @@ wireframe_mesh generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
         float theta = t * angle;
         glm::vec3 vertex =
             center + radius * (std::cos(theta) * frame_x + std::sin(theta) * frame_y);
-        mesh.vertices.push_back(vertex);
+        out.vertex(vertex);
     }
 
     // Connect vertices with edges
     for (int i = 0; i < segments; i++) {
-        mesh.edges.push_back(edge(i, i + 1));
+        out.line(i, i + 1);
     }
-
-    // Validate postconditions
-    FL_POSTCONDITION(mesh.vertices.size() == static_cast<size_t>(segments + 1),
-                     "vertex count must match segments + 1");
-    FL_POSTCONDITION(mesh.edges.size() == static_cast<size_t>(segments),
-                     "edge count must match segments");
-
-    return mesh;
 }
 
-wireframe_mesh generate_spring(const glm::vec3& start, const glm::vec3& end, int coils,
-                               float radius) {
-    wireframe_mesh mesh;
+template <typename Sink>
+void emit_spring(const glm::vec3& start, const glm::vec3& end, int coils, float radius,
+                 Sink& out) {
+    out.reserve(spring_size(start, end, coils, radius));
 
     glm::vec3 axis = end - start;
     float length = glm::length(axis);
 
     if (length < 0.0001f || coils <= 0 || radius <= 0.0f) {
-        mesh.vertices.push_back(start);
-        mesh.vertices.push_back(end);
-        mesh.edges.push_back(edge(0, 1));
-        return mesh;
+        out.vertex(start);
+        out.vertex(end);
+        out.line(0, 1);
+        return;
     }
 
     glm::vec3 direction = axis / length;
@@ -353,7 +376,6 @@ wireframe_mesh generate_spring(const glm::vec3& start, const glm::vec3& end, int
     int segments_per_coil = std::max(6, coils * 2);
     int total_segments = coils * segments_per_coil;
 
-    mesh.vertices.reserve(total_segments + 1);
     for (int i = 0; i <= total_segments; i++) {
         float t = static_cast<float>(i) / static_cast<float>(total_segments);
         float angle = t * static_cast<float>(coils) * 2.0f * glm::pi<float>();
@@ -361,14 +383,240 @@ wireframe_mesh generate_spring(const glm::vec3& start, const glm::vec3& end, int
         glm::vec3 radial =
             (std::cos(angle) * tangent + std::sin(angle) * bitangent) * (radius * envelope);
         glm::vec3 point = start + direction * (t * length) + radial;
-        mesh.vertices.push_back(point);
+        out.vertex(point);
 
         if (i > 0) {
-            mesh.edges.push_back(edge(i - 1, i));
+            out.line(i - 1, i);
         }
     }
+}
 
+// Run a generator into a new wireframe_mesh
+template <typename Emit>
+wireframe_mesh build_mesh(Emit emit) {
+    FL_MEMORY_TAG(MESH);
+    wireframe_mesh mesh;
+    mesh_sink sink{mesh};
+    emit(sink);
     return mesh;
 }
 
+// Run a generator into caller buffers; the counts written always equal its *_size()
+template <typename Index, typename Emit>
+mesh_size fill_buffers(mesh_buffers<Index> out, Emit emit) {
+    buffer_sink<Index> sink{out, {}};
+    emit(sink);
+    return sink.written;
+}
+
+} // namespace
+
+wireframe_mesh::wireframe_mesh()
+    : position(0.0f, 0.0f, 0.0f)
+    , rotation(0.0f, 0.0f, 0.0f)
+    , scale(1.0f, 1.0f, 1.0f) {}
+
+glm::mat4 wireframe_mesh::get_model_matrix() const {
+    return compute_model_matrix(position, rotation, scale);
+}
+
+glm::mat4 compute_model_matrix(const glm::vec3& position, const glm::vec3& rotation,
+                               const glm::vec3& scale) {
+    glm::mat4 model = glm::mat4(1.0f);
+
+    // Apply transformations: translate, rotate, scale
+    model = glm::translate(model, position);
+
+    // Apply rotations (X, Y, Z order)
+    model = glm::rotate(model, rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
+    model = glm::rotate(model, rotation.y, math::UP);
+    model = glm::rotate(model, rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+
+    model = glm::scale(model, scale);
+
+    return model;
+}
+
+mesh_size sphere_size(sphere_config config) {
+    if (config.radius <= 0.0f) {
+        return {1, 0};
+    }
+    size_t segments = static_cast<size_t>(std::max(3, config.segments));
+    size_t rings = static_cast<size_t>(std::max(3, config.rings));
+    return {2 + (rings - 1) * segments, (3 * segments + 2 * (rings - 2) * segments) * 2};
+}
+
+mesh_size box_size() {
+    return {8, 24};
+}
+
+mesh_size grid_floor_size(int divisions) {
+    if (divisions <= 0) {
+        return {};
+    }
+    size_t width = static_cast<size_t>(divisions) + 1;
+    return {width * width, 2 * static_cast<size_t>(divisions) * width * 2};
+}
+
+mesh_size arrow_size(const glm::vec3& start, const glm::vec3& end) {
+    if (glm::length(end - start) < 0.001f) {
+        return {};
+    }
+    return {6, 18};
+}
+
+mesh_size arrow_head_size() {
+    return {5, 16};
+}
+
+mesh_size circle_size(circle_config config) {
+    if (config.segments <= 0) {
+        return {};
+    }
+    size_t segments = static_cast<size_t>(config.segments);
+    return {segments, segments * 2};
+}
+
+mesh_size arc_size(const glm::vec3& start_dir, const glm::vec3& end_dir, float radius,
+                   int segments) {
+    if (segments <= 0 || radius <= 0.0f || std::abs(arc_angle(start_dir, end_dir)) < FL_EPSILON) {
+        return {};
+    }
+    return {static_cast<size_t>(segments) + 1, static_cast<size_t>(segments) * 2};
+}
+
+mesh_size spring_size(const glm::vec3& start, const glm::vec3& end, int coils, float radius) {
+    if (glm::length(end - start) < 0.0001f || coils <= 0 || radius <= 0.0f) {
+        return {2, 2};
+    }
+    size_t total_segments = static_cast<size_t>(coils * std::max(6, coils * 2));
+    return {total_segments + 1, total_segments * 2};
+}
+
+wireframe_mesh generate_sphere(sphere_config config) {
+    return build_mesh([&](auto& sink) { emit_sphere(config, sink); });
+}
+
+wireframe_mesh generate_box(box_dimensions dims) {
+    return build_mesh([&](auto& sink) { emit_box(dims, sink); });
+}
+
+wireframe_mesh generate_grid_floor(float size, int divisions) {
+    return build_mesh([&](auto& sink) { emit_grid_floor(size, divisions, sink); });
+}
+
+wireframe_mesh generate_arrow(const glm::vec3& start, const glm::vec3& end, float head_size) {
+    return build_mesh([&](auto& sink) { emit_arrow(start, end, head_size, sink); });
+}
+
+wireframe_mesh generate_arrow_head() {
+    return build_mesh([&](auto& sink) { emit_arrow_head(sink); });
+}
+
+bool arrow_head_transform(const glm::vec3& start, const glm::vec3& end, float head_size,
+                          glm::mat4& out) {
+    glm::vec3 direction = end - start;
+    float length = glm::length(direction);
+    if (length < 0.001f) {
+        return false; // Degenerate arrow (generate_arrow returns an empty mesh)
+    }
+    direction /= length;
+
+    // Same basis as generate_arrow
+    glm::vec3 perpendicular;
+    if (std::abs(direction.y) < 0.9f) {
+        perpendicular = glm::normalize(glm::cross(direction, math::UP));
+    } else {
+        perpendicular = glm::normalize(glm::cross(direction, glm::vec3(1, 0, 0)));
+    }
+    glm::vec3 other_perp = glm::cross(direction, perpendicular);
+
+    out = glm::mat4(1.0f);
+    out[0] = glm::vec4(perpendicular * head_size, 0.0f);
+    out[1] = glm::vec4(other_perp * head_size, 0.0f);
+    out[2] = glm::vec4(direction * head_size, 0.0f);
+    out[3] = glm::vec4(end, 1.0f);
+    return true;
+}
+
+wireframe_mesh generate_circle(const glm::vec3& center, circle_config config) {
+    return build_mesh([&](auto& sink) { emit_circle(center, config, sink); });
+}
+
+wireframe_mesh generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
+                            const glm::vec3& end_dir, float radius, int segments) {
+    return build_mesh(
+        [&](auto& sink) { emit_arc(center, start_dir, end_dir, radius, segments, sink); });
+}
+
+wireframe_mesh generate_spring(const glm::vec3& start, const glm::vec3& end, int coils,
+                               float radius) {
+    return build_mesh([&](auto& sink) { emit_spring(start, end, coils, radius, sink); });
+}
+
+template <typename Index>
+mesh_size generate_sphere(sphere_config config, mesh_buffers<Index> out) {
+    return fill_buffers(out, [&](auto& sink) { emit_sphere(config, sink); });
+}
+
+template <typename Index>
+mesh_size generate_box(box_dimensions dims, mesh_buffers<Index> out) {
+    return fill_buffers(out, [&](auto& sink) { emit_box(dims, sink); });
+}
+
+template <typename Index>
+mesh_size generate_grid_floor(float size, int divisions, mesh_buffers<Index> out) {
+    return fill_buffers(out, [&](auto& sink) { emit_grid_floor(size, divisions, sink); });
+}
+
+template <typename Index>
+mesh_size generate_arrow(const glm::vec3& start, const glm::vec3& end, float head_size,
+                         mesh_buffers<Index> out) {
+    return fill_buffers(out, [&](auto& sink) { emit_arrow(start, end, head_size, sink); });
+}
+
+template <typename Index>
+mesh_size generate_arrow_head(mesh_buffers<Index> out) {
+    return fill_buffers(out, [&](auto& sink) { emit_arrow_head(sink); });
+}
+
+template <typename Index>
+mesh_size generate_circle(const glm::vec3& center, circle_config config,
+                          mesh_buffers<Index> out) {
+    return fill_buffers(out, [&](auto& sink) { emit_circle(center, config, sink); });
+}
+
+template <typename Index>
+mesh_size generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
+                       const glm::vec3& end_dir, float radius, int segments,
+                       mesh_buffers<Index> out) {
+    return fill_buffers(
+        out, [&](auto& sink) { emit_arc(center, start_dir, end_dir, radius, segments, sink); });
+}
+
+template <typename Index>
+mesh_size generate_spring(const glm::vec3& start, const glm::vec3& end, int coils, float radius,
+                          mesh_buffers<Index> out) {
+    return fill_buffers(out, [&](auto& sink) { emit_spring(start, end, coils, radius, sink); });
+}
+
+// The two index widths the span overloads support
+#define FL_INSTANTIATE_MESH_BUFFERS(Index)                                                         \
+    template mesh_size generate_sphere(sphere_config, mesh_buffers<Index>);                        \
+    template mesh_size generate_box(box_dimensions, mesh_buffers<Index>);                          \
+    template mesh_size generate_grid_floor(float, int, mesh_buffers<Index>);                       \
+    template mesh_size generate_arrow(const glm::vec3&, const glm::vec3&, float,                   \
+                                      mesh_buffers<Index>);                                        \
+    template mesh_size generate_arrow_head(mesh_buffers<Index>);                                   \
+    template mesh_size generate_circle(const glm::vec3&, circle_config, mesh_buffers<Index>);      \
+    template mesh_size generate_arc(const glm::vec3&, const glm::vec3&, const glm::vec3&, float,   \
+                                    int, mesh_buffers<Index>);                                     \
+    template mesh_size generate_spring(const glm::vec3&, const glm::vec3&, int, float,             \
+                                       mesh_buffers<Index>);
+
+FL_INSTANTIATE_MESH_BUFFERS(uint16_t)
+FL_INSTANTIATE_MESH_BUFFERS(uint32_t)
+
+#undef FL_INSTANTIATE_MESH_BUFFERS
+
 } // namespace foundation
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <vector>
 
 namespace foundation {
@@ -29,6 +32,10 @@ struct wireframe_mesh {
     glm::mat4 get_model_matrix() const;
 };
 
+/// Model matrix: translate, rotate (X, Y, Z order), scale
+glm::mat4 compute_model_matrix(const glm::vec3& position, const glm::vec3& rotation,
+                               const glm::vec3& scale);
+
 struct sphere_config {
     int segments = 8;
     int rings = 8;
@@ -58,6 +65,16 @@ wireframe_mesh generate_grid_floor(float size = 10.0f, int divisions = 10);
 /// Generate arrow wireframe (line with cone head)
 wireframe_mesh generate_arrow(const glm::vec3& start, const glm::vec3& end, float head_size = 0.1f);
 
+/// Generate unit arrow head for instanced drawing
+/// Tip at origin pointing +Z, 4-vertex base ring at z = -1; matches generate_arrow's head for
+/// head_size = 1 when mapped onto its (perpendicular, other_perp, direction) basis
+wireframe_mesh generate_arrow_head();
+
+/// Transform placing generate_arrow_head() at the end of the arrow start -> end, matching
+/// generate_arrow's head. Returns false (out untouched) for degenerate arrows.
+bool arrow_head_transform(const glm::vec3& start, const glm::vec3& end, float head_size,
+                          glm::mat4& out);
+
 /// Generate horizontal circle wireframe
 wireframe_mesh generate_circle(const glm::vec3& center, circle_config config = {});
 
@@ -75,4 +92,65 @@ wireframe_mesh generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
 wireframe_mesh generate_spring(const glm::vec3& start, const glm::vec3& end, int coils = 6,
                                float radius = 0.05f);
 
+// Allocation-free generation
+//
+// Each generator also writes into caller-provided buffers (stack arrays, a frame arena, a
+// mapped upload buffer) as line-list indices, two per edge, in the same order as the
+// wireframe_mesh overloads. The *_size functions give the exact vertex and index counts for
+// the same arguments, so buffers can be sized before generating; the overloads assert the
+// buffers are large enough and return the counts written.
+
+struct mesh_size {
+    size_t vertices = 0;
+    size_t indices = 0; // two per edge
+};
+
+/// Output buffers for the span overloads; Index is uint16_t or uint32_t
+/// 16-bit output asserts the mesh has at most 65536 vertices
+template <typename Index>
+struct mesh_buffers {
+    std::span<glm::vec3> vertices;
+    std::span<Index> indices;
+};
+
+mesh_size sphere_size(sphere_config config = {});
+mesh_size box_size();
+mesh_size grid_floor_size(int divisions = 10);
+mesh_size arrow_size(const glm::vec3& start, const glm::vec3& end);
+mesh_size arrow_head_size();
+mesh_size circle_size(circle_config config = {});
+mesh_size arc_size(const glm::vec3& start_dir, const glm::vec3& end_dir, float radius,
+                   int segments = 32);
+mesh_size spring_size(const glm::vec3& start, const glm::vec3& end, int coils = 6,
+                      float radius = 0.05f);
+
+template <typename Index>
+mesh_size generate_sphere(sphere_config config, mesh_buffers<Index> out);
+
+template <typename Index>
+mesh_size generate_box(box_dimensions dims, mesh_buffers<Index> out);
+
+template <typename Index>
+mesh_size generate_grid_floor(float size, int divisions, mesh_buffers<Index> out);
+
+template <typename Index>
+mesh_size generate_arrow(const glm::vec3& start, const glm::vec3& end, float head_size,
+                         mesh_buffers<Index> out);
+
+template <typename Index>
+mesh_size generate_arrow_head(mesh_buffers<Index> out);
+
+template <typename Index>
+mesh_size generate_circle(const glm::vec3& center, circle_config config,
+                          mesh_buffers<Index> out);
+
+template <typename Index>
+mesh_size generate_arc(const glm::vec3& center, const glm::vec3& start_dir,
+                       const glm::vec3& end_dir, float radius, int segments,
+                       mesh_buffers<Index> out);
+
+template <typename Index>
+mesh_size generate_spring(const glm::vec3& start, const glm::vec3& end, int coils, float radius,
+                          mesh_buffers<Index> out);
+
 } // namespace foundation
@@ -0,0 +1,235 @@
+#include "foundation/profiler.h"
+
+#if FROGLORDS_PROFILE
+
+#include "foundation/debug_assert.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+namespace profiler {
+
+namespace detail {
+constinit thread_local bool recording = false;
+} // namespace detail
+
+using detail::recording;
+
+namespace {
+
+// Call-tree node accumulated across frames
+struct tree_node {
+    const char* name;
+    int parent;
+    int depth;
+    double frame_ms = 0.0; // scratch: time in the frame being accumulated
+    int frame_calls = 0;   // scratch: calls in the frame being accumulated
+    double total_ms = 0.0;
+    double max_ms = 0.0;
+    double last_ms = 0.0;
+    int last_calls = 0;
+};
+
+struct profiler_state {
+    frame_record history[FRAME_HISTORY];
+    int newest = -1; // ring index of the newest completed frame
+    int count = 0;   // completed frames in the ring
+
+    frame_record current;
+    int stack[MAX_DEPTH] = {};
+    int depth = 0;
+    bool paused = false;
+
+    // summarize() scratch, kept across calls so a panel summarizing every frame doesn't
+    // allocate once they reach the working size
+    std::vector<tree_node> summary_nodes;
+    std::vector<int> summary_zone_nodes;
+};
+
+profiler_state& state() {
+    static profiler_state instance;
+    return instance;
+}
+
+double duration_ms(const zone_record& zone) {
+    return zone.end_ns > zone.start_ns ? static_cast<double>(zone.end_ns - zone.start_ns) * 1e-6
+                                       : 0.0;
+}
+
+int find_or_add_node(std::vector<tree_node>& nodes, int parent, int depth, const char* name) {
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const tree_node& node = nodes[i];
+        if (node.parent == parent && (node.name == name || std::strcmp(node.name, name) == 0)) {
+            return static_cast<int>(i);
+        }
+    }
+    tree_node node;
+    node.name = name;
+    node.parent = parent;
+    node.depth = depth;
+    nodes.push_back(node);
+    return static_cast<int>(nodes.size() - 1);
+}
+
+void append_depth_first(const std::vector<tree_node>& nodes, int parent, int frames,
+                        std::vector<zone_summary>& out) {
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const tree_node& node = nodes[i];
+        if (node.parent != parent) {
+            continue;
+        }
+
+        zone_summary summary;
+        summary.name = node.name;
+        summary.depth = node.depth;
+        summary.last_ms = node.last_ms;
+        summary.avg_ms = node.total_ms / static_cast<double>(frames);
+        summary.max_ms = node.max_ms;
+        summary.last_calls = node.last_calls;
+        out.push_back(summary);
+
+        append_depth_first(nodes, static_cast<int>(i), frames, out);
+    }
+}
+
+} // namespace
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void begin_frame() {
+    profiler_state& s = state();
+    FL_PRECONDITION(!recording, "profiler frame already open");
+
+    if (s.current.zones.capacity() < MAX_ZONES_PER_FRAME) {
+        s.current.zones.reserve(MAX_ZONES_PER_FRAME);
+    }
+    s.current.zones.clear();
+    s.current.dropped_zones = 0;
+    s.current.start_ns = now_ns();
+    s.current.end_ns = 0;
+    s.depth = 0;
+    recording = true;
+    trace::zone_begin("frame");
+}
+
+void end_frame() {
+    profiler_state& s = state();
+    FL_PRECONDITION(recording, "profiler frame not open");
+    FL_ASSERT(s.depth == 0, "profiler zones still open at end of frame");
+
+    trace::zone_end("frame");
+    s.current.end_ns = now_ns();
+    recording = false;
+
+    if (s.paused) {
+        return;
+    }
+
+    // Swap into the ring; the evicted frame's zone storage is reused for the next frame
+    s.newest = (s.newest + 1) % FRAME_HISTORY;
+    std::swap(s.history[s.newest], s.current);
+    s.count = std::min(s.count + 1, FRAME_HISTORY);
+}
+
+int begin_zone(const char* name) {
+    if (!recording) {
+        return -1;
+    }
+
+    profiler_state& s = state();
+    auto& zones = s.current.zones;
+    if (s.depth >= MAX_DEPTH || zones.size() >= static_cast<size_t>(MAX_ZONES_PER_FRAME)) {
+        s.current.dropped_zones++;
+        return -1;
+    }
+
+    zone_record zone;
+    zone.name = name;
+    zone.depth = s.depth;
+    zone.parent = s.depth > 0 ? s.stack[s.depth - 1] : -1;
+    int handle = static_cast<int>(zones.size());
+    s.stack[s.depth++] = handle;
+    zone.start_ns = now_ns();
+    zones.push_back(zone);
+    return handle;
+}
+
+void end_zone(int handle) {
+    if (handle < 0 || !recording) {
+        return;
+    }
+
+    profiler_state& s = state();
+    FL_ASSERT(s.depth > 0 && s.stack[s.depth - 1] == handle, "profiler zones must nest");
+    s.current.zones[static_cast<size_t>(handle)].end_ns = now_ns();
+    s.depth--;
+}
+
+void set_paused(bool paused) {
+    state().paused = paused;
+}
+
+bool is_paused() {
+    return state().paused;
+}
+
+int frame_count() {
+    return state().count;
+}
+
+const frame_record& frame(int frames_ago) {
+    const profiler_state& s = state();
+    FL_PRECONDITION(frames_ago >= 0 && frames_ago < s.count, "frame index out of range");
+    int index = (s.newest - frames_ago + FRAME_HISTORY) % FRAME_HISTORY;
+    return s.history[index];
+}
+
+void summarize(std::vector<zone_summary>& out, int history_frames) {
+    out.clear();
+    int frames = std::min(history_frames, frame_count());
+    if (frames <= 0) {
+        return;
+    }
+
+    std::vector<tree_node>& nodes = state().summary_nodes;
+    std::vector<int>& zone_nodes = state().summary_zone_nodes;
+    nodes.clear();
+
+    // Oldest first so node creation order (and therefore sibling order) follows first use
+    for (int ago = frames - 1; ago >= 0; --ago) {
+        const frame_record& f = frame(ago);
+        zone_nodes.resize(f.zones.size());
+
+        for (size_t i = 0; i < f.zones.size(); ++i) {
+            const zone_record& zone = f.zones[i];
+            int parent_node =
+                zone.parent >= 0 ? zone_nodes[static_cast<size_t>(zone.parent)] : -1;
+            int node = find_or_add_node(nodes, parent_node, zone.depth, zone.name);
+            zone_nodes[i] = node;
+            nodes[static_cast<size_t>(node)].frame_ms += duration_ms(zone);
+            nodes[static_cast<size_t>(node)].frame_calls++;
+        }
+
+        for (tree_node& node : nodes) {
+            node.total_ms += node.frame_ms;
+            node.max_ms = std::max(node.max_ms, node.frame_ms);
+            if (ago == 0) {
+                node.last_ms = node.frame_ms;
+                node.last_calls = node.frame_calls;
+            }
+            node.frame_ms = 0.0;
+            node.frame_calls = 0;
+        }
+    }
+
+    append_depth_first(nodes, -1, frames, out);
+}
+
+} // namespace profiler
+
+#endif
@@ -0,0 +1,127 @@
+#pragma once
+
+// Hierarchical CPU frame profiler
+//
+// FL_PROFILE_ZONE("name") times the enclosing scope. Zones nest by scope, so each frame
+// records a call tree: name, depth, parent and start/end timestamps per zone. The last
+// FRAME_HISTORY frames are kept in a ring buffer for the Debug Panel. While a trace capture
+// runs (foundation/trace.h), zones and frames are also recorded as trace events.
+//
+// Only the thread that calls FL_PROFILE_FRAME_BEGIN records; zones on other threads and
+// zones outside a frame (headless runs, benchmarks) cost one branch and are ignored.
+//
+// Compiled out completely when FROGLORDS_PROFILE is 0 (CMake: -DFROGLORDS_PROFILER=OFF):
+// the macros expand to nothing and the profiler API is not declared.
+//
+// Usage:
+//   FL_PROFILE_FRAME_BEGIN();
+//   { FL_PROFILE_ZONE("game_world::update"); world.update(dt, input); }
+//   FL_PROFILE_FRAME_END();
+
+#ifndef FROGLORDS_PROFILE
+#define FROGLORDS_PROFILE 0
+#endif
+
+#if FROGLORDS_PROFILE
+
+#include "foundation/trace.h"
+#include <cstdint>
+#include <vector>
+
+namespace profiler {
+
+constexpr int FRAME_HISTORY = 120;       // frames kept for the panel (~2 seconds at 60Hz)
+constexpr int MAX_ZONES_PER_FRAME = 512; // later zones in a frame are counted as dropped
+constexpr int MAX_DEPTH = 32;            // deeper zones are counted as dropped
+
+struct zone_record {
+    const char* name = nullptr; // string literal (compared by content when aggregating)
+    uint64_t start_ns = 0;
+    uint64_t end_ns = 0;
+    int depth = 0;   // 0 = top level within the frame
+    int parent = -1; // index of the enclosing zone in the same frame, -1 at top level
+};
+
+struct frame_record {
+    uint64_t start_ns = 0;
+    uint64_t end_ns = 0;
+    std::vector<zone_record> zones; // begin order (parents precede their children)
+    int dropped_zones = 0;
+};
+
+// Aggregated call-tree node: zones with the same name under the same parent node
+struct zone_summary {
+    const char* name = nullptr;
+    int depth = 0;
+    double last_ms = 0.0; // total time in the newest frame
+    double avg_ms = 0.0;  // mean per frame over the summarized history
+    double max_ms = 0.0;  // worst frame over the summarized history
+    int last_calls = 0;   // calls in the newest frame
+};
+
+// Monotonic clock in nanoseconds
+uint64_t now_ns();
+
+void begin_frame();
+void end_frame();
+
+// Zone bookkeeping used by scoped_zone; returns a handle for end_zone (-1 = not recorded)
+int begin_zone(const char* name);
+void end_zone(int handle);
+
+// Paused: frames still run but the history is frozen for inspection
+void set_paused(bool paused);
+bool is_paused();
+
+// Completed frames in the history (at most FRAME_HISTORY)
+int frame_count();
+
+// Completed frame, 0 = newest
+const frame_record& frame(int frames_ago);
+
+// Call tree over the newest `history_frames` frames, depth-first order (parents first)
+void summarize(std::vector<zone_summary>& out, int history_frames = FRAME_HISTORY);
+
+namespace detail {
+// Set on the frame thread between begin_frame and end_frame. Checked inline so a zone that
+// isn't recording costs one thread-local load and branch, not a call.
+extern constinit thread_local bool recording;
+} // namespace detail
+
+class scoped_zone {
+  public:
+    explicit scoped_zone(const char* zone_name)
+        : name(zone_name), handle(detail::recording ? begin_zone(zone_name) : -1) {
+        trace::zone_begin(name);
+    }
+    ~scoped_zone() {
+        trace::zone_end(name);
+        if (handle >= 0) {
+            end_zone(handle);
+        }
+    }
+
+    scoped_zone(const scoped_zone&) = delete;
+    scoped_zone& operator=(const scoped_zone&) = delete;
+
+  private:
+    const char* name;
+    int handle;
+};
+
+} // namespace profiler
+
+#define FL_PROFILE_CONCAT_INNER(a, b) a##b
+#define FL_PROFILE_CONCAT(a, b) FL_PROFILE_CONCAT_INNER(a, b)
+#define FL_PROFILE_ZONE(name)                                                                      \
+    ::profiler::scoped_zone FL_PROFILE_CONCAT(fl_profile_zone_, __LINE__)(name)
+#define FL_PROFILE_FRAME_BEGIN() ::profiler::begin_frame()
+#define FL_PROFILE_FRAME_END() ::profiler::end_frame()
+
+#else
+
+#define FL_PROFILE_ZONE(name) ((void)0)
+#define FL_PROFILE_FRAME_BEGIN() ((void)0)
+#define FL_PROFILE_FRAME_END() ((void)0)
+
+#endif
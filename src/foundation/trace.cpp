@@ -0,0 +1,250 @@
+#include "foundation/trace.h"
+
+#if FROGLORDS_PROFILE
+
+#include "foundation/debug_assert.h"
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace trace {
+
+namespace detail {
+std::atomic<uint32_t> active_generation{0};
+constinit thread_local thread_writer writer;
+} // namespace detail
+
+namespace {
+
+using detail::trace_event;
+
+// One per thread that ever recorded. Only the owning thread writes events and count; readers
+// take count with acquire and only look at events below it.
+struct thread_buffer {
+    std::unique_ptr<trace_event[]> events;
+    uint32_t capacity = 0;
+    std::atomic<uint32_t> count{0};
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<uint32_t> generation{0}; // capture this buffer's contents belong to
+    int thread_id = 0;
+    std::string name;
+};
+
+struct capture_clock {
+    uint64_t ticks = 0;
+    std::chrono::steady_clock::time_point time;
+};
+
+struct trace_state {
+    std::mutex mutex; // guards buffers and capture bookkeeping (never taken per event)
+    std::vector<std::unique_ptr<thread_buffer>> buffers;
+    std::atomic<uint32_t> generation{0};
+    uint32_t events_per_thread = DEFAULT_EVENTS_PER_THREAD;
+
+    capture_clock start;
+    capture_clock stop;
+    bool has_stopped_capture = false;
+};
+
+trace_state& state() {
+    static trace_state instance;
+    return instance;
+}
+
+thread_local thread_buffer* local_buffer = nullptr;
+
+capture_clock sample_clock() {
+    capture_clock clock;
+    clock.time = std::chrono::steady_clock::now();
+    clock.ticks = detail::timestamp();
+    return clock;
+}
+
+// Slow path: first event on this thread, or first event of a new capture
+thread_buffer* acquire_buffer(uint32_t generation) {
+    trace_state& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    if (local_buffer == nullptr) {
+        auto buffer = std::make_unique<thread_buffer>();
+        buffer->thread_id = static_cast<int>(s.buffers.size()) + 1;
+        buffer->name = "thread " + std::to_string(buffer->thread_id);
+        local_buffer = buffer.get();
+        s.buffers.push_back(std::move(buffer));
+    }
+
+    thread_buffer* buffer = local_buffer;
+    if (buffer->capacity != s.events_per_thread) {
+        // Default-initialized (not zeroed): only slots below count are ever read
+        buffer->events.reset(new trace_event[s.events_per_thread]);
+        buffer->capacity = s.events_per_thread;
+    }
+    buffer->count.store(0, std::memory_order_relaxed);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+    buffer->generation.store(generation, std::memory_order_release);
+
+    detail::writer = {buffer->events.get(), &buffer->count, 0, buffer->capacity, generation};
+    return buffer;
+}
+
+void write_escaped(std::FILE* file, const char* text) {
+    std::fputc('"', file);
+    for (const char* c = text; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(*c, file);
+    }
+    std::fputc('"', file);
+}
+
+} // namespace
+
+namespace detail {
+
+void record_slow(uint32_t generation, const char* name, char phase) {
+    if (writer.generation != generation) {
+        acquire_buffer(generation);
+    }
+    if (writer.next >= writer.capacity) {
+        local_buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    writer.events[writer.next] = {name, timestamp(), phase};
+    writer.count->store(++writer.next, std::memory_order_release);
+}
+
+} // namespace detail
+
+void start_capture(uint32_t events_per_thread) {
+    FL_PRECONDITION(events_per_thread > 0, "events_per_thread must be positive");
+
+    trace_state& s = state();
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.events_per_thread = events_per_thread;
+        s.has_stopped_capture = false;
+    }
+    // New generation: each thread resets its own buffer on its next event. 0 means "not
+    // capturing", so skip it if the counter ever wraps.
+    uint32_t generation = s.generation.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (generation == 0) {
+        generation = s.generation.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // The capturing thread is the one certain to record: set up its buffer now so the
+    // allocation doesn't land inside the capture
+    acquire_buffer(generation);
+
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.start = sample_clock();
+    }
+    detail::active_generation.store(generation, std::memory_order_release);
+}
+
+void stop_capture() {
+    if (detail::active_generation.exchange(0, std::memory_order_acq_rel) == 0) {
+        return;
+    }
+
+    trace_state& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.stop = sample_clock();
+    s.has_stopped_capture = true;
+}
+
+bool is_capturing() {
+    return detail::active_generation.load(std::memory_order_relaxed) != 0;
+}
+
+capture_stats stats() {
+    trace_state& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    uint32_t generation = s.generation.load(std::memory_order_relaxed);
+
+    capture_stats result;
+    for (const auto& buffer : s.buffers) {
+        if (buffer->generation.load(std::memory_order_acquire) != generation) {
+            continue;
+        }
+        result.events += buffer->count.load(std::memory_order_acquire);
+        result.dropped += buffer->dropped.load(std::memory_order_relaxed);
+        result.threads++;
+    }
+    return result;
+}
+
+void set_thread_name(const char* name) {
+    FL_PRECONDITION(name != nullptr, "thread name must not be null");
+
+    trace_state& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (local_buffer == nullptr) {
+        // Register without events (generation 0 never matches a capture) so the name sticks
+        auto buffer = std::make_unique<thread_buffer>();
+        buffer->thread_id = static_cast<int>(s.buffers.size()) + 1;
+        local_buffer = buffer.get();
+        s.buffers.push_back(std::move(buffer));
+    }
+    local_buffer->name = name;
+}
+
+bool write_chrome_json(const char* path) {
+    trace_state& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (!s.has_stopped_capture) {
+        return false;
+    }
+
+    std::FILE* file = std::fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+
+    // Ticks → microseconds from the clock pair sampled at capture start and stop
+    double elapsed_us =
+        std::chrono::duration<double, std::micro>(s.stop.time - s.start.time).count();
+    double elapsed_ticks = static_cast<double>(s.stop.ticks - s.start.ticks);
+    double us_per_tick = elapsed_ticks > 0.0 ? elapsed_us / elapsed_ticks : 0.0;
+
+    uint32_t generation = s.generation.load(std::memory_order_relaxed);
+    std::fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    bool first = true;
+    for (const auto& buffer : s.buffers) {
+        if (buffer->generation.load(std::memory_order_acquire) != generation) {
+            continue;
+        }
+
+        std::fprintf(file,
+                     "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, "
+                     "\"args\": {\"name\": ",
+                     first ? "" : ",\n", buffer->thread_id);
+        write_escaped(file, buffer->name.c_str());
+        std::fprintf(file, "}}");
+        first = false;
+
+        uint32_t count = buffer->count.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i) {
+            const trace_event& e = buffer->events[i];
+            // Signed: an event stamped just before start_capture sampled its clock
+            double ts = static_cast<double>(static_cast<int64_t>(e.ticks - s.start.ticks)) *
+                        us_per_tick;
+            std::fprintf(file, ",\n{\"name\": ");
+            write_escaped(file, e.name);
+            std::fprintf(file, ", \"ph\": \"%c\", \"ts\": %.3f, \"pid\": 1, \"tid\": %d%s}",
+                         e.phase, ts, buffer->thread_id, e.phase == 'i' ? ", \"s\": \"t\"" : "");
+        }
+    }
+    std::fprintf(file, "\n]}\n");
+
+    bool ok = std::ferror(file) == 0;
+    ok = std::fclose(file) == 0 && ok;
+    return ok;
+}
+
+} // namespace trace
+
+#endif
@@ -0,0 +1,140 @@
+#pragma once
+
+// Trace capture: zone begin/end and instant events exported as Chrome trace JSON
+//
+// While a capture is running, every FL_PROFILE_ZONE also appends a begin and an end event to
+// a per-thread buffer, and FL_TRACE_INSTANT marks one-off simulation events (dropped ticks,
+// hitches). Each thread writes only its own preallocated buffer and publishes the count with
+// a release store, so recording takes no locks; a full buffer drops further events and
+// counts them. Timestamps are raw CPU ticks (rdtsc on x86) converted to wall time at export.
+//
+// Recording is inline: one atomic load of the running capture, a compare against the
+// thread's cached capture, and the store. Only a thread's first event of a capture and
+// events into a full buffer call into trace.cpp.
+//
+// Open the written file in chrome://tracing or https://ui.perfetto.dev.
+//
+// Compiled out with the profiler (FROGLORDS_PROFILE = 0).
+//
+// Usage:
+//   trace::start_capture();
+//   ... frames ...
+//   trace::stop_capture();
+//   trace::write_chrome_json("froglords_trace.json");
+
+#ifndef FROGLORDS_PROFILE
+#define FROGLORDS_PROFILE 0
+#endif
+
+#if FROGLORDS_PROFILE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define FL_TRACE_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define FL_TRACE_RDTSC 1
+#else
+#define FL_TRACE_RDTSC 0
+#endif
+
+namespace trace {
+
+constexpr uint32_t DEFAULT_EVENTS_PER_THREAD = 1u << 20; // 24 MiB per recording thread
+
+struct capture_stats {
+    uint32_t events = 0;  // recorded across all threads
+    uint32_t dropped = 0; // lost to full buffers
+    int threads = 0;      // threads that recorded at least one event
+};
+
+// Begin a capture (discarding any previous one); each thread's buffer holds this many events
+void start_capture(uint32_t events_per_thread = DEFAULT_EVENTS_PER_THREAD);
+void stop_capture();
+bool is_capturing();
+
+// Counts for the newest capture (running or stopped)
+capture_stats stats();
+
+// Name shown for the calling thread's track (call once per thread; copied)
+void set_thread_name(const char* name);
+
+// Write the newest stopped capture; returns false if none exists or the file can't be written
+bool write_chrome_json(const char* path);
+
+namespace detail {
+
+struct trace_event {
+    const char* name;
+    uint64_t ticks;
+    char phase; // 'B' begin, 'E' end, 'i' instant
+};
+
+// The calling thread's write position in its buffer for capture `generation`
+struct thread_writer {
+    trace_event* events = nullptr;
+    std::atomic<uint32_t>* count = nullptr; // published to readers
+    uint32_t next = 0;
+    uint32_t capacity = 0;
+    uint32_t generation = 0; // 0 never matches a capture
+};
+
+// Generation of the running capture, 0 when none is running
+extern std::atomic<uint32_t> active_generation;
+extern constinit thread_local thread_writer writer;
+
+// First event of a capture on this thread, or an event into a full buffer
+void record_slow(uint32_t generation, const char* name, char phase);
+
+// Cheapest monotonic tick source available; scaled to wall time at export
+inline uint64_t timestamp() {
+#if FL_TRACE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+inline void record(const char* name, char phase) {
+    uint32_t generation = active_generation.load(std::memory_order_relaxed);
+    if (generation == 0) {
+        return;
+    }
+    thread_writer& w = writer;
+    if (w.generation != generation || w.next >= w.capacity) {
+        record_slow(generation, name, phase);
+        return;
+    }
+    w.events[w.next] = {name, timestamp(), phase};
+    w.count->store(++w.next, std::memory_order_release);
+}
+
+} // namespace detail
+
+inline void zone_begin(const char* name) {
+    detail::record(name, 'B');
+}
+
+inline void zone_end(const char* name) {
+    detail::record(name, 'E');
+}
+
+inline void instant(const char* name) {
+    detail::record(name, 'i');
+}
+
+} // namespace trace
+
+#define FL_TRACE_INSTANT(name) ::trace::instant(name)
+#define FL_TRACE_THREAD_NAME(name) ::trace::set_thread_name(name)
+
+#else
+
+#define FL_TRACE_INSTANT(name) ((void)0)
+#define FL_TRACE_THREAD_NAME(name) ((void)0)
+
+#endif
@@ -18,11 +18,12 @@ enum class camera_parameter_type {
     MIN_DISTANCE,
     MAX_DISTANCE,
     MODE,
+    AVOID_OCCLUSION,
 };
 
 struct camera_command {
     camera_parameter_type type;
-    float value;      // Used for numeric parameters
+    float value;      // Used for numeric parameters (AVOID_OCCLUSION: 1 on, 0 off)
     camera_mode mode; // Used for MODE parameter
 };
 
@@ -83,6 +83,14 @@ std::vector<camera_command> draw_camera_panel(const camera_panel_state& state, c
                            "Warning: Min Distance must be <= Max Distance");
     }
 
+    ImGui::Spacing();
+
+    bool avoid_occlusion = cam_follow.avoid_occlusion;
+    if (ImGui::Checkbox("Avoid Occlusion", &avoid_occlusion)) {
+        commands.push_back(
+            {camera_parameter_type::AVOID_OCCLUSION, avoid_occlusion ? 1.0f : 0.0f});
+    }
+
     return commands;
 }
 
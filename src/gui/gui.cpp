@@ -1,5 +1,7 @@
 #include "gui.h"
 #include "foundation/debug_assert.h"
+#include "foundation/memory_tracking.h"
+#include "foundation/profiler.h"
 #include "sokol_gfx.h"
 #include "sokol_log.h"
 #include "imgui.h"
@@ -23,17 +25,40 @@ struct plot_buffer {
 
 static std::map<std::string, plot_buffer> plot_buffers;
 
+#if FROGLORDS_MEMORY_TRACKING
+namespace {
+
+// Dear ImGui allocates with malloc by default, out of the tracker's sight
+void* imgui_alloc(size_t size, void*) {
+    return ::operator new(size);
+}
+
+void imgui_free(void* p, void*) {
+    ::operator delete(p);
+}
+
+} // namespace
+#endif
+
 void init() {
+    FL_MEMORY_TAG(GUI);
+#if FROGLORDS_MEMORY_TRACKING
+    // Before simgui_setup creates the context
+    ImGui::SetAllocatorFunctions(imgui_alloc, imgui_free);
+#endif
     simgui_desc_t desc = {};
     desc.logger.func = slog_func;
     simgui_setup(&desc);
 }
 
 void begin_frame() {
+    FL_MEMORY_TAG(GUI);
     simgui_new_frame({sapp_width(), sapp_height(), sapp_frame_duration(), sapp_dpi_scale()});
 }
 
 void render() {
+    FL_PROFILE_ZONE("gui::render");
+    FL_MEMORY_TAG(GUI);
     simgui_render();
 }
 
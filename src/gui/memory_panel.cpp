@@ -0,0 +1,83 @@
+#include "gui/memory_panel.h"
+#include "foundation/memory_tracking.h"
+#include <imgui.h>
+
+namespace gui {
+
+#if FROGLORDS_MEMORY_TRACKING
+
+void draw_memory_panel(memory_panel_state& state) {
+    if (!state.show)
+        return;
+
+    if (!ImGui::CollapsingHeader("Memory"))
+        return;
+
+    ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                            ImGuiTableFlags_SizingFixedFit;
+    if (!ImGui::BeginTable("memory_tags", 5, flags))
+        return;
+
+    ImGui::TableSetupColumn("Tag");
+    ImGui::TableSetupColumn("live KB");
+    ImGui::TableSetupColumn("peak KB");
+    ImGui::TableSetupColumn("live allocs");
+    ImGui::TableSetupColumn("allocs/frame");
+    ImGui::TableHeadersRow();
+
+    // Totals: the per-tag peaks were reached at different times, so no total peak column
+    memory::tag_stats total;
+    for (int i = 0; i < memory::TAG_COUNT; ++i) {
+        memory::tag t = static_cast<memory::tag>(i);
+        memory::tag_stats stats = memory::stats(t);
+        total.live_bytes += stats.live_bytes;
+        total.live_allocations += stats.live_allocations;
+        total.frame_allocations += stats.frame_allocations;
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(memory::tag_name(t));
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", static_cast<double>(stats.live_bytes) / 1024.0);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", static_cast<double>(stats.peak_bytes) / 1024.0);
+        ImGui::TableNextColumn();
+        ImGui::Text("%llu", static_cast<unsigned long long>(stats.live_allocations));
+        ImGui::TableNextColumn();
+        if (stats.frame_allocations > 0) {
+            // Steady-state frames should not allocate: make churn stand out
+            ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "%llu",
+                               static_cast<unsigned long long>(stats.frame_allocations));
+        } else {
+            ImGui::TextDisabled("0");
+        }
+    }
+
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::TextUnformatted("total");
+    ImGui::TableNextColumn();
+    ImGui::Text("%.1f", static_cast<double>(total.live_bytes) / 1024.0);
+    ImGui::TableNextColumn();
+    ImGui::TableNextColumn();
+    ImGui::Text("%llu", static_cast<unsigned long long>(total.live_allocations));
+    ImGui::TableNextColumn();
+    ImGui::Text("%llu", static_cast<unsigned long long>(total.frame_allocations));
+
+    ImGui::EndTable();
+}
+
+#else
+
+void draw_memory_panel(memory_panel_state& state) {
+    if (!state.show)
+        return;
+
+    if (ImGui::CollapsingHeader("Memory")) {
+        ImGui::TextDisabled("Memory tracking compiled out (FROGLORDS_MEMORY_TRACKING=OFF)");
+    }
+}
+
+#endif
+
+} // namespace gui
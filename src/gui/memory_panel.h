@@ -0,0 +1,13 @@
+#pragma once
+
+namespace gui {
+
+struct memory_panel_state {
+    bool show = true;
+};
+
+// Per-subsystem heap table (live KB, peak KB, live allocations, allocations last frame) from
+// the tagged allocation tracker. Only populated when built with FROGLORDS_MEMORY_TRACKING=ON.
+void draw_memory_panel(memory_panel_state& state);
+
+} // namespace gui
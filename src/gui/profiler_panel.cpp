@@ -0,0 +1,184 @@
+#include "gui/profiler_panel.h"
+#include "foundation/profiler.h"
+#include "foundation/trace.h"
+#include <imgui.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace gui {
+
+#if FROGLORDS_PROFILE
+
+namespace {
+
+constexpr float FLAME_ROW_HEIGHT = 18.0f; // pixels
+
+// Stable per-name color so a zone keeps its color across frames
+ImU32 zone_color(const char* name) {
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (const char* c = name; *c != '\0'; ++c) {
+        hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+    }
+    float r = 0.35f + 0.4f * static_cast<float>(hash & 0xFF) / 255.0f;
+    float g = 0.35f + 0.4f * static_cast<float>((hash >> 8) & 0xFF) / 255.0f;
+    float b = 0.35f + 0.4f * static_cast<float>((hash >> 16) & 0xFF) / 255.0f;
+    return ImGui::ColorConvertFloat4ToU32(ImVec4(r, g, b, 1.0f));
+}
+
+void draw_zone_table(const std::vector<profiler::zone_summary>& summary) {
+    ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                            ImGuiTableFlags_SizingFixedFit;
+    if (!ImGui::BeginTable("profiler_zones", 5, flags))
+        return;
+
+    ImGui::TableSetupColumn("Zone");
+    ImGui::TableSetupColumn("ms");
+    ImGui::TableSetupColumn("avg ms");
+    ImGui::TableSetupColumn("max ms");
+    ImGui::TableSetupColumn("calls");
+    ImGui::TableHeadersRow();
+
+    for (const auto& zone : summary) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::Text("%*s%s", zone.depth * 2, "", zone.name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", zone.last_ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", zone.avg_ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", zone.max_ms);
+        ImGui::TableNextColumn();
+        ImGui::Text("%d", zone.last_calls);
+    }
+
+    ImGui::EndTable();
+}
+
+// Newest frame as nested bars: x = time within the frame, y = zone depth
+void draw_flame_view(const profiler::frame_record& frame) {
+    int max_depth = 0;
+    for (const auto& zone : frame.zones) {
+        max_depth = std::max(max_depth, zone.depth);
+    }
+
+    float width = std::max(ImGui::GetContentRegionAvail().x, 100.0f);
+    float height = static_cast<float>(max_depth + 1) * FLAME_ROW_HEIGHT;
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::Dummy(ImVec2(width, height));
+
+    double frame_ns = static_cast<double>(frame.end_ns - frame.start_ns);
+    if (frame_ns <= 0.0)
+        return;
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height),
+                             IM_COL32(30, 30, 30, 255));
+
+    auto to_x = [&](uint64_t ns) {
+        double t = static_cast<double>(ns - frame.start_ns) / frame_ns;
+        return origin.x + width * static_cast<float>(t);
+    };
+
+    for (const auto& zone : frame.zones) {
+        float x0 = to_x(zone.start_ns);
+        float x1 = std::max(to_x(zone.end_ns), x0 + 1.0f); // keep very short zones visible
+        float y0 = origin.y + static_cast<float>(zone.depth) * FLAME_ROW_HEIGHT;
+        float y1 = y0 + FLAME_ROW_HEIGHT - 1.0f;
+
+        draw_list->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), zone_color(zone.name));
+
+        // Label only when the bar is wide enough to hold it
+        ImVec2 text_size = ImGui::CalcTextSize(zone.name);
+        if (text_size.x + 4.0f < x1 - x0) {
+            draw_list->AddText(ImVec2(x0 + 2.0f, y0 + 1.0f), IM_COL32(0, 0, 0, 255), zone.name);
+        }
+
+        if (ImGui::IsMouseHoveringRect(ImVec2(x0, y0), ImVec2(x1, y1))) {
+            double ms = static_cast<double>(zone.end_ns - zone.start_ns) * 1e-6;
+            ImGui::SetTooltip("%s\n%.3f ms", zone.name, ms);
+        }
+    }
+}
+
+bool draw_trace_controls(const profiler_panel_state& state) {
+    bool toggle_requested = false;
+    if (trace::is_capturing()) {
+        toggle_requested = ImGui::Button("Stop Trace & Save");
+        trace::capture_stats capture = trace::stats();
+        ImGui::SameLine();
+        ImGui::Text("Recording: %u events", capture.events);
+        if (capture.dropped > 0) {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Buffer full: %u events dropped",
+                               capture.dropped);
+        }
+    } else {
+        toggle_requested = ImGui::Button("Start Trace Capture");
+        ImGui::SameLine();
+        ImGui::TextDisabled("(F4)");
+    }
+    if (!state.trace_status.empty()) {
+        ImGui::TextWrapped("%s", state.trace_status.c_str());
+    }
+    return toggle_requested;
+}
+
+} // namespace
+
+bool draw_profiler_panel(profiler_panel_state& state) {
+    if (!state.show)
+        return false;
+
+    if (!ImGui::CollapsingHeader("Profiler"))
+        return false;
+
+    bool toggle_trace = draw_trace_controls(state);
+    ImGui::Spacing();
+
+    if (ImGui::Checkbox("Pause", &state.paused)) {
+        profiler::set_paused(state.paused);
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(120.0f);
+    ImGui::SliderInt("Avg Frames", &state.history_frames, 1, profiler::FRAME_HISTORY, "%d",
+                     ImGuiSliderFlags_AlwaysClamp);
+
+    if (profiler::frame_count() == 0) {
+        ImGui::TextDisabled("No frames recorded");
+        return toggle_trace;
+    }
+
+    const profiler::frame_record& newest = profiler::frame(0);
+    double frame_ms = static_cast<double>(newest.end_ns - newest.start_ns) * 1e-6;
+    ImGui::Text("Frame: %.3f ms  Zones: %d", frame_ms, static_cast<int>(newest.zones.size()));
+    if (newest.dropped_zones > 0) {
+        ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Dropped zones: %d",
+                           newest.dropped_zones);
+    }
+
+    // Reused across frames: the table rebuilds every frame the panel is open
+    static std::vector<profiler::zone_summary> summary;
+    profiler::summarize(summary, state.history_frames);
+    draw_zone_table(summary);
+
+    ImGui::Spacing();
+    draw_flame_view(newest);
+    return toggle_trace;
+}
+
+#else
+
+bool draw_profiler_panel(profiler_panel_state& state) {
+    if (!state.show)
+        return false;
+
+    if (ImGui::CollapsingHeader("Profiler")) {
+        ImGui::TextDisabled("Profiler compiled out (FROGLORDS_PROFILER=OFF)");
+    }
+    return false;
+}
+
+#endif
+
+} // namespace gui
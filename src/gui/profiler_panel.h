@@ -0,0 +1,18 @@
+#pragma once
+#include <string>
+
+namespace gui {
+
+struct profiler_panel_state {
+    bool show = true;
+    bool paused = false;
+    int history_frames = 60;  // frames averaged in the zone table
+    std::string trace_status; // result of the last trace capture (set by the runtime)
+};
+
+// Per-zone table (last frame ms, average, worst, calls) and a flame view of the newest frame,
+// plus trace capture controls. Reads the profiler history; pausing freezes it for inspection.
+// Returns true when the user asked to start or stop (and save) a trace capture.
+bool draw_profiler_panel(profiler_panel_state& state);
+
+} // namespace gui
@@ -0,0 +1,259 @@
+// Headless simulation driver
+//
+// Ticks game_world at a fixed timestep from scripted input with no window, renderer or GUI.
+// Intended for soak and tuning runs on CPU-only machines.
+//
+// Usage:
+//   froglords_headless [--ticks N] [--dt SECONDS] [--script PATH] [--warmup N] [--debug-primitives]
+//                      [--trace PATH] [--level PATH] [--stream MANIFEST] [--stress NAME]
+//
+// --trace captures the profiler zones of the timed ticks and writes them as Chrome trace JSON.
+// --level replaces the built-in test level with a compiled level file (.flvl).
+// --stream streams a chunked level around the character and reports streaming stats.
+// --stress generates a named stress level, e.g. city/100000 or clutter/1m/7 (see
+// stress_level.h), so runs on different machines simulate the same scene. Collision only:
+// no outline meshes are generated.
+
+#include "app/game_world.h"
+#include "app/debug_generation.h"
+#include "app/input_script.h"
+#include "app/stress_level.h"
+#include "foundation/memory_tracking.h"
+#include "foundation/profiler.h"
+#include "foundation/trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+// Trace buffer sizing: a tick records roughly a dozen zone events
+constexpr long long TRACE_EVENTS_PER_TICK = 16;
+constexpr long long MAX_TRACE_EVENTS = 1LL << 23; // 192 MiB of events
+
+struct headless_options {
+    long long ticks = 100000;
+    long long warmup_ticks = 0;
+    float dt = 1.0f / 60.0f; // seconds
+    const char* script_path = nullptr;
+    bool debug_primitives = false;
+    const char* trace_path = nullptr;
+    const char* level_path = nullptr;
+    const char* stream_path = nullptr;
+    const char* stress_name = nullptr;
+};
+
+void print_usage(const char* program) {
+    std::printf("Usage: %s [--ticks N] [--dt SECONDS] [--script PATH] [--warmup N] "
+                "[--debug-primitives] [--trace PATH] [--level PATH] [--stream MANIFEST] "
+                "[--stress NAME]\n",
+                program);
+}
+
+bool parse_options(int argc, char* argv[], headless_options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (std::strcmp(arg, "--ticks") == 0 && has_value) {
+            options.ticks = std::atoll(argv[++i]);
+        } else if (std::strcmp(arg, "--warmup") == 0 && has_value) {
+            options.warmup_ticks = std::atoll(argv[++i]);
+        } else if (std::strcmp(arg, "--dt") == 0 && has_value) {
+            options.dt = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(arg, "--script") == 0 && has_value) {
+            options.script_path = argv[++i];
+        } else if (std::strcmp(arg, "--debug-primitives") == 0) {
+            options.debug_primitives = true;
+        } else if (std::strcmp(arg, "--trace") == 0 && has_value) {
+            options.trace_path = argv[++i];
+        } else if (std::strcmp(arg, "--level") == 0 && has_value) {
+            options.level_path = argv[++i];
+        } else if (std::strcmp(arg, "--stream") == 0 && has_value) {
+            options.stream_path = argv[++i];
+        } else if (std::strcmp(arg, "--stress") == 0 && has_value) {
+            options.stress_name = argv[++i];
+        } else {
+            return false;
+        }
+    }
+
+    return options.ticks > 0 && options.warmup_ticks >= 0 && options.dt > 0.0f;
+}
+
+// Peak resident set size of this process in bytes (0 if unavailable)
+size_t peak_memory_bytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<size_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss); // bytes on macOS
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024; // kilobytes on Linux
+#endif
+#endif
+}
+
+void tick(game_world& world, const app::input_script& script, long long tick_index, float dt,
+          bool debug_primitives) {
+    world.update(dt, script.sample(static_cast<int>(tick_index % script.length())));
+    if (debug_primitives) {
+        app::generate_debug_primitives(world.debug_list, world);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    headless_options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    app::input_script script = app::default_input_script();
+    if (options.script_path != nullptr && !app::load_input_script(options.script_path, script)) {
+        std::fprintf(stderr, "Failed to load input script: %s\n", options.script_path);
+        return 1;
+    }
+
+    game_world world;
+    world.init();
+
+    if (options.level_path != nullptr) {
+        app::level_file_status status = world.load_level(options.level_path);
+        if (status != app::level_file_status::OK) {
+            std::fprintf(stderr, "Failed to load level %s: %s\n", options.level_path,
+                         app::level_file_status_name(status));
+            return 1;
+        }
+    }
+    if (options.stream_path != nullptr) {
+        std::string error;
+        if (!world.stream_level(options.stream_path, error)) {
+            std::fprintf(stderr, "Failed to stream level: %s\n", error.c_str());
+            return 1;
+        }
+    }
+
+    if (options.stress_name != nullptr) {
+        app::stress_level_params params;
+        if (!app::parse_stress_level_name(options.stress_name, params)) {
+            std::fprintf(stderr, "Unknown stress level: %s\n", options.stress_name);
+            return 1;
+        }
+        // Nothing draws here: outlines would only inflate peak_memory and startup
+        params.meshes = false;
+        app::level_description description;
+        app::generate_stress_level(params, description);
+        world.build_level(description);
+        std::printf("stress_level: %s (%zu boxes)\n", app::stress_level_name(params).c_str(),
+                    description.boxes.size());
+    }
+
+    for (long long i = 0; i < options.warmup_ticks; ++i) {
+        tick(world, script, i, options.dt, options.debug_primitives);
+    }
+
+    if (options.trace_path != nullptr) {
+#if FROGLORDS_PROFILE
+        FL_TRACE_THREAD_NAME("simulation");
+        trace::start_capture(static_cast<uint32_t>(
+            std::min(options.ticks * TRACE_EVENTS_PER_TICK, MAX_TRACE_EVENTS)));
+#else
+        std::fprintf(stderr, "--trace requires a build with FROGLORDS_PROFILER=ON\n");
+        return 1;
+#endif
+    }
+
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+    uint64_t allocations_before = memory::allocation_count();
+#endif
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < options.ticks; ++i) {
+        tick(world, script, options.warmup_ticks + i, options.dt, options.debug_primitives);
+    }
+    auto end = std::chrono::steady_clock::now();
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+    uint64_t heap_allocations = memory::allocation_count() - allocations_before;
+#endif
+
+#if FROGLORDS_PROFILE
+    if (options.trace_path != nullptr) {
+        trace::stop_capture();
+        trace::capture_stats capture = trace::stats();
+        if (!trace::write_chrome_json(options.trace_path)) {
+            std::fprintf(stderr, "Failed to write trace: %s\n", options.trace_path);
+            return 1;
+        }
+        std::printf("trace: %s (%u events, %u dropped)\n", options.trace_path, capture.events,
+                    capture.dropped);
+    }
+#endif
+
+    double elapsed_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    double elapsed_s = elapsed_ns * 1e-9;
+    double ticks = static_cast<double>(options.ticks);
+
+    std::printf("ticks: %lld\n", options.ticks);
+    std::printf("dt: %.6f s\n", options.dt);
+    std::printf("simulated_time: %.3f s\n", ticks * options.dt);
+    std::printf("wall_time: %.6f s\n", elapsed_s);
+    std::printf("ticks_per_sec: %.1f\n", elapsed_s > 0.0 ? ticks / elapsed_s : 0.0);
+    std::printf("ns_per_tick: %.1f\n", elapsed_ns / ticks);
+    std::printf("peak_memory: %.2f MiB\n",
+                static_cast<double>(peak_memory_bytes()) / (1024.0 * 1024.0));
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+    std::printf("heap_allocations: %llu (%.3f per tick)\n",
+                static_cast<unsigned long long>(heap_allocations),
+                static_cast<double>(heap_allocations) / ticks);
+#endif
+#if FROGLORDS_MEMORY_TRACKING
+    for (int i = 0; i < memory::TAG_COUNT; ++i) {
+        memory::tag_stats tag = memory::stats(static_cast<memory::tag>(i));
+        std::printf("memory_%s: %.1f KiB live, %.1f KiB peak, %llu allocations\n",
+                    memory::tag_name(static_cast<memory::tag>(i)),
+                    static_cast<double>(tag.live_bytes) / 1024.0,
+                    static_cast<double>(tag.peak_bytes) / 1024.0,
+                    static_cast<unsigned long long>(tag.allocations));
+    }
+#endif
+    std::printf("final_position: %.6f %.6f %.6f\n", world.character.position.x,
+                world.character.position.y, world.character.position.z);
+
+    if (world.streamer) {
+        const app::level_streaming_stats& stream = world.streamer->stats();
+        std::printf("resident_chunks: %d (%.2f MiB, %zu boxes)\n", stream.resident_chunks,
+                    static_cast<double>(stream.resident_bytes) / (1024.0 * 1024.0),
+                    stream.resident_boxes);
+        std::printf("chunk_loads: %llu (evictions %llu, failures %llu, over budget %llu)\n",
+                    static_cast<unsigned long long>(stream.loads),
+                    static_cast<unsigned long long>(stream.evictions),
+                    static_cast<unsigned long long>(stream.failures),
+                    static_cast<unsigned long long>(stream.over_budget));
+        std::printf("chunk_load_latency: %.3f ms avg, %.3f ms max\n", stream.average_load_ms,
+                    stream.max_load_ms);
+    }
+
+    return 0;
+}
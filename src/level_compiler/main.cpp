@@ -0,0 +1,112 @@
+// Level compiler
+//
+// Converts a text level description (see load_level_description) into the memory-mapped
+// binary level format: builds the broadphase once here so loading never has to, writes the
+// file, then maps it back and validates every section.
+//
+// Usage:
+//   froglords_level_compiler INPUT.txt OUTPUT.flvl
+//   froglords_level_compiler INPUT.txt OUTPUT.manifest --chunks SIZE
+//
+// --chunks splits the level into SIZE-meter tiles for streaming (see level_streaming.h):
+// one level file per tile next to OUTPUT, which becomes the chunk manifest.
+
+#include "app/level_file.h"
+#include "app/level_streaming.h"
+#include "foundation/collision.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+int compile_chunked(const app::level_description& description, const char* manifest_path,
+                    float chunk_size) {
+    std::string error;
+    if (!app::write_chunked_level(manifest_path, description, chunk_size, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    app::level_manifest manifest;
+    if (!app::load_level_manifest(manifest_path, manifest, error)) {
+        std::fprintf(stderr, "Written manifest does not load: %s\n", error.c_str());
+        return 1;
+    }
+    uint64_t total_bytes = 0;
+    for (const app::level_chunk_info& chunk : manifest.chunks) {
+        app::level_file level;
+        app::level_file_status status = level.open(chunk.path.c_str());
+        if (status != app::level_file_status::OK ||
+            !app::validate_level_contents(level, error)) {
+            std::fprintf(stderr, "Written chunk is invalid: %s\n", chunk.path.c_str());
+            return 1;
+        }
+        total_bytes += chunk.bytes;
+    }
+
+    std::printf("manifest: %s\n", manifest_path);
+    std::printf("chunk_size: %.1f m\n", static_cast<double>(manifest.chunk_size));
+    std::printf("chunks: %zu\n", manifest.chunks.size());
+    std::printf("boxes: %zu\n", description.boxes.size());
+    std::printf("meshes: %zu\n", description.meshes.size());
+    std::printf("total_size: %llu bytes\n", static_cast<unsigned long long>(total_bytes));
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bool chunked = argc == 5 && std::strcmp(argv[3], "--chunks") == 0;
+    float chunk_size = chunked ? static_cast<float>(std::atof(argv[4])) : 0.0f;
+    if ((argc != 3 && !chunked) || (chunked && !(chunk_size > 0.0f))) {
+        std::printf("Usage: %s INPUT.txt OUTPUT.flvl\n"
+                    "       %s INPUT.txt OUTPUT.manifest --chunks SIZE\n",
+                    argv[0], argv[0]);
+        return 1;
+    }
+    const char* input_path = argv[1];
+    const char* output_path = argv[2];
+
+    app::level_description description;
+    std::string error;
+    if (!app::load_level_description(input_path, description, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    if (chunked) {
+        return compile_chunked(description, output_path, chunk_size);
+    }
+
+    collision_world world;
+    for (const collision_box& box : description.boxes) {
+        world.boxes.push_back(box);
+    }
+    build_broadphase(world);
+
+    if (!app::write_level_file(output_path, world, description.meshes)) {
+        std::fprintf(stderr, "Failed to write level: %s\n", output_path);
+        return 1;
+    }
+
+    // Round trip through the loader so a bad file never leaves the compiler
+    app::level_file level;
+    app::level_file_status status = level.open(output_path);
+    if (status != app::level_file_status::OK) {
+        std::fprintf(stderr, "Written level does not open: %s\n",
+                     app::level_file_status_name(status));
+        return 1;
+    }
+    if (!app::validate_level_contents(level, error)) {
+        std::fprintf(stderr, "Written level is invalid: %s\n", error.c_str());
+        return 1;
+    }
+
+    std::printf("level: %s\n", output_path);
+    std::printf("boxes: %zu\n", level.box_count());
+    std::printf("bvh_nodes: %zu\n", world.bvh.nodes.size());
+    std::printf("meshes: %zu\n", level.mesh_count());
+    std::printf("file_size: %zu bytes\n", level.file_size());
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include "sokol_log.h"
 #include "sokol_glue.h"
 #include "app/runtime.h"
+#include <cstring>
 
 static void init() {
     runtime().initialize();
@@ -20,7 +21,14 @@ static void event(const sapp_event* e) {
     runtime().handle_event(e);
 }
 
-sapp_desc sokol_main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+// Usage: FrogLords [--level PATH | --stream MANIFEST]
+sapp_desc sokol_main(int argc, char* argv[]) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        bool level = std::strcmp(argv[i], "--level") == 0;
+        if (level || std::strcmp(argv[i], "--stream") == 0) {
+            runtime().set_startup_level(argv[++i], !level);
+        }
+    }
 
     sapp_desc desc = {};
     desc.init_cb = init;
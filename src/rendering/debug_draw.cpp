@@ -1,51 +1,93 @@
 #include "rendering/debug_draw.h"
-#include "foundation/math_utils.h"
+#include "foundation/mesh_tables.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include "imgui.h"
+#include <cmath>
 
 namespace debug {
 
+namespace {
+
+// Unit meshes built by the compiler (read-only data: creating the instanced meshes only
+// uploads them)
+constexpr auto UNIT_SPHERE_8 = foundation::make_sphere_table<8, 8>();
+constexpr auto UNIT_SPHERE_6 = foundation::make_sphere_table<6, 6>();
+constexpr auto UNIT_SPHERE_4 = foundation::make_sphere_table<4, 4>();
+constexpr auto UNIT_BOX = foundation::make_box_table(2.0f, 2.0f, 2.0f); // half extents 1
+constexpr auto UNIT_ARROW_HEAD = foundation::make_arrow_head_table();
+constexpr foundation::mesh_table<2, 1> UNIT_LINE = {
+    {glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f)}, {0, 1}};
+
+template <size_t V, size_t E>
+instanced_mesh_handle upload(wireframe_renderer& renderer,
+                             const foundation::mesh_table<V, E>& table) {
+    return renderer.create_instanced_mesh(table.vertex_span(), table.index_span());
+}
+
+} // namespace
+
+instanced_meshes create_instanced_meshes(wireframe_renderer& renderer) {
+    instanced_meshes meshes;
+    meshes.unit_sphere_8 = upload(renderer, UNIT_SPHERE_8);
+    meshes.unit_sphere_6 = upload(renderer, UNIT_SPHERE_6);
+    meshes.unit_sphere_4 = upload(renderer, UNIT_SPHERE_4);
+    meshes.unit_box = upload(renderer, UNIT_BOX);
+    meshes.unit_line = upload(renderer, UNIT_LINE);
+    meshes.unit_arrow_head = upload(renderer, UNIT_ARROW_HEAD);
+    return meshes;
+}
+
+namespace {
+
+// Maps the unit line (0,0,0) → (0,0,1) onto start → end
+glm::mat4 line_transform(const glm::vec3& start, const glm::vec3& end) {
+    glm::mat4 model(1.0f);
+    model[2] = glm::vec4(end - start, 0.0f);
+    model[3] = glm::vec4(start, 1.0f);
+    return model;
+}
+
+} // namespace
+
 void draw_primitives(draw_context& ctx, const debug_primitive_list& list) {
+    // Every primitive is one instance of a static unit mesh: a handful of instanced draws
+    // per frame regardless of primitive count
+
     // Draw Spheres
     for (const auto& sphere : list.spheres) {
-        foundation::wireframe_mesh mesh;
+        instanced_mesh_handle mesh = ctx.meshes.unit_sphere_8;
         if (sphere.segments <= 4) {
-            mesh = ctx.unit_sphere_4;
+            mesh = ctx.meshes.unit_sphere_4;
         } else if (sphere.segments <= 6) {
-            mesh = ctx.unit_sphere_6;
-        } else {
-            mesh = ctx.unit_sphere_8;
+            mesh = ctx.meshes.unit_sphere_6;
         }
-        mesh.position = sphere.center;
-        mesh.scale = glm::vec3(sphere.radius);
-        ctx.renderer.draw(mesh, ctx.cam, ctx.aspect, sphere.color);
+        glm::mat4 model = glm::scale(glm::translate(glm::mat4(1.0f), sphere.center),
+                                     glm::vec3(sphere.radius));
+        ctx.renderer.submit_instance(mesh, model, sphere.color);
     }
 
     // Draw Lines
     for (const auto& line : list.lines) {
-        foundation::wireframe_mesh mesh;
-        mesh.vertices.push_back(line.start);
-        mesh.vertices.push_back(line.end);
-        mesh.edges.emplace_back(0, 1);
-        ctx.renderer.draw(mesh, ctx.cam, ctx.aspect, line.color);
+        ctx.renderer.submit_instance(ctx.meshes.unit_line, line_transform(line.start, line.end),
+                                     line.color);
     }
 
     // Draw Boxes
     for (const auto& box : list.boxes) {
-        foundation::wireframe_mesh mesh = foundation::generate_box(
-            {box.half_extents.x * 2.0f, box.half_extents.y * 2.0f, box.half_extents.z * 2.0f});
-        // Apply the transform to the vertices manually
-        for (auto& vertex : mesh.vertices) {
-            vertex = glm::vec3(box.transform * glm::vec4(vertex, 1.0f));
-        }
-        ctx.renderer.draw(mesh, ctx.cam, ctx.aspect, box.color);
+        glm::mat4 model = glm::scale(box.transform, box.half_extents);
+        ctx.renderer.submit_instance(ctx.meshes.unit_box, model, box.color);
     }
 
-    // Draw Arrows
+    // Draw Arrows (shaft line + head in the same basis as foundation::generate_arrow)
     for (const auto& arrow : list.arrows) {
-        foundation::wireframe_mesh mesh =
-            foundation::generate_arrow(arrow.start, arrow.end, arrow.head_size);
-        ctx.renderer.draw(mesh, ctx.cam, ctx.aspect, arrow.color);
+        glm::mat4 head;
+        if (!foundation::arrow_head_transform(arrow.start, arrow.end, arrow.head_size, head)) {
+            continue; // Degenerate arrow
+        }
+
+        ctx.renderer.submit_instance(ctx.meshes.unit_line, line_transform(arrow.start, arrow.end),
+                                     arrow.color);
+        ctx.renderer.submit_instance(ctx.meshes.unit_arrow_head, head, arrow.color);
     }
 
     // Draw Texts (using ImGui)
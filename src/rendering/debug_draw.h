@@ -8,17 +8,27 @@
 
 namespace debug {
 
+// Static unit meshes uploaded once for instanced drawing (see create_instanced_meshes)
+struct instanced_meshes {
+    instanced_mesh_handle unit_sphere_8;
+    instanced_mesh_handle unit_sphere_6;
+    instanced_mesh_handle unit_sphere_4;
+    instanced_mesh_handle unit_box;        // half extents 1 (scale by box half extents)
+    instanced_mesh_handle unit_line;       // (0,0,0) → (0,0,1)
+    instanced_mesh_handle unit_arrow_head; // see foundation::generate_arrow_head
+};
+
+// Upload the unit meshes (call once after renderer.init)
+instanced_meshes create_instanced_meshes(wireframe_renderer& renderer);
+
 // The context now primarily provides access to the renderer and camera,
-// as well as pre-made unit meshes for efficiency.
+// as well as the instanced unit meshes every primitive kind draws with.
 struct draw_context {
     wireframe_renderer& renderer;
     camera& cam;
     float aspect;
 
-    const foundation::wireframe_mesh& unit_circle;
-    const foundation::wireframe_mesh& unit_sphere_8;
-    const foundation::wireframe_mesh& unit_sphere_6;
-    const foundation::wireframe_mesh& unit_sphere_4;
+    const instanced_meshes& meshes;
 };
 
 // The single entry point for all debug drawing.
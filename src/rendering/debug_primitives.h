@@ -2,7 +2,9 @@
 
 #include <glm/glm.hpp>
 #include <glm/mat4x4.hpp>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace debug {
@@ -34,18 +36,36 @@ struct debug_box {
 };
 
 struct debug_text {
-    std::string text;
+    std::pmr::string text; // from the list's memory resource when added with add_text
     glm::vec3 position;
     glm::vec4 color;
     float font_size = 18.0f;
 };
 
+// Rebuilt every frame. Allocates from `memory` (e.g. a foundation::frame_arena, which must
+// outlive the list); the default resource is the ordinary heap.
 struct debug_primitive_list {
-    std::vector<debug_sphere> spheres;
-    std::vector<debug_line> lines;
-    std::vector<debug_arrow> arrows;
-    std::vector<debug_box> boxes;
-    std::vector<debug_text> texts;
+    std::pmr::vector<debug_sphere> spheres;
+    std::pmr::vector<debug_line> lines;
+    std::pmr::vector<debug_arrow> arrows;
+    std::pmr::vector<debug_box> boxes;
+    std::pmr::vector<debug_text> texts;
+
+    explicit debug_primitive_list(
+        std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : spheres(memory)
+        , lines(memory)
+        , arrows(memory)
+        , boxes(memory)
+        , texts(memory) {}
+
+    // Label with its string in the list's memory resource (debug_text is an aggregate, so
+    // the texts vector can't pass its resource on to a string built elsewhere)
+    void add_text(std::string_view text, const glm::vec3& position, const glm::vec4& color,
+                  float font_size = 18.0f) {
+        texts.push_back(debug_text{std::pmr::string(text, texts.get_allocator()), position,
+                                   color, font_size});
+    }
 
     void clear() {
         spheres.clear();
@@ -1,13 +1,37 @@
 #include "renderer.h"
+#include "foundation/debug_assert.h"
+#include "foundation/memory_tracking.h"
+#include "foundation/profiler.h"
 #include <wireframe_shader.h>
+#include <wireframe_instanced_shader.h>
 #include <glm/gtc/type_ptr.hpp>
-#include <vector>
+#include <cstddef>
+#include <cstring>
+
+namespace {
+
+// Initial stream capacities; the rings grow to fit the largest recent frame
+constexpr size_t INITIAL_VERTEX_STREAM_BYTES = 256 * 1024;
+constexpr size_t INITIAL_INDEX_STREAM_BYTES = 256 * 1024;
+constexpr size_t INITIAL_INSTANCE_STREAM_BYTES = 256 * 1024; // 80 bytes per instance
+
+// Per-stream, per-frame limit; geometry beyond it is dropped and counted (catches runaway
+// debug drawing before it exhausts GPU memory)
+constexpr size_t MAX_STREAM_BYTES = 64 * 1024 * 1024;
+constexpr size_t MAX_INSTANCES = MAX_STREAM_BYTES / sizeof(wireframe_instance);
+
+bool is_identity_transform(const foundation::wireframe_mesh& mesh) {
+    return mesh.position == glm::vec3(0.0f) && mesh.rotation == glm::vec3(0.0f) &&
+           mesh.scale == glm::vec3(1.0f);
+}
+
+} // namespace
 
 wireframe_renderer::wireframe_renderer()
     : pipeline({0})
     , shader({0})
-    , dynamic_vertex_buffer({0})
-    , dynamic_index_buffer({0}) {}
+    , instanced_pipeline({0})
+    , instanced_shader({0}) {}
 
 wireframe_renderer::~wireframe_renderer() {
     shutdown();
@@ -16,6 +40,7 @@ wireframe_renderer::~wireframe_renderer() {
 void wireframe_renderer::init() {
     if (initialized)
         return;
+    FL_MEMORY_TAG(RENDERING);
 
     shader = sg_make_shader(wireframe_shader_desc(sg_query_backend()));
 
@@ -23,7 +48,7 @@ void wireframe_renderer::init() {
     sg_pipeline_desc pipeline_desc = {};
     pipeline_desc.shader = shader;
     pipeline_desc.primitive_type = SG_PRIMITIVETYPE_LINES;
-    pipeline_desc.index_type = SG_INDEXTYPE_UINT16;
+    pipeline_desc.index_type = SG_INDEXTYPE_UINT32;
 
     // Vertex layout
     pipeline_desc.layout.attrs[ATTR_wireframe_position].format = SG_VERTEXFORMAT_FLOAT3;
@@ -34,18 +59,44 @@ void wireframe_renderer::init() {
 
     pipeline = sg_make_pipeline(&pipeline_desc);
 
-    // Create persistent dynamic buffers for streaming geometry
-    sg_buffer_desc vbuf_desc = {};
-    vbuf_desc.size = 65536; // 64KB - generous size for dynamic vertex data
-    vbuf_desc.usage.stream_update = true;
-    vbuf_desc.usage.vertex_buffer = true;
-    dynamic_vertex_buffer = sg_make_buffer(&vbuf_desc);
+    // Streaming geometry rings (each uploaded once per frame)
+    vertex_stream.init(false, INITIAL_VERTEX_STREAM_BYTES, "wireframe_vertex_stream");
+    index_stream.init(true, INITIAL_INDEX_STREAM_BYTES, "wireframe_index_stream");
 
-    sg_buffer_desc ibuf_desc = {};
-    ibuf_desc.size = 65536; // 64KB - generous size for dynamic index data
-    ibuf_desc.usage.stream_update = true;
-    ibuf_desc.usage.index_buffer = true;
-    dynamic_index_buffer = sg_make_buffer(&ibuf_desc);
+    // Instanced pipeline: static unit mesh in buffer slot 0, per-instance model matrix
+    // columns + color streamed in buffer slot 1
+    instanced_shader = sg_make_shader(wireframe_instanced_shader_desc(sg_query_backend()));
+
+    sg_pipeline_desc instanced_desc = {};
+    instanced_desc.shader = instanced_shader;
+    instanced_desc.primitive_type = SG_PRIMITIVETYPE_LINES;
+    instanced_desc.index_type = SG_INDEXTYPE_UINT32;
+    instanced_desc.layout.buffers[1].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+    instanced_desc.layout.buffers[1].stride = sizeof(wireframe_instance);
+    instanced_desc.layout.attrs[ATTR_wireframe_instanced_position].format =
+        SG_VERTEXFORMAT_FLOAT3;
+
+    const int model_attrs[4] = {
+        ATTR_wireframe_instanced_inst_model0, ATTR_wireframe_instanced_inst_model1,
+        ATTR_wireframe_instanced_inst_model2, ATTR_wireframe_instanced_inst_model3};
+    for (int column = 0; column < 4; ++column) {
+        instanced_desc.layout.attrs[model_attrs[column]].buffer_index = 1;
+        instanced_desc.layout.attrs[model_attrs[column]].offset =
+            static_cast<int>(column * sizeof(glm::vec4));
+        instanced_desc.layout.attrs[model_attrs[column]].format = SG_VERTEXFORMAT_FLOAT4;
+    }
+    instanced_desc.layout.attrs[ATTR_wireframe_instanced_inst_color].buffer_index = 1;
+    instanced_desc.layout.attrs[ATTR_wireframe_instanced_inst_color].offset =
+        static_cast<int>(offsetof(wireframe_instance, color));
+    instanced_desc.layout.attrs[ATTR_wireframe_instanced_inst_color].format =
+        SG_VERTEXFORMAT_FLOAT4;
+
+    instanced_desc.depth.compare = SG_COMPAREFUNC_LESS_EQUAL;
+    instanced_desc.depth.write_enabled = true;
+
+    instanced_pipeline = sg_make_pipeline(&instanced_desc);
+
+    instance_stream.init(false, INITIAL_INSTANCE_STREAM_BYTES, "wireframe_instance_stream");
 
     initialized = true;
 }
@@ -54,67 +105,292 @@ void wireframe_renderer::shutdown() {
     if (!initialized)
         return;
 
-    sg_destroy_buffer(dynamic_index_buffer);
-    sg_destroy_buffer(dynamic_vertex_buffer);
+    for (const instanced_mesh& mesh : instanced_meshes) {
+        sg_destroy_buffer(mesh.index_buffer);
+        sg_destroy_buffer(mesh.vertex_buffer);
+    }
+    instanced_meshes.clear();
+    free_instanced_meshes.clear();
+    instance_stream.shutdown();
+    sg_destroy_pipeline(instanced_pipeline);
+    sg_destroy_shader(instanced_shader);
+
+    index_stream.shutdown();
+    vertex_stream.shutdown();
     sg_destroy_pipeline(pipeline);
     sg_destroy_shader(shader);
 
     initialized = false;
 }
 
-void wireframe_renderer::draw(const foundation::wireframe_mesh& mesh, const camera& cam,
-                              float aspect_ratio, const glm::vec4& color) {
-    if (!initialized)
-        return;
+void wireframe_renderer::begin_frame(const camera& cam, float aspect_ratio) {
+    FL_PRECONDITION(!in_frame, "begin_frame called twice without end_frame");
+
+    view_projection = cam.get_projection_matrix(aspect_ratio) * cam.get_view_matrix();
+
+    for (size_t i = 0; i < active_batches; ++i) {
+        batches[i].vertices.clear();
+        batches[i].indices.clear();
+    }
+    active_batches = 0;
+    for (instanced_mesh& mesh : instanced_meshes) {
+        mesh.instances.clear();
+    }
+    frame_vertex_bytes = 0;
+    frame_index_bytes = 0;
+    frame_instance_count = 0;
+    frame_stats = render_stats{};
+
+    in_frame = true;
+}
+
+wireframe_renderer::batch& wireframe_renderer::find_batch(const glm::vec4& color) {
+    // Few distinct colors per frame: linear search beats hashing vec4 keys
+    for (size_t i = 0; i < active_batches; ++i) {
+        if (batches[i].color == color) {
+            return batches[i];
+        }
+    }
+
+    if (active_batches == batches.size()) {
+        batches.emplace_back();
+    }
+    batch& b = batches[active_batches++];
+    b.color = color;
+    return b;
+}
+
+void wireframe_renderer::submit(const foundation::wireframe_mesh& mesh, const glm::vec4& color) {
+    FL_PRECONDITION(in_frame, "submit called outside begin_frame/end_frame");
     if (mesh.vertices.empty() || mesh.edges.empty())
         return;
 
-    // Build MVP matrix
-    glm::mat4 model = mesh.get_model_matrix();
-    glm::mat4 view = cam.get_view_matrix();
-    glm::mat4 projection = cam.get_projection_matrix(aspect_ratio);
-    glm::mat4 mvp = projection * view * model;
+    frame_stats.meshes_submitted++;
+
+    size_t vertex_bytes = mesh.vertices.size() * sizeof(glm::vec3);
+    size_t index_bytes = mesh.edges.size() * 2 * sizeof(uint32_t);
+    if (frame_vertex_bytes + vertex_bytes > MAX_STREAM_BYTES ||
+        frame_index_bytes + index_bytes > MAX_STREAM_BYTES) {
+        frame_stats.meshes_dropped++;
+        return;
+    }
+    frame_vertex_bytes += vertex_bytes;
+    frame_index_bytes += index_bytes;
+
+    batch& b = find_batch(color);
+    uint32_t base_vertex = static_cast<uint32_t>(b.vertices.size());
 
-    // Convert edges to line indices
-    std::vector<uint16_t> indices;
+    // Bake the model transform so every mesh of one color shares a single draw
+    if (is_identity_transform(mesh)) {
+        b.vertices.insert(b.vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+    } else {
+        glm::mat4 model = mesh.get_model_matrix();
+        for (const glm::vec3& v : mesh.vertices) {
+            b.vertices.push_back(glm::vec3(model * glm::vec4(v, 1.0f)));
+        }
+    }
+
+    for (const foundation::edge& e : mesh.edges) {
+        b.indices.push_back(base_vertex + static_cast<uint32_t>(e.v0));
+        b.indices.push_back(base_vertex + static_cast<uint32_t>(e.v1));
+    }
+}
+
+instanced_mesh_handle
+wireframe_renderer::create_instanced_mesh(const foundation::wireframe_mesh& mesh) {
+    FL_MEMORY_TAG(RENDERING);
+    std::vector<uint32_t> indices;
     indices.reserve(mesh.edges.size() * 2);
     for (const foundation::edge& e : mesh.edges) {
-        indices.push_back(static_cast<uint16_t>(e.v0));
-        indices.push_back(static_cast<uint16_t>(e.v1));
+        indices.push_back(static_cast<uint32_t>(e.v0));
+        indices.push_back(static_cast<uint32_t>(e.v1));
     }
+    return create_instanced_mesh(mesh.vertices, indices);
+}
 
-    // Append this mesh's data to dynamic buffers (allows multiple draws per frame)
-    // NOTE: Future optimization - batching API (begin/draw/end) with single update + offsets
-    sg_range vertex_data = {mesh.vertices.data(), mesh.vertices.size() * sizeof(glm::vec3)};
-    int vb_offset = sg_append_buffer(dynamic_vertex_buffer, &vertex_data);
+instanced_mesh_handle
+wireframe_renderer::create_instanced_mesh(std::span<const glm::vec3> vertices,
+                                          std::span<const uint32_t> indices) {
+    FL_PRECONDITION(initialized, "create_instanced_mesh requires init()");
+    FL_PRECONDITION(!vertices.empty() && !indices.empty(), "mesh must not be empty");
+    FL_PRECONDITION(indices.size() % 2 == 0, "line-list indices come in pairs");
 
-    sg_range index_data = {indices.data(), indices.size() * sizeof(uint16_t)};
-    int ib_offset = sg_append_buffer(dynamic_index_buffer, &index_data);
+    instanced_mesh gpu_mesh;
 
-    // Bind persistent buffers with offsets to this mesh's data
-    sg_bindings draw_bindings = {};
-    draw_bindings.vertex_buffers[0] = dynamic_vertex_buffer;
-    draw_bindings.vertex_buffer_offsets[0] = vb_offset;
-    draw_bindings.index_buffer = dynamic_index_buffer;
-    draw_bindings.index_buffer_offset = ib_offset;
+    sg_buffer_desc vbuf_desc = {};
+    vbuf_desc.usage.immutable = true;
+    vbuf_desc.usage.vertex_buffer = true;
+    vbuf_desc.data = {vertices.data(), vertices.size() * sizeof(glm::vec3)};
+    gpu_mesh.vertex_buffer = sg_make_buffer(&vbuf_desc);
+
+    sg_buffer_desc ibuf_desc = {};
+    ibuf_desc.usage.immutable = true;
+    ibuf_desc.usage.index_buffer = true;
+    ibuf_desc.data = {indices.data(), indices.size() * sizeof(uint32_t)};
+    gpu_mesh.index_buffer = sg_make_buffer(&ibuf_desc);
+
+    gpu_mesh.index_count = static_cast<int>(indices.size());
+
+    if (!free_instanced_meshes.empty()) {
+        int index = free_instanced_meshes.back();
+        free_instanced_meshes.pop_back();
+        instanced_meshes[index] = std::move(gpu_mesh);
+        return instanced_mesh_handle{index};
+    }
+    instanced_meshes.push_back(std::move(gpu_mesh));
+    return instanced_mesh_handle{static_cast<int>(instanced_meshes.size()) - 1};
+}
+
+void wireframe_renderer::destroy_instanced_mesh(instanced_mesh_handle mesh) {
+    FL_PRECONDITION(mesh.valid() && mesh.index < static_cast<int>(instanced_meshes.size()) &&
+                        instanced_meshes[mesh.index].index_count > 0,
+                    "invalid instanced mesh handle");
+    FL_PRECONDITION(!in_frame, "destroy_instanced_mesh called between begin_frame/end_frame");
+
+    instanced_mesh& gpu_mesh = instanced_meshes[mesh.index];
+    sg_destroy_buffer(gpu_mesh.index_buffer);
+    sg_destroy_buffer(gpu_mesh.vertex_buffer);
+    gpu_mesh = instanced_mesh{};
+    free_instanced_meshes.push_back(mesh.index);
+}
+
+void wireframe_renderer::submit_instance(instanced_mesh_handle mesh, const glm::mat4& model,
+                                         const glm::vec4& color) {
+    FL_PRECONDITION(in_frame, "submit_instance called outside begin_frame/end_frame");
+    FL_PRECONDITION(mesh.valid() && mesh.index < static_cast<int>(instanced_meshes.size()) &&
+                        instanced_meshes[mesh.index].index_count > 0,
+                    "invalid instanced mesh handle");
+
+    if (frame_instance_count >= MAX_INSTANCES) {
+        frame_stats.instances_dropped++;
+        return;
+    }
+    frame_instance_count++;
+
+    instanced_meshes[mesh.index].instances.push_back(wireframe_instance{model, color});
+}
+
+void wireframe_renderer::end_frame() {
+    FL_PROFILE_ZONE("wireframe_renderer::end_frame");
+    FL_MEMORY_TAG(RENDERING);
+    FL_PRECONDITION(in_frame, "end_frame called without begin_frame");
+    in_frame = false;
+
+    if (initialized) {
+        flush_batches();
+        flush_instances();
+        frame_stats.stream_capacity = vertex_stream.total_capacity() +
+                                      index_stream.total_capacity() +
+                                      instance_stream.total_capacity();
+        frame_stats.stream_grows =
+            vertex_stream.grow_count() + index_stream.grow_count() + instance_stream.grow_count();
+    }
+
+    last_stats = frame_stats;
+}
+
+void wireframe_renderer::flush_batches() {
+    if (active_batches == 0) {
+        return;
+    }
+
+    // Pack batches back-to-back: one buffer update per frame instead of one append per mesh
+    staging_vertices.clear();
+    staging_indices.clear();
+    for (size_t i = 0; i < active_batches; ++i) {
+        staging_vertices.insert(staging_vertices.end(), batches[i].vertices.begin(),
+                                batches[i].vertices.end());
+        staging_indices.insert(staging_indices.end(), batches[i].indices.begin(),
+                               batches[i].indices.end());
+    }
+
+    size_t vertex_bytes = staging_vertices.size() * sizeof(glm::vec3);
+    size_t index_bytes = staging_indices.size() * sizeof(uint32_t);
+    sg_buffer vertex_buffer = vertex_stream.upload(staging_vertices.data(), vertex_bytes);
+    sg_buffer index_buffer = index_stream.upload(staging_indices.data(), index_bytes);
+
+    frame_stats.vertices = static_cast<int>(staging_vertices.size());
+    frame_stats.indices = static_cast<int>(staging_indices.size());
+    frame_stats.bytes_uploaded += vertex_bytes + index_bytes;
 
     sg_apply_pipeline(pipeline);
-    sg_apply_bindings(&draw_bindings);
 
-    // Set uniforms
+    // Vertices are already in world space; one view-projection for the whole frame
     vs_params_t vs_params = {};
-    memcpy(&vs_params.mvp, glm::value_ptr(mvp), sizeof(glm::mat4));
+    memcpy(&vs_params.mvp, glm::value_ptr(view_projection), sizeof(glm::mat4));
     sg_range vs_range = SG_RANGE(vs_params);
     sg_apply_uniforms(UB_vs_params, &vs_range);
 
-    fs_params_t fs_params = {};
-    fs_params.color[0] = color.r;
-    fs_params.color[1] = color.g;
-    fs_params.color[2] = color.b;
-    fs_params.color[3] = color.a;
-    sg_range fs_range = SG_RANGE(fs_params);
-    sg_apply_uniforms(UB_fs_params, &fs_range);
+    size_t vertex_offset = 0;
+    size_t index_offset = 0;
+    for (size_t i = 0; i < active_batches; ++i) {
+        const batch& b = batches[i];
+
+        // Bind the shared buffers at this batch's range (batch indices are batch-local)
+        sg_bindings draw_bindings = {};
+        draw_bindings.vertex_buffers[0] = vertex_buffer;
+        draw_bindings.vertex_buffer_offsets[0] = static_cast<int>(vertex_offset);
+        draw_bindings.index_buffer = index_buffer;
+        draw_bindings.index_buffer_offset = static_cast<int>(index_offset);
+        sg_apply_bindings(&draw_bindings);
+
+        fs_params_t fs_params = {};
+        fs_params.color[0] = b.color.r;
+        fs_params.color[1] = b.color.g;
+        fs_params.color[2] = b.color.b;
+        fs_params.color[3] = b.color.a;
+        sg_range fs_range = SG_RANGE(fs_params);
+        sg_apply_uniforms(UB_fs_params, &fs_range);
+
+        sg_draw(0, static_cast<int>(b.indices.size()), 1);
+        frame_stats.draw_calls++;
+
+        vertex_offset += b.vertices.size() * sizeof(glm::vec3);
+        index_offset += b.indices.size() * sizeof(uint32_t);
+    }
+}
+
+void wireframe_renderer::flush_instances() {
+    if (frame_instance_count == 0) {
+        return;
+    }
 
-    // Draw
-    sg_draw(0, static_cast<int>(indices.size()), 1);
+    // Pack each mesh's instances contiguously so one update serves every instanced draw
+    staging_instances.clear();
+    for (const instanced_mesh& mesh : instanced_meshes) {
+        staging_instances.insert(staging_instances.end(), mesh.instances.begin(),
+                                 mesh.instances.end());
+    }
+
+    size_t instance_bytes = staging_instances.size() * sizeof(wireframe_instance);
+    sg_buffer instance_buffer = instance_stream.upload(staging_instances.data(), instance_bytes);
+
+    frame_stats.instances = static_cast<int>(staging_instances.size());
+    frame_stats.bytes_uploaded += instance_bytes;
+
+    sg_apply_pipeline(instanced_pipeline);
+
+    instanced_vs_params_t vs_params = {};
+    memcpy(&vs_params.view_proj, glm::value_ptr(view_projection), sizeof(glm::mat4));
+    sg_range vs_range = SG_RANGE(vs_params);
+    sg_apply_uniforms(UB_instanced_vs_params, &vs_range);
+
+    size_t instance_offset = 0;
+    for (const instanced_mesh& mesh : instanced_meshes) {
+        if (mesh.instances.empty()) {
+            continue;
+        }
+
+        sg_bindings draw_bindings = {};
+        draw_bindings.vertex_buffers[0] = mesh.vertex_buffer;
+        draw_bindings.vertex_buffers[1] = instance_buffer;
+        draw_bindings.vertex_buffer_offsets[1] = static_cast<int>(instance_offset);
+        draw_bindings.index_buffer = mesh.index_buffer;
+        sg_apply_bindings(&draw_bindings);
+
+        sg_draw(0, mesh.index_count, static_cast<int>(mesh.instances.size()));
+        frame_stats.draw_calls++;
+
+        instance_offset += mesh.instances.size() * sizeof(wireframe_instance);
+    }
 }
@@ -1,9 +1,41 @@
 #pragma once
 
 #include "sokol_gfx.h"
+#include "rendering/stream_buffer.h"
 #include "foundation/procedural_mesh.h"
 #include "camera/camera.h"
 #include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// Per-frame renderer counters (valid after end_frame)
+struct render_stats {
+    int draw_calls = 0;
+    int meshes_submitted = 0;
+    int meshes_dropped = 0; // overflow: frame exceeded the stream size limit
+    int instances = 0;
+    int instances_dropped = 0; // overflow: frame exceeded the stream size limit
+    int vertices = 0;
+    int indices = 0;
+    size_t bytes_uploaded = 0;
+    size_t stream_capacity = 0; // bytes allocated across every slot of the stream rings
+    int stream_grows = 0;       // total stream buffer reallocations since init
+};
+
+/// Static mesh uploaded once for instanced drawing (see create_instanced_mesh)
+struct instanced_mesh_handle {
+    int index = -1;
+
+    bool valid() const { return index >= 0; }
+};
+
+/// Per-instance data for the instanced pipeline (matches wireframe_instanced.glsl)
+struct wireframe_instance {
+    glm::mat4 model{1.0f};
+    glm::vec4 color{1.0f};
+};
 
 class wireframe_renderer {
   public:
@@ -16,19 +48,90 @@ class wireframe_renderer {
     /// Release renderer resources
     void shutdown();
 
-    /// Render wireframe mesh using camera transform
-    /// @param mesh Wireframe mesh to render
+    /// Start accumulating geometry for a frame
     /// @param cam Camera for view/projection matrices
     /// @param aspect_ratio Viewport width/height ratio
+    void begin_frame(const camera& cam, float aspect_ratio);
+
+    /// Queue a wireframe mesh (transformed to world space on the CPU)
+    /// @param mesh Wireframe mesh to render
     /// @param color Line color (RGBA, defaults to white)
-    void draw(const foundation::wireframe_mesh& mesh, const camera& cam, float aspect_ratio,
-              const glm::vec4& color = glm::vec4(1.0f));
+    void submit(const foundation::wireframe_mesh& mesh, const glm::vec4& color = glm::vec4(1.0f));
+
+    /// Upload a static mesh in local space to immutable GPU buffers, drawn via submit_instance
+    /// (mesh position/rotation/scale are ignored; each instance supplies its transform)
+    /// Use for scene geometry and unit meshes; per-frame geometry goes through submit.
+    instanced_mesh_handle create_instanced_mesh(const foundation::wireframe_mesh& mesh);
+
+    /// Same, from upload-ready geometry (line-list indices, two per edge); the data is
+    /// uploaded as is, e.g. straight from a memory-mapped level file
+    instanced_mesh_handle create_instanced_mesh(std::span<const glm::vec3> vertices,
+                                                std::span<const uint32_t> indices);
+
+    /// Release a mesh's GPU buffers (outside begin_frame/end_frame); the handle may be
+    /// returned again by a later create_instanced_mesh
+    void destroy_instanced_mesh(instanced_mesh_handle mesh);
+
+    /// Queue one instance of a static mesh
+    /// @param model Instance transform (local → world)
+    /// @param color Line color (RGBA)
+    void submit_instance(instanced_mesh_handle mesh, const glm::mat4& model,
+                         const glm::vec4& color);
+
+    /// Upload all queued geometry once and issue one draw per color batch plus one
+    /// instanced draw per static mesh. Must be called inside a render pass.
+    void end_frame();
+
+    /// Counters for the most recently completed frame
+    const render_stats& stats() const { return last_stats; }
 
   private:
+    // Geometry sharing one color; indices are local to the batch's vertex range
+    struct batch {
+        glm::vec4 color{1.0f};
+        std::vector<glm::vec3> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    struct instanced_mesh {
+        sg_buffer vertex_buffer{};
+        sg_buffer index_buffer{};
+        int index_count = 0;
+        std::vector<wireframe_instance> instances; // queued this frame
+    };
+
+    batch& find_batch(const glm::vec4& color);
+    void flush_batches();
+    void flush_instances();
+
     sg_pipeline pipeline;
     sg_shader shader;
-    sg_buffer dynamic_vertex_buffer;
-    sg_buffer dynamic_index_buffer;
+    stream_buffer_ring vertex_stream;
+    stream_buffer_ring index_stream;
+
+    sg_pipeline instanced_pipeline;
+    sg_shader instanced_shader;
+    stream_buffer_ring instance_stream;
+    std::vector<instanced_mesh> instanced_meshes;
+    std::vector<int> free_instanced_meshes; // destroyed slots (index_count == 0)
+    std::vector<wireframe_instance> staging_instances;
+
+    // Batches persist across frames so their vectors keep capacity (no per-frame allocation
+    // once warmed up); only the first active_batches are in use this frame
+    std::vector<batch> batches;
+    size_t active_batches = 0;
+
+    // Staging buffers: every batch packed back-to-back for the single per-frame upload
+    std::vector<glm::vec3> staging_vertices;
+    std::vector<uint32_t> staging_indices;
+
+    glm::mat4 view_projection{1.0f};
+    size_t frame_vertex_bytes = 0;
+    size_t frame_index_bytes = 0;
+    size_t frame_instance_count = 0;
+    render_stats frame_stats;
+    render_stats last_stats;
 
     bool initialized = false;
+    bool in_frame = false;
 };
@@ -1,17 +1,96 @@
 #include "rendering/scene.h"
+#include "foundation/debug_assert.h"
+#include "foundation/memory_tracking.h"
 
-void scene::add_object(const foundation::wireframe_mesh& mesh) {
+glm::mat4 scene_mesh::get_model_matrix() const {
+    return foundation::compute_model_matrix(position, rotation, scale);
+}
+
+void scene::add_object(const foundation::wireframe_mesh& mesh, uint32_t group) {
+    FL_MEMORY_TAG(RENDERING);
+    auto geometry = std::make_shared<owned_geometry>();
+    geometry->vertices = mesh.vertices;
+    geometry->indices.reserve(mesh.edges.size() * 2);
+    for (const foundation::edge& e : mesh.edges) {
+        geometry->indices.push_back(static_cast<uint32_t>(e.v0));
+        geometry->indices.push_back(static_cast<uint32_t>(e.v1));
+    }
+
+    scene_mesh view;
+    view.vertices = geometry->vertices;
+    view.indices = geometry->indices;
+    view.position = mesh.position;
+    view.rotation = mesh.rotation;
+    view.scale = mesh.scale;
+    add_view(view, group);
+    owned.back() = std::move(geometry);
+}
+
+void scene::add_view(const scene_mesh& mesh, uint32_t group) {
+    FL_MEMORY_TAG(RENDERING);
     meshes.push_back(mesh);
+    render_handles.push_back(-1);
+    groups.push_back(group);
+    owned.push_back(nullptr);
+}
+
+void scene::remove_group(uint32_t group) {
+    size_t kept = 0;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        if (groups[i] == group) {
+            retire_handle(render_handles[i]);
+            continue;
+        }
+        meshes[kept] = meshes[i];
+        render_handles[kept] = render_handles[i];
+        groups[kept] = groups[i];
+        owned[kept] = std::move(owned[i]);
+        kept++;
+    }
+    meshes.resize(kept);
+    render_handles.resize(kept);
+    groups.resize(kept);
+    owned.resize(kept);
 }
 
 void scene::clear() {
+    for (int handle : render_handles) {
+        retire_handle(handle);
+    }
     meshes.clear();
+    render_handles.clear();
+    groups.clear();
+    owned.clear();
 }
 
 size_t scene::object_count() const {
     return meshes.size();
 }
 
-const std::vector<foundation::wireframe_mesh>& scene::objects() const {
+const std::vector<scene_mesh>& scene::objects() const {
     return meshes;
 }
+
+int scene::render_handle(size_t index) const {
+    FL_PRECONDITION(index < render_handles.size(), "scene object index out of range");
+    return render_handles[index];
+}
+
+void scene::set_render_handle(size_t index, int handle) {
+    FL_PRECONDITION(index < render_handles.size(), "scene object index out of range");
+    render_handles[index] = handle;
+}
+
+const std::vector<int>& scene::retired_handles() const {
+    return retired;
+}
+
+void scene::clear_retired_handles() {
+    retired.clear();
+}
+
+void scene::retire_handle(int handle) {
+    if (handle >= 0) {
+        retired.push_back(handle);
+    }
+}
@@ -1,18 +1,65 @@
 #pragma once
 #include "foundation/procedural_mesh.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <vector>
 
+// Static scene mesh in upload-ready form: vertices plus line-list indices (two per edge).
+// Geometry is either owned by the scene (add_object) or borrowed from a loaded level file
+// (add_view), in which case the renderer uploads straight from the mapped file.
+struct scene_mesh {
+    std::span<const glm::vec3> vertices;
+    std::span<const uint32_t> indices;
+
+    glm::vec3 position{0.0f};
+    glm::vec3 rotation{0.0f}; // Euler angles (radians)
+    glm::vec3 scale{1.0f};
+
+    glm::mat4 get_model_matrix() const;
+};
+
 class scene {
   public:
     scene() = default;
     ~scene() = default;
 
-    void add_object(const foundation::wireframe_mesh& mesh);
+    // Copies the mesh geometry into the scene
+    void add_object(const foundation::wireframe_mesh& mesh, uint32_t group = 0);
+    // Borrows the geometry, which must outlive the scene (and its copies) or its removal
+    void add_view(const scene_mesh& mesh, uint32_t group = 0);
+    // Remove every object added with `group` (e.g. one streamed level chunk); the order of
+    // the remaining objects is kept
+    void remove_group(uint32_t group);
     void clear();
 
     size_t object_count() const;
-    const std::vector<foundation::wireframe_mesh>& objects() const;
+    const std::vector<scene_mesh>& objects() const;
+
+    // Renderer handle for object `index` (-1 until uploaded). Scene meshes are static, so the
+    // renderer uploads each once and caches the handle here. Handles of removed objects are
+    // queued in retired_handles() until the renderer releases them.
+    int render_handle(size_t index) const;
+    void set_render_handle(size_t index, int handle);
+    const std::vector<int>& retired_handles() const;
+    void clear_retired_handles();
 
   private:
-    std::vector<foundation::wireframe_mesh> meshes;
+    struct owned_geometry {
+        std::vector<glm::vec3> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    void retire_handle(int handle);
+
+    std::vector<scene_mesh> meshes;
+    std::vector<int> render_handles; // parallel to meshes
+    std::vector<uint32_t> groups;    // parallel to meshes
+
+    // Backing for add_object meshes (null for views), parallel to meshes; shared so scene
+    // copies keep their views valid
+    std::vector<std::shared_ptr<const owned_geometry>> owned;
+
+    std::vector<int> retired;
 };
@@ -0,0 +1,108 @@
+#include "rendering/stream_buffer.h"
+#include "foundation/debug_assert.h"
+#include <algorithm>
+
+namespace {
+
+// TUNED: Shrink policy. Capacity is trimmed when both the current and previous window peaked
+// below a quarter of it (two windows avoid thrashing on periodic spikes like F3 toggles).
+constexpr int HIGH_WATER_WINDOW_FRAMES = 120; // ~2 seconds at 60Hz
+constexpr size_t SHRINK_RATIO = 4;
+
+size_t round_up_pow2(size_t bytes) {
+    size_t result = 1;
+    while (result < bytes) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// 1.5x headroom so a slowly growing frame doesn't recreate buffers every few frames
+size_t grown_capacity(size_t bytes) {
+    return round_up_pow2(bytes + bytes / 2);
+}
+
+} // namespace
+
+void stream_buffer_ring::init(bool index_buffer, size_t initial_bytes, const char* label) {
+    FL_PRECONDITION(!initialized, "stream_buffer_ring initialized twice");
+    FL_PRECONDITION(initial_bytes > 0, "initial_bytes must be positive");
+
+    is_index_buffer = index_buffer;
+    minimum_bytes = initial_bytes;
+    debug_label = label;
+    for (int slot = 0; slot < FRAMES_IN_FLIGHT; ++slot) {
+        recreate_slot(slot, initial_bytes);
+    }
+    current = FRAMES_IN_FLIGHT - 1; // first upload lands in slot 0
+    grows = 0;
+    initialized = true;
+}
+
+void stream_buffer_ring::shutdown() {
+    if (!initialized)
+        return;
+
+    for (int slot = 0; slot < FRAMES_IN_FLIGHT; ++slot) {
+        sg_destroy_buffer(buffers[slot]);
+        buffers[slot] = {};
+        capacities[slot] = 0;
+    }
+    initialized = false;
+}
+
+void stream_buffer_ring::recreate_slot(int slot, size_t bytes) {
+    if (buffers[slot].id != 0) {
+        // Slot was last written FRAMES_IN_FLIGHT - 1 frames ago; the GPU is done with it
+        sg_destroy_buffer(buffers[slot]);
+    }
+
+    sg_buffer_desc desc = {};
+    desc.size = bytes;
+    desc.usage.stream_update = true;
+    desc.usage.vertex_buffer = !is_index_buffer;
+    desc.usage.index_buffer = is_index_buffer;
+    desc.label = debug_label;
+    buffers[slot] = sg_make_buffer(&desc);
+    capacities[slot] = bytes;
+}
+
+sg_buffer stream_buffer_ring::upload(const void* data, size_t bytes) {
+    FL_PRECONDITION(initialized, "stream_buffer_ring used before init");
+    FL_PRECONDITION(bytes > 0, "upload must not be empty");
+
+    current = (current + 1) % FRAMES_IN_FLIGHT;
+
+    // Track the peak over a sliding window for shrink decisions
+    window_high_water = std::max(window_high_water, bytes);
+    if (++window_frames >= HIGH_WATER_WINDOW_FRAMES) {
+        previous_window_high_water = window_high_water;
+        window_high_water = bytes;
+        window_frames = 0;
+    }
+
+    size_t recent_peak = std::max(window_high_water, previous_window_high_water);
+    if (bytes > capacities[current]) {
+        recreate_slot(current, grown_capacity(bytes));
+        grows++;
+    } else if (capacities[current] > minimum_bytes &&
+               recent_peak * SHRINK_RATIO < capacities[current]) {
+        recreate_slot(current, std::max(minimum_bytes, grown_capacity(recent_peak)));
+    }
+
+    sg_range range = {data, bytes};
+    sg_update_buffer(buffers[current], &range);
+    return buffers[current];
+}
+
+size_t stream_buffer_ring::capacity() const {
+    return capacities[current];
+}
+
+size_t stream_buffer_ring::total_capacity() const {
+    size_t total = 0;
+    for (size_t bytes : capacities) {
+        total += bytes;
+    }
+    return total;
+}
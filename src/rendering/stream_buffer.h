@@ -0,0 +1,57 @@
+#pragma once
+
+#include "sokol_gfx.h"
+#include <cstddef>
+
+/// Growable ring of per-frame stream buffers
+///
+/// Each upload goes to the next buffer in the ring, so the GPU can still read the previous
+/// frames' data while the CPU writes this frame's. A slot that is too small is recreated at
+/// 1.5x the request (rounded up to a power of two); capacity shrinks back once the high-water
+/// mark over a window of frames drops well below it. Data is uploaded once per frame, so the
+/// exact size is known before the upload and growing never drops geometry.
+class stream_buffer_ring {
+  public:
+    static constexpr int FRAMES_IN_FLIGHT = 3;
+
+    /// @param index_buffer Index buffer if true, vertex buffer otherwise
+    /// @param initial_bytes Starting capacity of every slot
+    /// @param label Debug label for the sokol buffers
+    void init(bool index_buffer, size_t initial_bytes, const char* label);
+    void shutdown();
+
+    /// Upload one frame's data into the next slot (growing it if needed)
+    /// Call at most once per frame. Returns the buffer to bind.
+    sg_buffer upload(const void* data, size_t bytes);
+
+    /// Capacity of the slot written by the last upload
+    size_t capacity() const;
+
+    /// Capacity of every slot in the ring (the GPU memory the ring holds)
+    size_t total_capacity() const;
+
+    /// Largest upload over the recent window
+    size_t high_water() const { return window_high_water; }
+
+    /// Number of times a slot was recreated to fit a larger frame
+    int grow_count() const { return grows; }
+
+  private:
+    void recreate_slot(int slot, size_t bytes);
+
+    sg_buffer buffers[FRAMES_IN_FLIGHT] = {};
+    size_t capacities[FRAMES_IN_FLIGHT] = {};
+    int current = 0;
+
+    bool is_index_buffer = false;
+    size_t minimum_bytes = 0;
+    const char* debug_label = nullptr;
+
+    // High-water tracking over a sliding window of uploads (shrink decisions)
+    size_t window_high_water = 0;
+    size_t previous_window_high_water = 0;
+    int window_frames = 0;
+
+    int grows = 0;
+    bool initialized = false;
+};
@@ -2,6 +2,7 @@
 #include "foundation/collision.h"
 #include "foundation/math_utils.h"
 #include "foundation/debug_assert.h"
+#include "foundation/profiler.h"
 #include <glm/gtc/constants.hpp>
 #include <glm/trigonometric.hpp>
 #include <algorithm>
@@ -120,6 +121,7 @@ void controller::apply_input(const controller_input_params& input_params,
 }
 
 void controller::update(const collision_world* world, float dt) {
+    FL_PROFILE_ZONE("controller::update");
     FL_PRECONDITION(dt > 0.0f, "dt must be positive for frame-rate independence");
     FL_PRECONDITION(std::isfinite(dt), "dt must be finite");
 
@@ -132,7 +134,10 @@ void controller::update_collision(const collision_world* world, float dt) {
     float wall_threshold = glm::cos(glm::radians(max_slope_angle));
 
     sphere_collision contact =
-        resolve_collisions(collision_sphere, *world, position, velocity, wall_threshold);
+        swept_collision ? move_and_slide(collision_sphere, *world, position, velocity,
+                                         wall_threshold, &collision_cache)
+                        : resolve_collisions(collision_sphere, *world, position, velocity,
+                                             wall_threshold, &collision_cache);
 
     // Store collision debug info
     collision_contact_debug.active = contact.hit;
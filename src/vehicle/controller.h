@@ -1,5 +1,6 @@
 #pragma once
 #include <glm/glm.hpp>
+#include "foundation/collision.h"
 #include "foundation/collision_primitives.h"
 #include "foundation/param_meta.h"
 #include "vehicle/friction_model.h"
@@ -17,6 +18,10 @@ struct controller {
     // Collision volumes
     sphere collision_sphere; // Single sphere used for all collision
 
+    // Boxes around recent moves, reused by collision resolution while the vehicle stays
+    // nearby (steady driving and resting skip the world query; see contact_cache)
+    contact_cache collision_cache;
+
     // State (source of truth)
     // NOTE: Position and velocity are ACCUMULATED STATE (integrated over time).
     // This is the CORRECT pattern for physics simulation - see PRINCIPLES.md.
@@ -71,6 +76,12 @@ struct controller {
     // Note: This is the authoritative value - collision system derives threshold from this
     float max_slope_angle = 45.0f; // degrees
 
+    // Continuous collision: sweep from the last resolved position to the integrated one and
+    // slide along the first surface hit (move_and_slide), so thin walls hold at any tick rate.
+    // Off (default): discrete push-out at the integrated position (tunnels once a tick's
+    // travel exceeds wall thickness + radius). Opt in for fast movers or coarse tick rates.
+    bool swept_collision = false;
+
     // TUNED: Turn rate for car-like control heading
     // Controls rotational speed when using heading-based movement
     // Higher values = faster turning (arcade feel)
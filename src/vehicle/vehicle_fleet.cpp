@@ -0,0 +1,253 @@
+#include "vehicle/vehicle_fleet.h"
+#include "vehicle/controller.h"
+#include "foundation/math_utils.h"
+#include "foundation/debug_assert.h"
+#include "foundation/profiler.h"
+#include "foundation/job_system.h"
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <cmath>
+
+// Bit-exactness with controller: every stage repeats the controller's float operations in the
+// same order (glm::length of a horizontal vector is sqrt((x*x + 0) + z*z) == sqrt(x*x + z*z),
+// glm::clamp is min(max(x, lo), hi), a + (-b) == a - b). Transcendentals (sin, cos, exp) use
+// the same libm calls in tight scalar passes; everything else runs in branch-free loops the
+// compiler vectorizes. This file and controller.cpp are built without FP contraction so FMA
+// availability can't make the two paths round differently.
+
+namespace {
+
+// Matches controller::update_physics zero-velocity snap thresholds
+constexpr float VELOCITY_EPSILON = 0.01f; // m/s
+constexpr float ACCEL_EPSILON = 0.01f;    // m/s²
+constexpr float MIN_DRAG = 1e-6f;         // 1/s (below: Euler fallback, as in controller)
+
+// Wrap every value to [-π, π] exactly as math::wrap_angle_radians does.
+// For x = angle + π in (-2π, 4π), fmod(x, 2π) is x or x - 2π, and x - 2π is exact there
+// (Sterbenz), so a compare-and-subtract gives identical bits without the libm call. Only a
+// turn step of more than a full revolution per tick leaves that range.
+void wrap_angles(float* values, size_t count) {
+    const float pi = glm::pi<float>();
+    const float two_pi = glm::two_pi<float>();
+    const float four_pi = 2.0f * two_pi;
+
+    int out_of_range = 0;
+    for (size_t i = 0; i < count; ++i) {
+        float x = values[i] + pi;
+        out_of_range += x > -two_pi && x < four_pi ? 0 : 1;
+    }
+
+    if (out_of_range > 0) {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = math::wrap_angle_radians(values[i]);
+        }
+        return;
+    }
+
+    // Selecting the offset (not the result): x - 0 and x + 0 only differ from x for x = -0,
+    // which maps to -π either way
+    for (size_t i = 0; i < count; ++i) {
+        float x = values[i] + pi;
+        float wrapped = x - (x >= two_pi ? two_pi : 0.0f);
+        wrapped = wrapped + (wrapped < 0.0f ? two_pi : 0.0f);
+        values[i] = wrapped - pi;
+    }
+}
+
+} // namespace
+
+void vehicle_fleet::clear() {
+    for (auto* array : {&position_x, &position_y, &position_z, &velocity_x, &velocity_y,
+                        &velocity_z, &heading_yaw, &angular_velocity, &move_x, &move_y,
+                        &turn_input, &accel, &max_speed, &mass, &turn_rate,
+                        &steering_reduction_factor, &brake_rate}) {
+        array->clear();
+    }
+    handbrake.clear();
+}
+
+void vehicle_fleet::reserve(size_t count) {
+    for (auto* array : {&position_x, &position_y, &position_z, &velocity_x, &velocity_y,
+                        &velocity_z, &heading_yaw, &angular_velocity, &move_x, &move_y,
+                        &turn_input, &accel, &max_speed, &mass, &turn_rate,
+                        &steering_reduction_factor, &brake_rate}) {
+        array->reserve(count);
+    }
+    handbrake.reserve(count);
+}
+
+size_t vehicle_fleet::add(const controller& source) {
+    FL_PRECONDITION(source.accel > 0.0f, "accel must be positive");
+    FL_PRECONDITION(source.max_speed > 0.0f, "max_speed must be positive");
+    FL_PRECONDITION(source.mass > 0.0f, "mass must be positive");
+    FL_PRECONDITION(source.steering_reduction_factor >= 0.0f &&
+                        source.steering_reduction_factor <= 1.0f,
+                    "steering_reduction_factor must be in [0, 1]");
+    FL_PRECONDITION(source.handbrake.brake_rate >= 0.0f, "brake_rate must be non-negative");
+
+    position_x.push_back(source.position.x);
+    position_y.push_back(source.position.y);
+    position_z.push_back(source.position.z);
+    velocity_x.push_back(source.velocity.x);
+    velocity_y.push_back(source.velocity.y);
+    velocity_z.push_back(source.velocity.z);
+    heading_yaw.push_back(source.heading_yaw);
+    angular_velocity.push_back(source.angular_velocity);
+
+    move_x.push_back(0.0f);
+    move_y.push_back(0.0f);
+    turn_input.push_back(0.0f);
+    handbrake.push_back(0);
+
+    accel.push_back(source.accel);
+    max_speed.push_back(source.max_speed);
+    mass.push_back(source.mass);
+    turn_rate.push_back(source.turn_rate);
+    steering_reduction_factor.push_back(source.steering_reduction_factor);
+    brake_rate.push_back(source.handbrake.brake_rate);
+
+    return size() - 1;
+}
+
+void vehicle_fleet::set_input(size_t index, const controller_input_params& input) {
+    FL_PRECONDITION(index < size(), "vehicle index out of range");
+    FL_PRECONDITION(std::isfinite(input.turn_input), "turn_input must be finite");
+
+    move_x[index] = input.move_direction.x;
+    move_y[index] = input.move_direction.y;
+    turn_input[index] = input.turn_input;
+    handbrake[index] = input.handbrake ? 1 : 0;
+}
+
+void vehicle_fleet::update(float dt, job_system* jobs) {
+    FL_PROFILE_ZONE("vehicle_fleet::update");
+    FL_PRECONDITION(dt > 0.0f && std::isfinite(dt), "dt must be positive and finite");
+
+    // Blocks keep each stage's arrays cache-resident between passes; one pass over the whole
+    // fleet per stage would be memory-bound at large counts. Vehicles are independent, so
+    // blocks can run on any thread in any order.
+    const size_t count = size();
+    const size_t blocks = (count + UPDATE_BLOCK - 1) / UPDATE_BLOCK;
+    parallel_for(jobs, blocks, JOB_GRAIN_BLOCKS, [this, count, dt](size_t first, size_t last) {
+        for (size_t block = first; block < last; ++block) {
+            size_t begin = block * UPDATE_BLOCK;
+            update_block(begin, std::min(UPDATE_BLOCK, count - begin), dt);
+        }
+    });
+}
+
+void vehicle_fleet::update_block(size_t begin, size_t count, float dt) {
+    float* px = position_x.data() + begin;
+    float* py = position_y.data() + begin;
+    float* pz = position_z.data() + begin;
+    float* vx = velocity_x.data() + begin;
+    float* vy = velocity_y.data() + begin;
+    float* vz = velocity_z.data() + begin;
+    float* yaw = heading_yaw.data() + begin;
+    float* yaw_rate = angular_velocity.data() + begin;
+    const float* mx = move_x.data() + begin;
+    const float* my = move_y.data() + begin;
+    const float* turn = turn_input.data() + begin;
+    const uint8_t* brake = handbrake.data() + begin;
+    const float* acc = accel.data() + begin;
+    const float* top_speed = max_speed.data() + begin;
+    const float* m = mass.data() + begin;
+    const float* rate = turn_rate.data() + begin;
+    const float* reduction = steering_reduction_factor.data() + begin;
+    const float* brake_k = brake_rate.data() + begin;
+
+    // Per-block scratch (14 KiB of stack; locals also let the compiler rule out aliasing)
+    float sin_yaw[UPDATE_BLOCK];
+    float cos_yaw[UPDATE_BLOCK];
+    float previous_yaw[UPDATE_BLOCK];
+    float ax[UPDATE_BLOCK];
+    float az[UPDATE_BLOCK];
+    float drag[UPDATE_BLOCK];
+    float decay[UPDATE_BLOCK];
+
+    // Movement basis from the pre-integration heading (game_world builds it before
+    // apply_input), and the previous heading for angular velocity
+    for (size_t i = 0; i < count; ++i) {
+        sin_yaw[i] = std::sin(yaw[i]);
+        cos_yaw[i] = std::cos(yaw[i]);
+        previous_yaw[i] = yaw[i];
+    }
+
+    // apply_input: speed-dependent steering and heading integration
+    for (size_t i = 0; i < count; ++i) {
+        float speed = std::sqrt(vx[i] * vx[i] + vz[i] * vz[i]);
+        float speed_ratio = speed / top_speed[i];
+        speed_ratio = speed_ratio < 0.0f ? 0.0f : speed_ratio;
+        speed_ratio = 1.0f < speed_ratio ? 1.0f : speed_ratio;
+        float steering_multiplier = 1.0f - (speed_ratio * reduction[i]);
+
+        yaw[i] += -turn[i] * rate[i] * steering_multiplier * dt;
+    }
+    wrap_angles(yaw, count);
+
+    // Angular velocity from the wrap-safe heading change
+    for (size_t i = 0; i < count; ++i) {
+        yaw_rate[i] = yaw[i] - previous_yaw[i];
+    }
+    wrap_angles(yaw_rate, count);
+    for (size_t i = 0; i < count; ++i) {
+        yaw_rate[i] = yaw_rate[i] / dt;
+    }
+
+    // Input acceleration in the heading basis (forward * move.y + right * move.x). One output
+    // per loop keeps the runtime alias checks within what the vectorizer will version for
+    for (size_t i = 0; i < count; ++i) {
+        ax[i] = (sin_yaw[i] * my[i] + cos_yaw[i] * mx[i]) * acc[i];
+    }
+    for (size_t i = 0; i < count; ++i) {
+        az[i] = (cos_yaw[i] * my[i] + -sin_yaw[i] * mx[i]) * acc[i];
+    }
+
+    // update_physics: drag coefficient (friction_model base drag + handbrake contribution)
+    for (size_t i = 0; i < count; ++i) {
+        float brake_rate_i = brake_k[i];
+        float handbrake_drag = brake[i] != 0 ? brake_rate_i : 0.0f;
+        drag[i] = acc[i] / top_speed[i] + handbrake_drag;
+        decay[i] = -drag[i] * dt;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        decay[i] = std::exp(decay[i]);
+    }
+
+    // Exponential horizontal drag and zero-velocity snap. Both integrators are computed and
+    // one selected so the loop stays branch-free (k > 0, so the division is always safe)
+    for (size_t i = 0; i < count; ++i) {
+        float k = drag[i];
+        float d = decay[i];
+
+        float euler_x = vx[i] + ax[i] * dt;
+        float euler_z = vz[i] + az[i] * dt;
+        float exact_x = vx[i] * d + (ax[i] / k) * (1.0f - d);
+        float exact_z = vz[i] * d + (az[i] / k) * (1.0f - d);
+        bool negligible_drag = k < MIN_DRAG;
+        float next_x = negligible_drag ? euler_x : exact_x;
+        float next_z = negligible_drag ? euler_z : exact_z;
+
+        float horizontal_speed = std::sqrt(next_x * next_x + next_z * next_z);
+        float accel_magnitude = std::sqrt(ax[i] * ax[i] + az[i] * az[i]);
+        bool at_rest = horizontal_speed < VELOCITY_EPSILON && accel_magnitude < ACCEL_EPSILON;
+        vx[i] = at_rest ? 0.0f : next_x;
+        vz[i] = at_rest ? 0.0f : next_z;
+    }
+
+    // Vertical: weight only, semi-implicit Euler (no drag)
+    for (size_t i = 0; i < count; ++i) {
+        float weight_accel = (m[i] * -math::GRAVITY) / m[i];
+        vy[i] += weight_accel * dt;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        px[i] += vx[i] * dt;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        py[i] += vy[i] * dt;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        pz[i] += vz[i] * dt;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "vehicle/controller_input_params.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct controller;
+class job_system;
+
+/**
+ * vehicle_fleet
+ *
+ * Data-oriented simulation of many vehicles: the controller::apply_input + update_physics
+ * math (speed-dependent steering, heading wrap, exponential drag, gravity, zero-velocity
+ * snap) over structure-of-arrays state, one pass per stage so the arithmetic vectorizes.
+ *
+ * Results match controller bit-for-bit when the controller is driven with the heading
+ * basis (as game_world does) and has no collision contact; see tests/vehicle. Collision
+ * and grounding are not part of the fleet.
+ *
+ * Per-vehicle layout: index i in every array is one vehicle.
+ */
+struct vehicle_fleet {
+    // State (integrated)
+    std::vector<float> position_x, position_y, position_z; // meters
+    std::vector<float> velocity_x, velocity_y, velocity_z; // meters/second
+    std::vector<float> heading_yaw;      // radians [-π, π] (positive = clockwise/right turn)
+    std::vector<float> angular_velocity; // radians/second (derived from heading change)
+
+    // Input for the next update (held until changed)
+    std::vector<float> move_x, move_y; // normalized move direction in the heading basis
+    std::vector<float> turn_input;     // [-1, 1] (positive = right turn)
+    std::vector<uint8_t> handbrake;    // 1 = engaged
+
+    // Tuning (per vehicle, same meaning as the controller fields)
+    std::vector<float> accel;                     // m/s²
+    std::vector<float> max_speed;                 // m/s
+    std::vector<float> mass;                      // kg
+    std::vector<float> turn_rate;                 // radians/second
+    std::vector<float> steering_reduction_factor; // dimensionless [0, 1]
+    std::vector<float> brake_rate;                // 1/s (handbrake drag contribution)
+
+    size_t size() const { return heading_yaw.size(); }
+    void clear();
+    void reserve(size_t count);
+
+    // Append a vehicle with the controller's state and tuning; returns its index
+    size_t add(const controller& source);
+
+    void set_input(size_t index, const controller_input_params& input);
+
+    // One fixed step of apply_input + update_physics for every vehicle. With `jobs`, blocks
+    // of vehicles run in parallel; results are identical either way.
+    void update(float dt, job_system* jobs = nullptr);
+
+  private:
+    static constexpr size_t UPDATE_BLOCK = 512; // vehicles per cache-resident update block
+    static constexpr size_t JOB_GRAIN_BLOCKS = 8; // blocks per parallel task (~50 µs)
+
+    void update_block(size_t begin, size_t count, float dt);
+};
@@ -0,0 +1,331 @@
+// Level File Tests
+// Verifies the binary level format round trip: a loaded level is used in place (borrowed,
+// not copied) and resolves collisions exactly like the world it was written from; damaged
+// files are rejected at open, and over-deep BVHs by validation
+
+#include "app/level_file.h"
+#include "app/game_world.h"
+#include "foundation/collision.h"
+#include "rendering/scene.h"
+#include "test_common.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+std::string temp_path(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::vector<unsigned char> read_bytes(const std::string& path) {
+    std::vector<unsigned char> bytes(std::filesystem::file_size(path));
+    FILE* file = std::fopen(path.c_str(), "rb");
+    size_t read = std::fread(bytes.data(), 1, bytes.size(), file);
+    std::fclose(file);
+    bytes.resize(read);
+    return bytes;
+}
+
+void write_bytes(const std::string& path, const std::vector<unsigned char>& bytes) {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    std::fwrite(bytes.data(), 1, bytes.size(), file);
+    std::fclose(file);
+}
+
+collision_world random_world(int box_count, float extent) {
+    static const collision_surface_type types[] = {
+        collision_surface_type::FLOOR, collision_surface_type::WALL,
+        collision_surface_type::PLATFORM, collision_surface_type::NONE};
+    collision_world world;
+    for (int i = 0; i < box_count; ++i) {
+        world.boxes.push_back(random_box(extent, types[i % 4]));
+    }
+    build_broadphase(world);
+    return world;
+}
+
+// Test 1: The shipped text level describes the same geometry as setup_test_level
+void test_text_level_matches_test_level() {
+    app::level_description description;
+    std::string error;
+    std::string path = std::string(FROGLORDS_SOURCE_DIR) + "/levels/test_level.txt";
+    TEST_ASSERT(app::load_level_description(path.c_str(), description, error), error.c_str());
+
+    game_world world;
+    setup_test_level(world);
+    const auto& expected = world.world_geometry.boxes;
+    TEST_ASSERT(description.boxes.size() == expected.size(), "Same box count");
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const collision_box& a = description.boxes[i];
+        const collision_box& b = expected[i];
+        // Text holds decimal values; setup_test_level computes a few of them
+        glm::vec3 center_error = glm::abs(a.bounds.center - b.bounds.center);
+        glm::vec3 extent_error = glm::abs(a.bounds.half_extents - b.bounds.half_extents);
+        TEST_ASSERT(!glm::any(glm::greaterThan(center_error, glm::vec3(1e-6f))), "Same center");
+        TEST_ASSERT(!glm::any(glm::greaterThan(extent_error, glm::vec3(1e-6f))), "Same extents");
+        TEST_ASSERT(a.type == b.type, "Same surface type");
+    }
+
+    TEST_ASSERT(description.meshes.size() == world.scn.object_count(), "Same mesh count");
+    TEST_ASSERT(description.meshes[0].vertices.size() == world.scn.objects()[0].vertices.size(),
+                "Same floor mesh");
+}
+
+// Test 2: Written, mapped and used in place, a level resolves exactly like its source world
+void test_round_trip_resolves_identically() {
+    const float extent = 25.0f;
+    collision_world source = random_world(400, extent);
+    std::vector<foundation::wireframe_mesh> meshes;
+    meshes.push_back(foundation::generate_grid_floor(20.0f, 8));
+    foundation::wireframe_mesh box_mesh = foundation::generate_box({2.0f, 1.0f, 3.0f});
+    box_mesh.position = glm::vec3(1.0f, 2.0f, 3.0f);
+    box_mesh.rotation = glm::vec3(0.0f, 0.5f, 0.0f);
+    meshes.push_back(box_mesh);
+
+    std::string path = temp_path("froglords_test_round_trip.flvl");
+    TEST_ASSERT(app::write_level_file(path.c_str(), source, meshes), "Level written");
+
+    app::level_file level;
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::OK, "Level opens");
+    std::string error;
+    TEST_ASSERT(app::validate_level_contents(level, error), error.c_str());
+    TEST_ASSERT(level.box_count() == 400 && level.mesh_count() == 2, "Counts preserved");
+
+    collision_world loaded;
+    scene scn;
+    app::use_level(level, loaded, scn);
+    TEST_ASSERT(loaded.boxes.is_borrowed() && loaded.bvh.nodes.is_borrowed() &&
+                    loaded.soa.min_x.is_borrowed(),
+                "Arrays are used in place");
+    const collision_world& view_world = loaded;
+    TEST_ASSERT(view_world.boxes.data() ==
+                    level.section<collision_box>(app::level_section::BOXES).data(),
+                "Boxes point into the mapping");
+    TEST_ASSERT(loaded.bvh.source_count == 400 && loaded.soa.source_count == 400,
+                "Broadphase is current without a rebuild");
+
+    // Scene geometry matches the meshes' line lists and transforms
+    TEST_ASSERT(scn.object_count() == 2, "Both meshes in the scene");
+    const scene_mesh& view = scn.objects()[1];
+    TEST_ASSERT(view.vertices.size() == box_mesh.vertices.size(), "Vertex count preserved");
+    TEST_ASSERT(view.indices.size() == box_mesh.edges.size() * 2, "Two indices per edge");
+    for (size_t i = 0; i < box_mesh.edges.size(); ++i) {
+        TEST_ASSERT(view.indices[i * 2] == static_cast<uint32_t>(box_mesh.edges[i].v0) &&
+                        view.indices[i * 2 + 1] == static_cast<uint32_t>(box_mesh.edges[i].v1),
+                    "Edges preserved");
+    }
+    TEST_ASSERT(view.position == box_mesh.position && view.rotation == box_mesh.rotation,
+                "Transform preserved");
+
+    // A sphere wandering through both worlds must agree exactly every step
+    const float dt = 1.0f / 60.0f;
+    int contacts = 0;
+    for (bool swept : {false, true}) {
+        sphere a{glm::vec3(0.0f), 0.5f};
+        sphere b = a;
+        glm::vec3 heading(0.0f);
+        for (int step = 0; step < 3000; ++step) {
+            if (step % 40 == 0) {
+                heading = random_vec3(-6.0f, 6.0f);
+            }
+            glm::vec3 velocity = heading - a.center * (0.5f / extent);
+            glm::vec3 a_velocity = velocity;
+            glm::vec3 b_velocity = velocity;
+            glm::vec3 a_position = a.center + velocity * dt;
+            glm::vec3 b_position = b.center + velocity * dt;
+
+            sphere_collision ca;
+            sphere_collision cb;
+            if (swept) {
+                ca = move_and_slide(a, source, a_position, a_velocity, 0.707f);
+                cb = move_and_slide(b, loaded, b_position, b_velocity, 0.707f);
+            } else {
+                ca = resolve_collisions(a, source, a_position, a_velocity, 0.707f);
+                cb = resolve_collisions(b, loaded, b_position, b_velocity, 0.707f);
+            }
+            TEST_ASSERT(a_position == b_position, "Positions must match exactly");
+            TEST_ASSERT(a_velocity == b_velocity, "Velocities must match exactly");
+            TEST_ASSERT(ca.hit == cb.hit && ca.normal == cb.normal, "Contacts must match");
+            contacts += ca.hit ? 1 : 0;
+        }
+    }
+    TEST_ASSERT(contacts > 100, "Wandering must touch boxes");
+    TEST_ASSERT(loaded.boxes.is_borrowed(), "Resolving never copies the level");
+    std::filesystem::remove(path);
+}
+
+// Test 3: Editing a loaded world copies first and never writes through to the file
+void test_edits_copy_on_write() {
+    collision_world source = random_world(50, 10.0f);
+    std::string path = temp_path("froglords_test_edit.flvl");
+    TEST_ASSERT(app::write_level_file(path.c_str(), source, {}), "Level written");
+
+    app::level_file level;
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::OK, "Level opens");
+    collision_world loaded;
+    scene scn;
+    app::use_level(level, loaded, scn);
+
+    collision_box extra;
+    extra.bounds = aabb{glm::vec3(0.0f, 50.0f, 0.0f), glm::vec3(1.0f)};
+    loaded.boxes.push_back(extra);
+    loaded.boxes[0].type = collision_surface_type::WALL;
+    TEST_ASSERT(!loaded.boxes.is_borrowed() && loaded.boxes.size() == 51, "Boxes detached");
+    build_broadphase(loaded);
+
+    std::span<const collision_box> mapped = level.section<collision_box>(app::level_section::BOXES);
+    TEST_ASSERT(mapped.size() == 50 && mapped[0].type == source.boxes[0].type,
+                "Mapped level unchanged");
+
+    sphere s{glm::vec3(0.0f, 50.0f, 0.0f), 0.5f};
+    glm::vec3 position(0.0f, 50.5f, 0.0f);
+    glm::vec3 velocity(0.0f, -1.0f, 0.0f);
+    TEST_ASSERT(resolve_collisions(s, loaded, position, velocity, 0.707f).hit,
+                "Added box collides after rebuild");
+
+    // Dynamic boxes work on a loaded level without touching the static arrays
+    TEST_ASSERT(add_dynamic_box(loaded, extra) == 0, "Dynamic box added");
+    std::filesystem::remove(path);
+}
+
+// Test 4: Damaged or foreign files are rejected at open
+void test_rejects_bad_files() {
+    collision_world source = random_world(20, 10.0f);
+    std::vector<foundation::wireframe_mesh> meshes{foundation::generate_box({1.0f, 1.0f, 1.0f})};
+    std::string path = temp_path("froglords_test_bad.flvl");
+    TEST_ASSERT(app::write_level_file(path.c_str(), source, meshes), "Level written");
+    std::vector<unsigned char> good = read_bytes(path);
+
+    app::level_file level;
+    TEST_ASSERT(level.open(temp_path("froglords_missing.flvl").c_str()) ==
+                    app::level_file_status::CANNOT_OPEN,
+                "Missing file");
+
+    std::vector<unsigned char> bytes = good;
+    bytes[0] = 'X';
+    write_bytes(path, bytes);
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::BAD_HEADER, "Bad magic");
+    TEST_ASSERT(!level.is_open(), "Rejected file is closed");
+
+    bytes = good;
+    auto* header = reinterpret_cast<app::level_file_header*>(bytes.data());
+    header->version = app::LEVEL_FILE_VERSION + 1;
+    write_bytes(path, bytes);
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::VERSION_MISMATCH,
+                "Other version");
+
+    bytes = good;
+    bytes.resize(bytes.size() - 64);
+    write_bytes(path, bytes);
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::CORRUPT, "Truncated");
+
+    bytes = good;
+    header = reinterpret_cast<app::level_file_header*>(bytes.data());
+    header->sections[static_cast<size_t>(app::level_section::BOXES)].count = 1ull << 40;
+    write_bytes(path, bytes);
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::CORRUPT, "Out of bounds");
+
+    bytes = good;
+    header = reinterpret_cast<app::level_file_header*>(bytes.data());
+    header->sections[static_cast<size_t>(app::level_section::BVH_ITEM_INDICES)].count -= 1;
+    write_bytes(path, bytes);
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::CORRUPT, "Inconsistent");
+
+    bytes = good;
+    header = reinterpret_cast<app::level_file_header*>(bytes.data());
+    auto* record = reinterpret_cast<app::level_mesh_record*>(
+        bytes.data() + header->sections[static_cast<size_t>(app::level_section::MESHES)].offset);
+    record->vertex_count += 1;
+    write_bytes(path, bytes);
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::CORRUPT,
+                "Mesh range past its section");
+
+    write_bytes(path, good);
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::OK, "Original opens");
+    level = app::level_file();
+    std::filesystem::remove(path);
+}
+
+// World whose prebuilt BVH is a chain `depth` levels deep (every interior node has a leaf on
+// the left), as a hand-edited or foreign file could contain
+collision_world chain_bvh_world(int depth) {
+    collision_world world = make_random_world(depth + 1, 10.0f, false);
+    for (int d = 0; d <= depth; ++d) {
+        bvh_node interior;
+        interior.first = static_cast<uint32_t>(2 * d + 1);
+        bvh_node leaf;
+        leaf.first = static_cast<uint32_t>(d);
+        leaf.count = 1;
+        for (bvh_node* node : {&interior, &leaf}) {
+            node->bounds_min = glm::vec3(-20.0f);
+            node->bounds_max = glm::vec3(20.0f);
+        }
+        if (d < depth) {
+            world.bvh.nodes.push_back(interior);
+            world.bvh.nodes.push_back(leaf);
+        } else {
+            world.bvh.nodes.push_back(leaf);
+        }
+
+        const aabb& box = world.boxes[static_cast<size_t>(d)].bounds;
+        world.bvh.item_indices.push_back(static_cast<uint32_t>(d));
+        world.bvh.item_min.push_back(box.center - box.half_extents);
+        world.bvh.item_max.push_back(box.center + box.half_extents);
+    }
+    world.bvh.source_count = world.boxes.size();
+    return world;
+}
+
+// Test 5: A prebuilt BVH deeper than the traversal stacks allow fails validation
+void test_rejects_deep_bvh() {
+    std::string path = temp_path("froglords_test_deep.flvl");
+    std::string error;
+
+    TEST_ASSERT(app::write_level_file(path.c_str(), chain_bvh_world(BVH_MAX_DEPTH), {}),
+                "Level written");
+    app::level_file level;
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::OK, "Level opens");
+    TEST_ASSERT(app::validate_level_contents(level, error), "Maximum depth is accepted");
+
+    TEST_ASSERT(app::write_level_file(path.c_str(), chain_bvh_world(BVH_MAX_DEPTH + 1), {}),
+                "Level written");
+    level = app::level_file();
+    TEST_ASSERT(level.open(path.c_str()) == app::level_file_status::OK, "Level opens");
+    TEST_ASSERT(!app::validate_level_contents(level, error), "One level deeper is rejected");
+
+    level = app::level_file();
+    std::filesystem::remove(path);
+}
+
+int main() {
+    printf("=== Level File Tests ===\n\n");
+
+    RUN_TEST(test_text_level_matches_test_level);
+    RUN_TEST(test_round_trip_resolves_identically);
+    RUN_TEST(test_edits_copy_on_write);
+    RUN_TEST(test_rejects_bad_files);
+    RUN_TEST(test_rejects_deep_bvh);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,124 @@
+// Level Streaming Tests
+// Verifies chunk partitioning and the per-chunk memory budget charge. Loading, eviction and
+// reload along a path run on the loader thread and are exercised by the headless --stream run
+
+#include "app/level_streaming.h"
+#include "test_common.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+constexpr float LEVEL_EXTENT = 400.0f; // level spans [-extent, extent] on X and Z
+constexpr float CHUNK_SIZE = 50.0f;
+
+// A wide flat level: boxes scattered over XZ, one wireframe marker per 20 boxes
+app::level_description make_level(int box_count) {
+    app::level_description level;
+    for (int i = 0; i < box_count; ++i) {
+        collision_box box;
+        box.bounds.center = glm::vec3(random_float(-LEVEL_EXTENT, LEVEL_EXTENT),
+                                      random_float(0.0f, 5.0f),
+                                      random_float(-LEVEL_EXTENT, LEVEL_EXTENT));
+        box.bounds.half_extents = random_vec3(0.2f, 3.0f);
+        box.type = i % 3 == 0 ? collision_surface_type::WALL : collision_surface_type::FLOOR;
+        level.boxes.push_back(box);
+        if (i % 20 == 0) {
+            foundation::wireframe_mesh marker = foundation::generate_box();
+            marker.position = box.bounds.center;
+            level.meshes.push_back(marker);
+        }
+    }
+    return level;
+}
+
+std::string manifest_path() {
+    std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "froglords_test_streaming";
+    std::filesystem::create_directories(directory);
+    return (directory / "level.manifest").string();
+}
+
+// Test 1: Every box and mesh lands in exactly one chunk, inside its bounds
+void test_partition() {
+    app::level_description level = make_level(3000);
+    std::string path = manifest_path();
+    std::string error;
+    TEST_ASSERT(app::write_chunked_level(path.c_str(), level, CHUNK_SIZE, error), error.c_str());
+
+    app::level_manifest manifest;
+    TEST_ASSERT(app::load_level_manifest(path.c_str(), manifest, error), error.c_str());
+    TEST_ASSERT(manifest.chunk_size == CHUNK_SIZE, "Chunk size preserved");
+    TEST_ASSERT(manifest.chunks.size() > 100, "Level splits into many chunks");
+
+    size_t boxes = 0;
+    size_t meshes = 0;
+    for (const app::level_chunk_info& chunk : manifest.chunks) {
+        app::level_file file;
+        TEST_ASSERT(file.open(chunk.path.c_str()) == app::level_file_status::OK, "Chunk opens");
+        TEST_ASSERT(file.file_size() == chunk.bytes, "Manifest records the chunk size");
+        for (const collision_box& box : file.section<collision_box>(app::level_section::BOXES)) {
+            glm::vec3 lo = box.bounds.center - box.bounds.half_extents;
+            glm::vec3 hi = box.bounds.center + box.bounds.half_extents;
+            TEST_ASSERT(!glm::any(glm::greaterThan(chunk.bounds_min, lo)) &&
+                            !glm::any(glm::greaterThan(hi, chunk.bounds_max)),
+                        "Chunk bounds hold its boxes");
+            TEST_ASSERT(static_cast<int>(std::floor(box.bounds.center.x / CHUNK_SIZE)) ==
+                                chunk.x &&
+                            static_cast<int>(std::floor(box.bounds.center.z / CHUNK_SIZE)) ==
+                                chunk.z,
+                        "Box belongs to the tile holding its center");
+        }
+        boxes += file.box_count();
+        meshes += file.mesh_count();
+    }
+    TEST_ASSERT(boxes == level.boxes.size(), "Every box in one chunk");
+    TEST_ASSERT(meshes == level.meshes.size(), "Every mesh in one chunk");
+}
+
+// Test 2: A chunk is charged its file plus a bound on its share of the merged collision arrays
+void test_chunk_budget() {
+    app::level_chunk_info empty;
+    TEST_ASSERT(app::chunk_budget_bytes(empty) == 0, "Empty chunk costs nothing");
+
+    app::level_chunk_info one_box;
+    one_box.bytes = sizeof(collision_box);
+    uint64_t per_box = app::chunk_budget_bytes(one_box) - one_box.bytes;
+    TEST_ASSERT(per_box >= 2 * sizeof(collision_box),
+                "Covers the installed copy and one rebuild of the box");
+
+    app::level_chunk_info chunk;
+    chunk.bytes = 1001 * sizeof(collision_box) - 1; // the partial box does not count
+    TEST_ASSERT(app::chunk_budget_bytes(chunk) == chunk.bytes + 1000 * per_box,
+                "Charge scales with the boxes the file can hold");
+}
+
+int main() {
+    printf("=== Level Streaming Tests ===\n\n");
+
+    RUN_TEST(test_partition);
+    RUN_TEST(test_chunk_budget);
+
+    std::filesystem::remove_all(std::filesystem::path(manifest_path()).parent_path());
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,227 @@
+// Stress Level Tests
+// Verifies that generated levels have exactly the requested box count, are reproducible from
+// their name, keep the spawn area clear, and that their outlines match the boxes
+
+#include "app/stress_level.h"
+#include "foundation/collision.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+const app::stress_layout LAYOUTS[] = {app::stress_layout::CITY_GRID, app::stress_layout::CLUTTER,
+                                      app::stress_layout::STAIRCASES,
+                                      app::stress_layout::CORRIDORS};
+
+app::level_description generate(app::stress_layout layout, size_t box_count, uint32_t seed,
+                                bool meshes = true) {
+    app::stress_level_params params;
+    params.layout = layout;
+    params.box_count = box_count;
+    params.seed = seed;
+    params.meshes = meshes;
+    app::level_description level;
+    app::generate_stress_level(params, level);
+    return level;
+}
+
+bool same_boxes(const app::level_description& a, const app::level_description& b) {
+    return a.boxes.size() == b.boxes.size() &&
+           std::memcmp(a.boxes.data(), b.boxes.data(), a.boxes.size() * sizeof(collision_box)) ==
+               0;
+}
+
+// Test 1: Every layout produces exactly the requested boxes and one outline per box
+void test_exact_counts() {
+    const size_t counts[] = {1, 2, 33, 1000, 12345};
+    for (app::stress_layout layout : LAYOUTS) {
+        for (size_t count : counts) {
+            app::level_description level = generate(layout, count, 1);
+            TEST_ASSERT(level.boxes.size() == count, "Exact box count");
+
+            size_t batches = (count + app::STRESS_MESH_BATCH - 1) / app::STRESS_MESH_BATCH;
+            TEST_ASSERT(level.meshes.size() == batches, "One mesh per batch of boxes");
+            size_t edges = 0;
+            for (const foundation::wireframe_mesh& mesh : level.meshes) {
+                edges += mesh.edges.size();
+            }
+            TEST_ASSERT(edges == count * 12, "Twelve outline edges per box");
+        }
+    }
+
+    app::level_description bare = generate(app::stress_layout::CLUTTER, 1000, 1, false);
+    TEST_ASSERT(bare.boxes.size() == 1000, "Collision-only level keeps its boxes");
+    TEST_ASSERT(bare.meshes.empty(), "Collision-only level has no meshes");
+}
+
+// Test 2: The seed alone determines the level
+void test_reproducible() {
+    for (app::stress_layout layout : LAYOUTS) {
+        app::level_description a = generate(layout, 5000, 42);
+        app::level_description b = generate(layout, 5000, 42);
+        app::level_description c = generate(layout, 5000, 43);
+        TEST_ASSERT(same_boxes(a, b), "Same seed, same boxes");
+        TEST_ASSERT(!same_boxes(a, c), "Different seed, different boxes");
+    }
+}
+
+// Test 3: Boxes rest on a ground that covers them and leave the spawn area clear
+void test_boxes_valid() {
+    for (app::stress_layout layout : LAYOUTS) {
+        app::level_description level = generate(layout, 20000, 7, false);
+        const aabb& ground = level.boxes[0].bounds;
+        TEST_ASSERT(level.boxes[0].type == collision_surface_type::FLOOR, "Ground is a floor");
+        TEST_ASSERT(std::abs(ground.center.y + ground.half_extents.y) < 1e-6f, "Ground top at 0");
+
+        for (size_t i = 1; i < level.boxes.size(); ++i) {
+            const aabb& b = level.boxes[i].bounds;
+            glm::vec3 lo = b.center - b.half_extents;
+            glm::vec3 hi = b.center + b.half_extents;
+            TEST_ASSERT(b.half_extents.x > 0.0f && b.half_extents.y > 0.0f &&
+                            b.half_extents.z > 0.0f,
+                        "Positive extents");
+            TEST_ASSERT(lo.y >= -1e-5f, "Nothing below the ground");
+            TEST_ASSERT(lo.x >= ground.center.x - ground.half_extents.x - 1e-3f &&
+                            hi.x <= ground.center.x + ground.half_extents.x + 1e-3f &&
+                            lo.z >= ground.center.z - ground.half_extents.z - 1e-3f &&
+                            hi.z <= ground.center.z + ground.half_extents.z + 1e-3f,
+                        "Ground covers the footprint");
+
+            bool in_spawn = lo.x < app::STRESS_SPAWN_CLEARANCE &&
+                            hi.x > -app::STRESS_SPAWN_CLEARANCE &&
+                            lo.z < app::STRESS_SPAWN_CLEARANCE &&
+                            hi.z > -app::STRESS_SPAWN_CLEARANCE;
+            TEST_ASSERT(!in_spawn, "Spawn area clear");
+        }
+    }
+}
+
+// Test 4: Each layout builds its characteristic shapes
+void test_layouts() {
+    // City: every building is a wall with a floor roof resting on it
+    app::level_description city = generate(app::stress_layout::CITY_GRID, 1001, 3, false);
+    for (size_t i = 1; i + 1 < city.boxes.size(); i += 2) {
+        const collision_box& building = city.boxes[i];
+        const collision_box& roof = city.boxes[i + 1];
+        TEST_ASSERT(building.type == collision_surface_type::WALL, "Building walls");
+        TEST_ASSERT(roof.type == collision_surface_type::FLOOR, "Roof is walkable");
+        float top = building.bounds.center.y + building.bounds.half_extents.y;
+        float roof_bottom = roof.bounds.center.y - roof.bounds.half_extents.y;
+        TEST_ASSERT(std::abs(top - roof_bottom) < 1e-4f, "Roof sits on the building");
+    }
+
+    // Staircases: each flight of steps rises by the same amount per step
+    app::level_description stairs = generate(app::stress_layout::STAIRCASES, 801, 3, false);
+    for (size_t first = 1; first + 8 <= stairs.boxes.size(); first += 8) {
+        float rise = stairs.boxes[first].bounds.half_extents.y * 2.0f;
+        for (size_t step = 0; step < 8; ++step) {
+            const collision_box& box = stairs.boxes[first + step];
+            TEST_ASSERT(box.type == collision_surface_type::FLOOR, "Steps are floors");
+            float height = box.bounds.half_extents.y * 2.0f;
+            TEST_ASSERT(std::abs(height - rise * static_cast<float>(step + 1)) < 1e-4f,
+                        "Even rise");
+        }
+    }
+
+    // Corridors: everything past the ground is a wall
+    app::level_description corridors = generate(app::stress_layout::CORRIDORS, 4001, 3, false);
+    for (size_t i = 1; i < corridors.boxes.size(); ++i) {
+        TEST_ASSERT(corridors.boxes[i].type == collision_surface_type::WALL, "Corridor walls");
+    }
+}
+
+// Test 5: Outline corners sit on the box corners they draw
+void test_outlines_match_boxes() {
+    for (app::stress_layout layout : LAYOUTS) {
+        app::level_description level = generate(layout, 3000, 9);
+        for (size_t i = 0; i < level.boxes.size(); ++i) {
+            const foundation::wireframe_mesh& mesh = level.meshes[i / app::STRESS_MESH_BATCH];
+            size_t base = (i % app::STRESS_MESH_BATCH) * 8;
+            const aabb& b = level.boxes[i].bounds;
+            // Corner 0 is (-x, -y, +z), corner 7 is (+x, +y, -z)
+            glm::vec3 corner0 = mesh.position + mesh.vertices[base];
+            glm::vec3 corner7 = mesh.position + mesh.vertices[base + 7];
+            glm::vec3 expected0 = b.center + glm::vec3(-1.0f, -1.0f, 1.0f) * b.half_extents;
+            glm::vec3 expected7 = b.center + glm::vec3(1.0f, 1.0f, -1.0f) * b.half_extents;
+            TEST_ASSERT(glm::length(corner0 - expected0) < 1e-3f, "Outline corner 0");
+            TEST_ASSERT(glm::length(corner7 - expected7) < 1e-3f, "Outline corner 7");
+        }
+    }
+}
+
+// Test 6: Level names parse into layout, count and seed; malformed names are rejected
+void test_names() {
+    app::stress_level_params params;
+    TEST_ASSERT(app::parse_stress_level_name("city/100000", params), "Plain name");
+    TEST_ASSERT(params.layout == app::stress_layout::CITY_GRID, "City layout");
+    TEST_ASSERT(params.box_count == 100000 && params.seed == 1, "Count, default seed");
+
+    TEST_ASSERT(app::parse_stress_level_name("clutter/1m/7", params), "Millions and seed");
+    TEST_ASSERT(params.layout == app::stress_layout::CLUTTER, "Clutter layout");
+    TEST_ASSERT(params.box_count == 1000000 && params.seed == 7, "1m, seed 7");
+
+    TEST_ASSERT(app::parse_stress_level_name("stairs/5k", params), "Thousands");
+    TEST_ASSERT(params.box_count == 5000, "5k");
+    TEST_ASSERT(app::parse_stress_level_name("corridors/10/0", params), "Seed 0");
+    TEST_ASSERT(params.layout == app::stress_layout::CORRIDORS && params.seed == 0,
+                "Corridors, seed 0");
+
+    params.meshes = false;
+    TEST_ASSERT(app::parse_stress_level_name("city/10", params), "Parse keeps meshes flag");
+    TEST_ASSERT(!params.meshes, "Meshes flag untouched");
+
+    const char* bad[] = {"city",       "town/10",   "city/0",   "city/10x", "city/10/",
+                         "city/10/x",  "city/-5",   "cityy/10", "/10",      "city/1k/2/3",
+                         "city/99999999999"};
+    for (const char* name : bad) {
+        app::stress_level_params unchanged;
+        unchanged.box_count = 17;
+        TEST_ASSERT(!app::parse_stress_level_name(name, unchanged), "Malformed name rejected");
+        TEST_ASSERT(unchanged.box_count == 17, "Rejected name leaves params alone");
+    }
+
+    app::stress_level_params original;
+    original.layout = app::stress_layout::STAIRCASES;
+    original.box_count = 4321;
+    original.seed = 99;
+    app::stress_level_params round_trip;
+    TEST_ASSERT(app::parse_stress_level_name(app::stress_level_name(original).c_str(),
+                                             round_trip),
+                "Canonical name parses");
+    TEST_ASSERT(round_trip.layout == original.layout &&
+                    round_trip.box_count == original.box_count && round_trip.seed == original.seed,
+                "Canonical name round trips");
+}
+
+int main() {
+    printf("=== Stress Level Tests ===\n\n");
+
+    RUN_TEST(test_exact_counts);
+    RUN_TEST(test_reproducible);
+    RUN_TEST(test_boxes_valid);
+    RUN_TEST(test_layouts);
+    RUN_TEST(test_outlines_match_boxes);
+    RUN_TEST(test_names);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
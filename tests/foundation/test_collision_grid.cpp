@@ -0,0 +1,248 @@
+// Collision Grid Tests
+// Verifies the dynamic spatial hash grid against brute force, and that resolving against
+// dynamic boxes matches resolving against the same boxes appended to a static world
+
+#include "foundation/collision_grid.h"
+#include "foundation/collision.h"
+#include "test_common.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+// Test 1: Random inserts, moves and removes; every query matches a brute-force scan
+void test_matches_brute_force() {
+    struct shadow {
+        glm::vec3 min;
+        glm::vec3 max;
+        bool alive;
+    };
+    collision_grid grid;
+    std::vector<shadow> reference;
+
+    int queries = 0;
+    for (int step = 0; step < 20000; ++step) {
+        float action = random_float(0.0f, 1.0f);
+        if (action < 0.3f || grid.empty()) {
+            glm::vec3 center = random_vec3(-40.0f, 40.0f);
+            glm::vec3 half = random_vec3(0.1f, 3.0f);
+            uint32_t id = grid_insert(grid, center - half, center + half);
+            if (id >= reference.size()) {
+                reference.resize(static_cast<size_t>(id) + 1);
+            }
+            TEST_ASSERT(!reference[id].alive, "New id must not be live");
+            reference[id] = {center - half, center + half, true};
+        } else if (action < 0.75f) {
+            uint32_t id = static_cast<uint32_t>(random_float(0.0f, 1.0f) * reference.size());
+            if (id < reference.size() && reference[id].alive) {
+                // Mostly small moves (stay in the cell), sometimes teleports
+                glm::vec3 offset = action < 0.7f ? random_vec3(-0.3f, 0.3f)
+                                                 : random_vec3(-30.0f, 30.0f);
+                reference[id].min += offset;
+                reference[id].max += offset;
+                grid_move(grid, id, reference[id].min, reference[id].max);
+            }
+        } else if (action < 0.85f) {
+            uint32_t id = static_cast<uint32_t>(random_float(0.0f, 1.0f) * reference.size());
+            if (id < reference.size() && reference[id].alive) {
+                grid_remove(grid, id);
+                reference[id].alive = false;
+                TEST_ASSERT(!grid.contains(id), "Removed id is gone");
+            }
+        } else {
+            glm::vec3 center = random_vec3(-40.0f, 40.0f);
+            glm::vec3 half = random_vec3(0.5f, action < 0.98f ? 6.0f : 60.0f);
+            std::vector<uint32_t> expected;
+            for (uint32_t id = 0; id < reference.size(); ++id) {
+                const shadow& item = reference[id];
+                if (item.alive && !glm::any(glm::greaterThan(item.min, center + half)) &&
+                    !glm::any(glm::lessThan(item.max, center - half))) {
+                    expected.push_back(id);
+                }
+            }
+
+            std::vector<uint32_t> found(reference.size() + 1);
+            size_t count = query_grid(grid, center - half, center + half, found.data(),
+                                      found.size());
+            found.resize(count);
+            TEST_ASSERT(found == expected, "Query must match brute force, sorted by id");
+            queries++;
+        }
+
+        size_t live = 0;
+        for (const shadow& item : reference) {
+            live += item.alive ? 1 : 0;
+        }
+        TEST_ASSERT(grid.size() == live, "Live count tracks inserts and removes");
+    }
+    TEST_ASSERT(queries > 1000, "Scenario must run many queries");
+}
+
+// Test 2: Truncated output still reports the total; removed ids are reused
+void test_capacity_and_reuse() {
+    collision_grid grid;
+    for (int i = 0; i < 100; ++i) {
+        grid_insert(grid, glm::vec3(-0.5f), glm::vec3(0.5f));
+    }
+    uint32_t out[10];
+    TEST_ASSERT(query_grid(grid, glm::vec3(0.0f), glm::vec3(0.0f), out, 10) == 100,
+                "Total count exceeds capacity");
+    TEST_ASSERT(query_grid(grid, glm::vec3(0.0f), glm::vec3(0.0f), nullptr, 0) == 100,
+                "Zero capacity counts only");
+
+    grid_remove(grid, 42);
+    grid_remove(grid, 7);
+    TEST_ASSERT(grid_insert(grid, glm::vec3(0.0f), glm::vec3(1.0f)) == 7, "Latest freed id");
+    TEST_ASSERT(grid_insert(grid, glm::vec3(0.0f), glm::vec3(1.0f)) == 42, "Then the next");
+    TEST_ASSERT(grid_insert(grid, glm::vec3(0.0f), glm::vec3(1.0f)) == 100, "Then new ids");
+
+    grid_clear(grid);
+    TEST_ASSERT(grid.empty() && grid.items.empty(), "Clear removes everything");
+    TEST_ASSERT(grid_insert(grid, glm::vec3(0.0f), glm::vec3(1.0f)) == 0, "Ids restart");
+}
+
+// A sphere wandering through both worlds; every step must agree exactly. Returns the number
+// of steps with a contact.
+int check_wander(const collision_world& split, const collision_world& merged, bool swept,
+                  float extent, int steps, contact_cache* cache) {
+    sphere a{glm::vec3(0.0f), 0.5f};
+    sphere b = a;
+    glm::vec3 heading = random_vec3(-6.0f, 6.0f);
+    const float dt = 1.0f / 60.0f;
+    int contacts = 0;
+
+    for (int step = 0; step < steps; ++step) {
+        if (step % 40 == 0) {
+            heading = random_vec3(-6.0f, 6.0f);
+        }
+        glm::vec3 velocity = heading - a.center * (0.5f / extent);
+        glm::vec3 a_velocity = velocity;
+        glm::vec3 b_velocity = velocity;
+        glm::vec3 a_position = a.center + velocity * dt;
+        glm::vec3 b_position = b.center + velocity * dt;
+
+        sphere_collision ca;
+        sphere_collision cb;
+        if (swept) {
+            ca = move_and_slide(a, split, a_position, a_velocity, 0.707f, cache);
+            cb = move_and_slide(b, merged, b_position, b_velocity, 0.707f);
+        } else {
+            ca = resolve_collisions(a, split, a_position, a_velocity, 0.707f, cache);
+            cb = resolve_collisions(b, merged, b_position, b_velocity, 0.707f);
+        }
+        TEST_ASSERT(a_position == b_position, "Positions must match exactly");
+        TEST_ASSERT(a_velocity == b_velocity, "Velocities must match exactly");
+        TEST_ASSERT(ca.hit == cb.hit && ca.normal == cb.normal, "Contacts must match");
+        TEST_ASSERT(ca.contacted_floor == cb.contacted_floor, "Grounding must match");
+        contacts += ca.hit ? 1 : 0;
+    }
+    return contacts;
+}
+
+// Test 3: Dynamic boxes resolve exactly like the same boxes appended to world.boxes
+void test_matches_static_world() {
+    const float extent = 20.0f;
+    collision_world split;
+    collision_world merged;
+    for (int i = 0; i < 150; ++i) {
+        collision_box box = random_box(extent, collision_surface_type::DYNAMIC);
+        box.type = collision_surface_type::WALL;
+        split.boxes.push_back(box);
+        merged.boxes.push_back(box);
+    }
+    for (int i = 0; i < 150; ++i) {
+        collision_box box = random_box(extent, collision_surface_type::DYNAMIC);
+        TEST_ASSERT(add_dynamic_box(split, box) == static_cast<uint32_t>(i), "Sequential ids");
+        merged.boxes.push_back(box);
+    }
+    build_broadphase(split);
+    build_broadphase(merged);
+
+    for (bool swept : {false, true}) {
+        TEST_ASSERT(check_wander(split, merged, swept, extent, 3000, nullptr) > 100,
+                    "Wandering must touch boxes");
+        contact_cache cache;
+        TEST_ASSERT(check_wander(split, merged, swept, extent, 3000, &cache) > 100,
+                    "Wandering must touch boxes");
+    }
+}
+
+// Test 4: Moving every dynamic box each tick needs no rebuild and stays exact
+void test_moving_boxes() {
+    const float extent = 30.0f;
+    const int box_count = 3000;
+    collision_world split;
+    std::vector<glm::vec3> drift;
+    for (int i = 0; i < box_count; ++i) {
+        add_dynamic_box(split, random_box(extent, collision_surface_type::DYNAMIC));
+        drift.push_back(random_vec3(-2.0f, 2.0f));
+    }
+
+    contact_cache cache;
+    int contacts = 0;
+    for (int tick = 0; tick < 30; ++tick) {
+        collision_world merged;
+        for (uint32_t id = 0; id < box_count; ++id) {
+            aabb bounds = split.dynamic_boxes[id].bounds;
+            bounds.center += drift[id] * (1.0f / 60.0f);
+            move_dynamic_box(split, id, bounds);
+            merged.boxes.push_back(split.dynamic_boxes[id]);
+        }
+        build_broadphase(merged);
+        contacts += check_wander(split, merged, tick % 2 == 0, extent, 20, &cache);
+    }
+    TEST_ASSERT(contacts > 50, "Wandering must touch moving boxes");
+    TEST_ASSERT(split.revision == 0, "Dynamic edits never rebuild the static broadphase");
+}
+
+// Test 5: A fast sphere cannot tunnel through a thin dynamic wall
+void test_swept_dynamic_wall() {
+    collision_world world;
+    collision_box wall;
+    wall.bounds = aabb{glm::vec3(5.0f, 0.0f, 0.0f), glm::vec3(0.05f, 3.0f, 3.0f)};
+    wall.type = collision_surface_type::DYNAMIC;
+    uint32_t id = add_dynamic_box(world, wall);
+
+    sphere s{glm::vec3(0.0f), 0.5f};
+    glm::vec3 position(10.0f, 0.0f, 0.0f); // 10m in one step
+    glm::vec3 velocity(100.0f, 0.0f, 0.0f);
+    move_and_slide(s, world, position, velocity, 0.707f);
+    TEST_ASSERT(position.x < 4.5f, "Sphere stops in front of the dynamic wall");
+    TEST_ASSERT(velocity.x == 0.0f, "Velocity into the wall removed");
+
+    remove_dynamic_box(world, id);
+    s.center = glm::vec3(0.0f);
+    position = glm::vec3(10.0f, 0.0f, 0.0f);
+    move_and_slide(s, world, position, velocity, 0.707f);
+    TEST_ASSERT(position.x == 10.0f, "Removed wall no longer blocks");
+}
+
+int main() {
+    printf("=== Collision Grid Tests ===\n\n");
+
+    RUN_TEST(test_matches_brute_force);
+    RUN_TEST(test_capacity_and_reuse);
+    RUN_TEST(test_matches_static_world);
+    RUN_TEST(test_moving_boxes);
+    RUN_TEST(test_swept_dynamic_wall);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
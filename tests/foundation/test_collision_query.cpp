@@ -0,0 +1,280 @@
+// Collision Query Tests
+// Verifies raycast/sphere_cast against brute-force box tests, BVH vs linear agreement,
+// overlap_aabb span truncation, batch determinism, and camera occlusion pull-in
+
+#include "foundation/collision_query.h"
+#include "foundation/collision.h"
+#include "foundation/job_system.h"
+#include "camera/camera_follow.h"
+#include "test_common.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+ray random_ray(float extent) {
+    ray r;
+    r.origin = random_vec3(-extent, extent);
+    glm::vec3 direction = random_vec3(-1.0f, 1.0f);
+    while (glm::length(direction) < 0.1f) {
+        direction = random_vec3(-1.0f, 1.0f);
+    }
+    r.direction = glm::normalize(direction);
+    r.max_distance = random_float(0.0f, extent);
+    return r;
+}
+
+bool same_hit(const cast_hit& a, const cast_hit& b) {
+    if (a.hit != b.hit) {
+        return false;
+    }
+    return !a.hit || (a.distance == b.distance && a.box_index == b.box_index &&
+                      a.point == b.point && a.normal == b.normal);
+}
+
+// Independent reference: ray vs box by marching the slab intervals in double precision
+bool reference_ray_box(const ray& r, const aabb& box, double& t_hit) {
+    double t_enter = 0.0;
+    double t_exit = r.max_distance;
+    for (int axis = 0; axis < 3; ++axis) {
+        double origin = r.origin[axis];
+        double direction = r.direction[axis];
+        double lo = static_cast<double>(box.center[axis]) - box.half_extents[axis];
+        double hi = static_cast<double>(box.center[axis]) + box.half_extents[axis];
+        if (direction == 0.0) {
+            if (origin < lo || origin > hi) {
+                return false;
+            }
+            continue;
+        }
+        double t0 = (lo - origin) / direction;
+        double t1 = (hi - origin) / direction;
+        t_enter = std::fmax(t_enter, std::fmin(t0, t1));
+        t_exit = std::fmin(t_exit, std::fmax(t0, t1));
+    }
+    t_hit = t_enter;
+    return t_enter <= t_exit;
+}
+
+// Test 1: raycast finds the nearest box a brute-force reference finds
+void test_raycast_matches_reference() {
+    const collision_world world = make_random_world(300, 20.0f, true);
+    int hits = 0;
+    for (int i = 0; i < 2000; ++i) {
+        ray r = random_ray(20.0f);
+        cast_hit hit = raycast(world, r);
+
+        double nearest = 1e30;
+        for (const collision_box& box : world.boxes) {
+            double t = 0.0;
+            if (reference_ray_box(r, box.bounds, t)) {
+                nearest = std::fmin(nearest, t);
+            }
+        }
+        bool reference_hit = nearest < 1e30;
+        // Grazing rays may disagree by rounding; skip the ambiguous ones
+        if (hit.hit != reference_hit) {
+            TEST_ASSERT(!hit.hit || hit.distance > r.max_distance - 1e-3f,
+                        "Hit/miss disagrees with reference away from max_distance");
+            continue;
+        }
+        if (!hit.hit) {
+            continue;
+        }
+        hits++;
+        TEST_ASSERT(std::fabs(hit.distance - nearest) < 1e-3, "Distance matches reference");
+        TEST_ASSERT(glm::length(hit.point - (r.origin + r.direction * hit.distance)) < 1e-3f,
+                    "Point lies on the ray");
+        const aabb& box = world.boxes[hit.box_index].bounds;
+        glm::vec3 local = glm::abs(hit.point - box.center) - box.half_extents;
+        TEST_ASSERT(glm::all(glm::lessThan(local, glm::vec3(1e-3f))), "Point lies on the box");
+        TEST_ASSERT(glm::dot(hit.normal, r.direction) <= 0.0f, "Normal faces the caster");
+    }
+    TEST_ASSERT(hits > 300, "Scenario must produce many hits");
+}
+
+// Test 2: sphere_cast matches sweeping the sphere against every box
+void test_sphere_cast_matches_sweep() {
+    const collision_world world = make_random_world(300, 20.0f, true);
+    const float radius = 0.4f;
+    int hits = 0;
+    for (int i = 0; i < 2000; ++i) {
+        ray r = random_ray(20.0f);
+        cast_hit hit = sphere_cast(world, r, radius);
+
+        float nearest = 2.0f;
+        for (const collision_box& box : world.boxes) {
+            sphere_sweep_hit sweep =
+                sweep_sphere_aabb(sphere{r.origin, radius}, r.direction * r.max_distance,
+                                  box.bounds);
+            if (sweep.hit) {
+                nearest = std::fmin(nearest, sweep.time);
+            }
+        }
+        TEST_ASSERT(hit.hit == (nearest <= 1.0f), "Hit/miss matches exhaustive sweep");
+        if (hit.hit) {
+            hits++;
+            TEST_ASSERT(hit.distance == r.max_distance * nearest, "Distance matches sweep");
+        }
+    }
+    TEST_ASSERT(hits > 300, "Scenario must produce many hits");
+}
+
+// Test 3: BVH traversal and the linear fallback give identical results
+void test_bvh_matches_linear() {
+    collision_world built = make_random_world(3000, 60.0f, true);
+    collision_world linear = built;
+    linear.bvh = collision_bvh{};
+
+    for (int i = 0; i < 2000; ++i) {
+        ray r = random_ray(60.0f);
+        TEST_ASSERT(same_hit(raycast(built, r), raycast(linear, r)), "Raycasts must match");
+        TEST_ASSERT(same_hit(sphere_cast(built, r, 0.5f), sphere_cast(linear, r, 0.5f)),
+                    "Sphere casts must match");
+    }
+
+    // Grazing: rays skimming exactly along box faces
+    const aabb& box = built.boxes[0].bounds;
+    ray skim;
+    skim.origin = box.center + glm::vec3(-10.0f, box.half_extents.y, 0.0f);
+    skim.direction = glm::vec3(1.0f, 0.0f, 0.0f);
+    skim.max_distance = 20.0f;
+    TEST_ASSERT(same_hit(raycast(built, skim), raycast(linear, skim)), "Face-skimming ray");
+}
+
+// Test 4: overlap_aabb fills at most out.size(), reports the full count, and writes the same
+// ascending indices with or without the BVH
+void test_overlap_truncation() {
+    collision_world built = make_random_world(3000, 30.0f, true);
+    collision_world linear = built;
+    linear.bvh = collision_bvh{};
+
+    const glm::vec3 query_min(-8.0f);
+    const glm::vec3 query_max(8.0f);
+    size_t expected = 0;
+    for (const collision_box& box : built.boxes) {
+        glm::vec3 box_min = box.bounds.center - box.bounds.half_extents;
+        glm::vec3 box_max = box.bounds.center + box.bounds.half_extents;
+        if (!glm::any(glm::greaterThan(box_min, query_max)) &&
+            !glm::any(glm::lessThan(box_max, query_min))) {
+            expected++;
+        }
+    }
+    TEST_ASSERT(expected > 16, "Query region must hold more boxes than the small span");
+
+    std::vector<uint32_t> linear_all(expected, UINT32_MAX);
+    overlap_aabb(linear, query_min, query_max, linear_all);
+
+    for (const collision_world* world : {&built, &linear}) {
+        std::vector<uint32_t> all(expected, UINT32_MAX);
+        TEST_ASSERT(overlap_aabb(*world, query_min, query_max, all) == expected,
+                    "Full span returns every overlap");
+        for (uint32_t index : all) {
+            TEST_ASSERT(index < world->boxes.size(), "Every slot written with a valid index");
+        }
+        TEST_ASSERT(std::is_sorted(all.begin(), all.end()), "Indices are ascending");
+        TEST_ASSERT(all == linear_all, "BVH and linear paths return the same indices");
+
+        uint32_t prefix[15];
+        size_t written = std::min(overlap_aabb(*world, query_min, query_max, prefix),
+                                  std::size(prefix));
+        TEST_ASSERT(std::is_sorted(prefix, prefix + written), "Truncated prefix is ascending");
+
+        uint32_t small[16];
+        for (uint32_t& slot : small) {
+            slot = UINT32_MAX;
+        }
+        TEST_ASSERT(overlap_aabb(*world, query_min, query_max, std::span<uint32_t>(small, 15)) ==
+                        expected,
+                    "Truncated span still reports the total");
+        TEST_ASSERT(small[15] == UINT32_MAX, "Writes stay within the span");
+        TEST_ASSERT(overlap_aabb(*world, query_min, query_max, {}) == expected,
+                    "Empty span counts only");
+    }
+}
+
+// Test 5: Batches match single queries, serial and threaded
+void test_batches() {
+    const collision_world world = make_random_world(2000, 40.0f, true);
+    std::vector<ray> rays;
+    for (int i = 0; i < 1000; ++i) {
+        rays.push_back(random_ray(40.0f));
+    }
+
+    std::vector<cast_hit> serial(rays.size());
+    std::vector<cast_hit> threaded(rays.size());
+    job_system jobs(3);
+
+    raycast_batch(world, rays, serial);
+    raycast_batch(world, rays, threaded, &jobs);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        TEST_ASSERT(same_hit(serial[i], raycast(world, rays[i])), "Batch matches single ray");
+        TEST_ASSERT(same_hit(serial[i], threaded[i]), "Threaded raycasts match serial");
+    }
+
+    sphere_cast_batch(world, rays, 0.3f, serial);
+    sphere_cast_batch(world, rays, 0.3f, threaded, &jobs);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        TEST_ASSERT(same_hit(serial[i], sphere_cast(world, rays[i], 0.3f)),
+                    "Batch matches single sphere cast");
+        TEST_ASSERT(same_hit(serial[i], threaded[i]), "Threaded sphere casts match serial");
+    }
+}
+
+// Test 6: A wall between the look target and the eye pulls the camera in front of it
+void test_camera_occlusion() {
+    collision_world world;
+    collision_box wall;
+    wall.bounds = aabb{glm::vec3(0.0f, 1.0f, -3.0f), glm::vec3(5.0f, 5.0f, 0.1f)};
+    world.boxes.push_back(wall);
+    build_broadphase(world);
+
+    camera_follow cam;
+    cam.avoid_occlusion = true;
+    const glm::vec3 target(0.0f, 1.0f, 0.0f);
+    const glm::vec3 eye(0.0f, 1.0f, -6.0f);
+
+    glm::vec3 resolved = cam.resolve_occlusion(target, eye, world);
+    float expected_z = -3.0f + 0.1f + cam.collision_radius;
+    TEST_ASSERT(std::fabs(resolved.z - expected_z) < 1e-4f, "Eye stops in front of the wall");
+    TEST_ASSERT(resolved.x == 0.0f && resolved.y == 1.0f, "Eye stays on the view line");
+
+    const glm::vec3 clear_eye(0.0f, 1.0f, 2.0f);
+    TEST_ASSERT(cam.resolve_occlusion(target, clear_eye, world) == clear_eye,
+                "Unobstructed eye is unchanged");
+
+    cam.avoid_occlusion = false;
+    TEST_ASSERT(cam.resolve_occlusion(target, eye, world) == eye, "Disabled avoidance");
+}
+
+int main() {
+    printf("=== Collision Query Tests ===\n\n");
+
+    RUN_TEST(test_raycast_matches_reference);
+    RUN_TEST(test_sphere_cast_matches_sweep);
+    RUN_TEST(test_bvh_matches_linear);
+    RUN_TEST(test_overlap_truncation);
+    RUN_TEST(test_batches);
+    RUN_TEST(test_camera_occlusion);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,169 @@
+// Collision SoA Kernel Tests
+// Verifies the batch sphere-vs-box kernel (SIMD and scalar) against resolve_sphere_aabb
+
+#include "foundation/collision.h"
+#include "foundation/collision_soa.h"
+#include "test_common.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+collision_soa make_soa(const collision_world& world) {
+    std::vector<glm::vec3> bounds_min;
+    std::vector<glm::vec3> bounds_max;
+    for (const auto& box : world.boxes) {
+        bounds_min.push_back(box.bounds.center - box.bounds.half_extents);
+        bounds_max.push_back(box.bounds.center + box.bounds.half_extents);
+    }
+    collision_soa soa;
+    build_collision_soa(soa, bounds_min, bounds_max);
+    return soa;
+}
+
+// Compare kernel masks with resolve_sphere_aabb for every box
+void check_masks(const collision_world& world, const collision_soa& soa, const sphere& s) {
+    for (size_t block = 0; block < soa.padded_count(); block += SOA_LANES) {
+        uint32_t mask = sphere_overlap_mask(soa, block, s.center, s.radius);
+        uint32_t scalar_mask = sphere_overlap_mask_scalar(soa, block, s.center, s.radius);
+        TEST_ASSERT(mask == scalar_mask, "SIMD and scalar kernels must agree");
+
+        for (size_t lane = 0; lane < SOA_LANES; ++lane) {
+            bool kernel_hit = (mask >> lane) & 1u;
+            size_t index = block + lane;
+            if (index >= world.boxes.size()) {
+                TEST_ASSERT(!kernel_hit, "Padding lanes must never hit");
+                continue;
+            }
+            bool reference_hit = resolve_sphere_aabb(s, world.boxes[index].bounds).hit;
+            TEST_ASSERT(kernel_hit == reference_hit, "Kernel must match resolve_sphere_aabb");
+        }
+    }
+}
+
+// Test 1: Layout and padding
+// Arrays round up to whole lanes; padding never reports a hit, even for huge spheres
+void test_padding() {
+    for (int count : {0, 1, 7, 8, 9, 17}) {
+        collision_world world = make_random_world(count, 5.0f, false);
+        collision_soa soa = make_soa(world);
+
+        TEST_ASSERT(soa.source_count == static_cast<size_t>(count), "Source count recorded");
+        TEST_ASSERT(soa.padded_count() % SOA_LANES == 0, "Padded to whole lanes");
+        TEST_ASSERT(soa.padded_count() < static_cast<size_t>(count) + SOA_LANES,
+                    "Padding is less than one block");
+
+        sphere everything{glm::vec3(0.0f), 1.0e6f};
+        check_masks(world, soa, everything);
+    }
+}
+
+// Test 2: Random spheres against random boxes
+void test_random_equivalence() {
+    collision_world world = make_random_world(203, 10.0f, false);
+    collision_soa soa = make_soa(world);
+
+    for (int i = 0; i < 20000; ++i) {
+        sphere s{random_vec3(-12.0f, 12.0f), random_float(0.05f, 3.0f)};
+        check_masks(world, soa, s);
+    }
+}
+
+// Test 3: Boundary cases
+// Exact touching (distance == radius) is not a hit; center inside/on the box is
+void test_boundaries() {
+    collision_world world;
+    collision_box box;
+    box.bounds.center = glm::vec3(0.0f);
+    box.bounds.half_extents = glm::vec3(1.0f);
+    world.boxes.push_back(box);
+    collision_soa soa = make_soa(world);
+
+    sphere touching{glm::vec3(1.5f, 0.0f, 0.0f), 0.5f};
+    sphere overlapping{glm::vec3(1.49f, 0.0f, 0.0f), 0.5f};
+    sphere on_face{glm::vec3(1.0f, 0.0f, 0.0f), 0.5f};
+    sphere inside{glm::vec3(0.2f, -0.3f, 0.1f), 0.5f};
+    sphere corner_miss{glm::vec3(1.4f, 1.4f, 1.4f), 0.5f};
+
+    TEST_ASSERT(sphere_overlap_mask(soa, 0, touching.center, touching.radius) == 0,
+                "Touching sphere is not a hit");
+    TEST_ASSERT(sphere_overlap_mask(soa, 0, overlapping.center, overlapping.radius) == 1,
+                "Overlapping sphere is a hit");
+    TEST_ASSERT(sphere_overlap_mask(soa, 0, on_face.center, on_face.radius) == 1,
+                "Center on face is a hit");
+    TEST_ASSERT(sphere_overlap_mask(soa, 0, inside.center, inside.radius) == 1,
+                "Center inside is a hit");
+    TEST_ASSERT(sphere_overlap_mask(soa, 0, corner_miss.center, corner_miss.radius) == 0,
+                "Sphere outside corner is not a hit");
+
+    for (const sphere& s : {touching, overlapping, on_face, inside, corner_miss}) {
+        check_masks(world, soa, s);
+    }
+}
+
+// Test 4: Full resolution with the SoA path matches box-at-a-time resolution bit-for-bit
+void test_resolve_equivalence() {
+    collision_world reference = make_random_world(150, 8.0f, false);
+    collision_world batched = reference;
+    build_broadphase(batched);
+    // Drop the BVH so resolution takes the exhaustive (SoA) path
+    batched.bvh = collision_bvh{};
+
+    const float wall_threshold = 0.707f;
+    int hits = 0;
+    for (int i = 0; i < 5000; ++i) {
+        glm::vec3 start = random_vec3(-9.0f, 9.0f);
+        glm::vec3 end = start + random_vec3(-0.5f, 0.5f);
+        glm::vec3 velocity = random_vec3(-5.0f, 5.0f);
+
+        sphere sphere_a{start, 0.5f};
+        glm::vec3 position_a = end;
+        glm::vec3 velocity_a = velocity;
+        sphere_collision contact_a =
+            resolve_collisions(sphere_a, reference, position_a, velocity_a, wall_threshold);
+
+        sphere sphere_b{start, 0.5f};
+        glm::vec3 position_b = end;
+        glm::vec3 velocity_b = velocity;
+        sphere_collision contact_b =
+            resolve_collisions(sphere_b, batched, position_b, velocity_b, wall_threshold);
+
+        TEST_ASSERT(position_a == position_b, "Resolved positions must match exactly");
+        TEST_ASSERT(velocity_a == velocity_b, "Resolved velocities must match exactly");
+        TEST_ASSERT(contact_a.hit == contact_b.hit, "Contact hit must match");
+        TEST_ASSERT(contact_a.contacted_floor == contact_b.contacted_floor,
+                    "Floor contact must match");
+        TEST_ASSERT(contact_a.normal == contact_b.normal, "Contact normal must match");
+        hits += contact_a.hit ? 1 : 0;
+    }
+    TEST_ASSERT(hits > 500, "Scenario must exercise collisions");
+}
+
+int main() {
+    printf("=== Collision SoA Kernel Tests ===\n\n");
+    printf("Kernel: %s\n\n", sphere_overlap_uses_avx2() ? "AVX2" : "scalar");
+
+    RUN_TEST(test_padding);
+    RUN_TEST(test_random_equivalence);
+    RUN_TEST(test_boundaries);
+    RUN_TEST(test_resolve_equivalence);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,268 @@
+// Swept Collision Tests
+// Verifies sphere-vs-AABB time of impact against the exact rounded Minkowski sum, the world
+// sweep's broadphase, and that move_and_slide stops fast spheres at thin walls
+
+#include "foundation/collision.h"
+#include "vehicle/controller.h"
+#include "test_common.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+// Distance from a point to a box (0 inside)
+float distance_to_box(const glm::vec3& point, const aabb& box) {
+    glm::vec3 closest = glm::clamp(point, box.center - box.half_extents,
+                                   box.center + box.half_extents);
+    return glm::length(point - closest);
+}
+
+// Test 1: Head-on face hit lands exactly at radius from the face
+void test_face_hit() {
+    aabb box{glm::vec3(0.0f), glm::vec3(1.0f)};
+    sphere s{glm::vec3(-5.0f, 0.2f, 0.3f), 0.5f};
+
+    sphere_sweep_hit hit = sweep_sphere_aabb(s, glm::vec3(10.0f, 0.0f, 0.0f), box);
+    TEST_ASSERT(hit.hit, "Sphere moving through the box must hit");
+    TEST_ASSERT(std::abs(hit.time - 0.35f) < 1e-5f, "Contact when center reaches x = -1.5");
+    TEST_ASSERT(hit.normal == glm::vec3(-1.0f, 0.0f, 0.0f), "Normal faces the sphere");
+    TEST_ASSERT(hit.contact_box == &box, "Contact box reported");
+
+    sphere_sweep_hit short_move = sweep_sphere_aabb(s, glm::vec3(3.0f, 0.0f, 0.0f), box);
+    TEST_ASSERT(!short_move.hit, "Move ending before the box misses");
+}
+
+// Test 2: Paths through the grown box's corner region that miss the rounded corner
+void test_corner_miss() {
+    aabb box{glm::vec3(0.0f), glm::vec3(1.0f)};
+
+    // Diagonal past the (+1, +1) edge: clears the grown box's square corner test but stays
+    // farther than the radius from the edge itself
+    sphere s{glm::vec3(-0.15f, 3.0f, 0.0f), 0.5f};
+    glm::vec3 displacement(3.0f, -3.0f, 0.0f); // passes (1.425, 1.425): 0.60 from the edge
+    sphere_sweep_hit miss = sweep_sphere_aabb(s, displacement, box);
+    TEST_ASSERT(!miss.hit, "Path clear of the rounded edge must miss");
+
+    // Same direction, shifted in: grazes the edge cylinder
+    s.center = glm::vec3(-0.4f, 3.0f, 0.0f); // passes 0.42 from the edge
+    sphere_sweep_hit hit = sweep_sphere_aabb(s, displacement, box);
+    TEST_ASSERT(hit.hit, "Path into the rounded edge must hit");
+    glm::vec3 center = s.center + displacement * hit.time;
+    TEST_ASSERT(std::abs(distance_to_box(center, box) - 0.5f) < 1e-4f, "Contact at radius");
+    TEST_ASSERT(hit.normal.x > 0.0f && hit.normal.y > 0.0f, "Edge normal points diagonally out");
+}
+
+// Test 3: Touching spheres hit at time 0 only when moving into the box
+void test_touching_start() {
+    aabb box{glm::vec3(0.0f), glm::vec3(1.0f)};
+    sphere resting{glm::vec3(0.0f, 1.5f, 0.0f), 0.5f};
+
+    sphere_sweep_hit into = sweep_sphere_aabb(resting, glm::vec3(0.3f, -0.1f, 0.0f), box);
+    TEST_ASSERT(into.hit && into.time == 0.0f, "Moving into a touched box hits immediately");
+    TEST_ASSERT(into.normal == glm::vec3(0.0f, 1.0f, 0.0f), "Resting contact normal is up");
+
+    TEST_ASSERT(!sweep_sphere_aabb(resting, glm::vec3(0.3f, 0.1f, 0.0f), box).hit,
+                "Moving away from a touched box is free");
+    TEST_ASSERT(!sweep_sphere_aabb(resting, glm::vec3(3.0f, 0.0f, 0.0f), box).hit,
+                "Sliding tangentially along a touched box is free");
+}
+
+// Test 4: Random sweeps agree with dense sampling of the path
+void test_matches_sampling() {
+    const int sweeps = 3000;
+    const int samples = 4000;
+    const float tolerance = 1e-3f;
+    int hits = 0;
+    int rounded_hits = 0;
+
+    for (int i = 0; i < sweeps; ++i) {
+        aabb box{random_vec3(-1.0f, 1.0f), random_vec3(0.05f, 1.5f)};
+        sphere s{random_vec3(-5.0f, 5.0f), random_float(0.1f, 1.0f)};
+        if (distance_to_box(s.center, box) <= s.radius) {
+            continue; // Touching starts are covered by test_touching_start
+        }
+        // Aim near the box (edges and corners included) and stop short of it some of the time
+        glm::vec3 target = box.center + box.half_extents * random_vec3(-1.6f, 1.6f);
+        glm::vec3 displacement = (target - s.center) * random_float(0.5f, 2.0f);
+
+        sphere_sweep_hit hit = sweep_sphere_aabb(s, displacement, box);
+        float end = hit.hit ? hit.time : 1.0f;
+        for (int k = 0; k <= samples; ++k) {
+            float t = end * static_cast<float>(k) / static_cast<float>(samples);
+            float distance = distance_to_box(s.center + displacement * t, box);
+            TEST_ASSERT(distance >= s.radius - tolerance, "No overlap before first contact");
+        }
+
+        if (hit.hit) {
+            glm::vec3 center = s.center + displacement * hit.time;
+            TEST_ASSERT(std::abs(distance_to_box(center, box) - s.radius) < tolerance,
+                        "Contact at exactly the radius");
+            TEST_ASSERT(glm::dot(displacement, hit.normal) < 0.0f, "Hit moves into the surface");
+            hits++;
+            glm::vec3 offset = glm::abs(center - box.center) - box.half_extents;
+            rounded_hits += (offset.x > 0.0f) + (offset.y > 0.0f) + (offset.z > 0.0f) >= 2;
+        }
+    }
+    printf("  %d hits, %d on edges or corners\n", hits, rounded_hits);
+    TEST_ASSERT(hits > 1000, "Scenario must exercise hits");
+    TEST_ASSERT(rounded_hits > 100, "Scenario must exercise edge and corner hits");
+}
+
+// Test 5: World sweep finds the earliest box, identically with and without the BVH
+void test_world_sweep() {
+    collision_world world;
+    for (int i = 0; i < 400; ++i) {
+        collision_box box;
+        box.bounds.center = random_vec3(-30.0f, 30.0f);
+        box.bounds.half_extents = random_vec3(0.1f, 1.5f);
+        world.boxes.push_back(box);
+    }
+    collision_world unbuilt = world;
+    build_broadphase(world);
+
+    int hits = 0;
+    for (int i = 0; i < 2000; ++i) {
+        sphere s{random_vec3(-30.0f, 30.0f), 0.5f};
+        glm::vec3 displacement = random_vec3(-6.0f, 6.0f);
+
+        sphere_sweep_hit fast = sweep_sphere(s, displacement, world);
+        sphere_sweep_hit exhaustive = sweep_sphere(s, displacement, unbuilt);
+        TEST_ASSERT(fast.hit == exhaustive.hit, "Broadphase must not change hits");
+        if (fast.hit) {
+            TEST_ASSERT(fast.time == exhaustive.time, "Same time of impact");
+            TEST_ASSERT(fast.contact_box - &world.boxes[0].bounds ==
+                            exhaustive.contact_box - &unbuilt.boxes[0].bounds,
+                        "Same first box");
+            hits++;
+        }
+    }
+    TEST_ASSERT(hits > 100, "Scenario must exercise hits");
+}
+
+// Ground plus one wall (same 0.2m thickness as the test level)
+collision_world make_wall_world() {
+    collision_world world;
+    collision_box ground;
+    ground.bounds = aabb{glm::vec3(0.0f, -0.1f, 0.0f), glm::vec3(100.0f, 0.1f, 100.0f)};
+    ground.type = collision_surface_type::FLOOR;
+    world.boxes.push_back(ground);
+
+    collision_box wall;
+    wall.bounds = aabb{glm::vec3(5.0f, 2.0f, 0.0f), glm::vec3(0.1f, 2.0f, 8.0f)};
+    wall.type = collision_surface_type::WALL;
+    world.boxes.push_back(wall);
+
+    build_broadphase(world);
+    return world;
+}
+
+controller make_fast_car(bool swept) {
+    controller c;
+    c.swept_collision = swept;
+    c.handbrake.brake_rate = 0.0f; // Normally filled in by the tuning system
+    c.position = glm::vec3(0.0f, c.collision_sphere.radius, 0.0f);
+    c.collision_sphere.center = c.position;
+    c.velocity = glm::vec3(30.0f, 0.0f, 0.0f);
+    return c;
+}
+
+// Test 6: At 10Hz a 30 m/s car skips the wall with discrete push-out but not with sweeps
+void test_no_tunneling() {
+    const collision_world world = make_wall_world();
+    const float dt = 0.1f; // 3m per tick, far more than wall thickness + radius
+    const float wall_face = 4.9f;
+
+    controller discrete = make_fast_car(false);
+    controller swept = make_fast_car(true);
+    for (int tick = 0; tick < 10; ++tick) {
+        discrete.update(&world, dt);
+        swept.update(&world, dt);
+
+        TEST_ASSERT(swept.position.x <= wall_face - swept.collision_sphere.radius + 1e-4f,
+                    "Swept car must stay in front of the wall");
+        TEST_ASSERT(swept.position.y >= swept.collision_sphere.radius - 1e-4f,
+                    "Swept car must stay on the ground");
+    }
+    TEST_ASSERT(discrete.position.x > wall_face, "Discrete push-out tunnels (the bug)");
+    TEST_ASSERT(swept.velocity.x <= 0.0f, "Wall removed the velocity into it");
+    TEST_ASSERT(swept.is_grounded, "Swept car stays grounded");
+}
+
+// Test 7: Oblique hits slide along the wall instead of stopping dead
+void test_slide_along_wall() {
+    const collision_world world = make_wall_world();
+    controller c = make_fast_car(true);
+    c.velocity = glm::vec3(20.0f, 0.0f, 10.0f);
+
+    float z_at_contact = 0.0f;
+    for (int tick = 0; tick < 3; ++tick) {
+        c.update(&world, 0.1f);
+        if (tick == 1) {
+            z_at_contact = c.position.z;
+        }
+    }
+    TEST_ASSERT(c.position.x <= 4.4f + 1e-4f, "Car stays in front of the wall");
+    TEST_ASSERT(c.position.z > z_at_contact + 0.5f, "Car keeps moving along the wall");
+    TEST_ASSERT(std::abs(c.velocity.x) < 1e-4f, "Velocity into the wall removed");
+}
+
+// Test 8: Driving across a floor made of adjacent tiles never catches on the seams
+void test_tile_seams() {
+    collision_world world;
+    for (int i = 0; i < 40; ++i) {
+        collision_box tile;
+        tile.bounds = aabb{glm::vec3(static_cast<float>(i) + 0.5f, -0.1f, 0.0f),
+                           glm::vec3(0.5f, 0.1f, 5.0f)};
+        tile.type = collision_surface_type::FLOOR;
+        world.boxes.push_back(tile);
+    }
+    build_broadphase(world);
+
+    controller c = make_fast_car(true);
+    c.position.x = 1.0f;
+    c.collision_sphere.center = c.position;
+    c.velocity = glm::vec3(8.0f, 0.0f, 0.0f);
+    const float dt = 1.0f / 60.0f;
+    float previous_x = c.position.x;
+    for (int tick = 0; tick < 180; ++tick) {
+        float expected_speed = c.velocity.x;
+        c.update(&world, dt);
+        TEST_ASSERT(c.is_grounded, "Car stays grounded on the tiles");
+        TEST_ASSERT(c.position.x - previous_x > expected_speed * dt * 0.9f,
+                    "Car never catches on a tile seam");
+        previous_x = c.position.x;
+    }
+}
+
+int main() {
+    printf("=== Swept Collision Tests ===\n\n");
+
+    RUN_TEST(test_face_hit);
+    RUN_TEST(test_corner_miss);
+    RUN_TEST(test_touching_start);
+    RUN_TEST(test_matches_sampling);
+    RUN_TEST(test_world_sweep);
+    RUN_TEST(test_no_tunneling);
+    RUN_TEST(test_slide_along_wall);
+    RUN_TEST(test_tile_seams);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Contact Cache Tests
+// Verifies cached resolution matches uncached resolution bit-for-bit, that steady motion is
+// served from the cache, and that rebuilt worlds and crowded regions bypass stale candidates
+
+#include "foundation/collision.h"
+#include "app/game_world.h"
+#include "foundation/math_utils.h"
+#include "test_common.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+// A sphere wandering through the world (continuous path, so the cache gets reused), resolved
+// once without and once with a cache; every step must agree exactly
+void check_wander(const collision_world& world, bool swept, float extent, int steps,
+                  contact_cache& cache) {
+    sphere plain{glm::vec3(0.0f), 0.5f};
+    sphere cached = plain;
+    glm::vec3 plain_velocity(0.0f);
+    glm::vec3 cached_velocity(0.0f);
+    const float dt = 1.0f / 60.0f;
+
+    glm::vec3 heading = random_vec3(-6.0f, 6.0f);
+    for (int step = 0; step < steps; ++step) {
+        if (step % 40 == 0) {
+            heading = random_vec3(-6.0f, 6.0f);
+        }
+        // Steer back toward the middle so the path stays among the boxes
+        glm::vec3 velocity = heading - plain.center * (0.5f / extent);
+        plain_velocity = velocity;
+        cached_velocity = velocity;
+
+        glm::vec3 plain_position = plain.center + velocity * dt;
+        glm::vec3 cached_position = cached.center + velocity * dt;
+        sphere_collision a;
+        sphere_collision b;
+        if (swept) {
+            a = move_and_slide(plain, world, plain_position, plain_velocity, 0.707f);
+            b = move_and_slide(cached, world, cached_position, cached_velocity, 0.707f, &cache);
+        } else {
+            a = resolve_collisions(plain, world, plain_position, plain_velocity, 0.707f);
+            b = resolve_collisions(cached, world, cached_position, cached_velocity, 0.707f,
+                                   &cache);
+        }
+
+        TEST_ASSERT(plain_position == cached_position, "Positions must match exactly");
+        TEST_ASSERT(plain_velocity == cached_velocity, "Velocities must match exactly");
+        TEST_ASSERT(a.hit == b.hit && a.normal == b.normal, "Contacts must match");
+        TEST_ASSERT(a.contacted_floor == b.contacted_floor, "Grounding must match");
+    }
+}
+
+// Test 1: Cached resolution is identical, for both resolvers and every broadphase path
+void test_matches_uncached() {
+    struct scenario {
+        int box_count;
+        bool build;
+    };
+    // Small (SoA sweep), large (BVH), and never-built (linear gather) worlds
+    const scenario scenarios[] = {{100, true}, {3000, true}, {200, false}};
+
+    for (const scenario& sc : scenarios) {
+        const float extent = sc.box_count > 1000 ? 60.0f : 20.0f;
+        const collision_world world = make_random_world(sc.box_count, extent, sc.build);
+        for (bool swept : {false, true}) {
+            contact_cache cache;
+            check_wander(world, swept, extent, 3000, cache);
+            TEST_ASSERT(cache.lookups == 3000, "Every resolve consults the cache");
+            TEST_ASSERT(cache.hit_rate() > 0.5f, "Wandering reuses cached regions");
+        }
+    }
+}
+
+// Test 2: Steady driving and resting on the test level are served from the cache
+void test_steady_state_hit_rate() {
+    game_world world;
+    world.init();
+    controller& car = world.character;
+    const float dt = 1.0f / 60.0f;
+
+    controller_input_params input;
+    input.move_direction = glm::vec2(0.0f, 1.0f);
+    input.turn_input = 0.3f;
+    input.handbrake = false;
+    for (int tick = 0; tick < 600; ++tick) {
+        world.update(dt, input);
+    }
+    float driving_rate = car.collision_cache.hit_rate();
+    TEST_ASSERT(driving_rate > 0.8f, "Driving mostly reuses the cached region");
+
+    car.collision_cache.reset_stats();
+    controller_input_params idle{};
+    for (int tick = 0; tick < 600; ++tick) {
+        world.update(dt, idle);
+    }
+    TEST_ASSERT(car.is_grounded, "Car comes to rest on the ground");
+    TEST_ASSERT(car.collision_cache.lookups == 600, "One lookup per tick");
+    TEST_ASSERT(car.collision_cache.hit_rate() > 0.98f, "Resting is served from the cache");
+    printf("  driving hit rate %.3f, resting %.3f\n", static_cast<double>(driving_rate),
+           static_cast<double>(car.collision_cache.hit_rate()));
+}
+
+// Test 3: build_broadphase after editing boxes makes the cache refill
+void test_rebuild_invalidates() {
+    collision_world world;
+    collision_box ground;
+    ground.bounds = aabb{glm::vec3(0.0f, -0.1f, 0.0f), glm::vec3(50.0f, 0.1f, 50.0f)};
+    world.boxes.push_back(ground);
+    collision_box far_box;
+    far_box.bounds = aabb{glm::vec3(40.0f, 1.0f, 0.0f), glm::vec3(1.0f)};
+    world.boxes.push_back(far_box);
+    build_broadphase(world);
+
+    contact_cache cache;
+    sphere s{glm::vec3(0.0f, 0.5f, 0.0f), 0.5f};
+    glm::vec3 velocity(0.0f);
+    glm::vec3 position = s.center;
+    resolve_collisions(s, world, position, velocity, 0.707f, &cache);
+    TEST_ASSERT(cache.candidate_count == 1, "Only the ground is near the sphere");
+
+    // Move the far box onto the sphere and rebuild
+    world.boxes[1].bounds.center = glm::vec3(0.9f, 0.5f, 0.0f);
+    build_broadphase(world);
+
+    position = s.center;
+    sphere_collision contact = resolve_collisions(s, world, position, velocity, 0.707f, &cache);
+    TEST_ASSERT(cache.region_hits == 0, "Rebuilt world must not reuse the old region");
+    TEST_ASSERT(contact.hit && contact.is_wall, "Moved box is found after the rebuild");
+    TEST_ASSERT(position.x < -0.09f, "Sphere pushed out of the moved box");
+}
+
+// Test 4: Regions holding more boxes than the cache resolve uncached (and still match)
+void test_crowded_region() {
+    const collision_world world = make_random_world(4000, 8.0f, true);
+    contact_cache cache;
+    check_wander(world, false, 8.0f, 300, cache);
+    TEST_ASSERT(cache.overflows > 0, "Dense world must overflow the cache");
+}
+
+int main() {
+    printf("=== Contact Cache Tests ===\n\n");
+
+    RUN_TEST(test_matches_uncached);
+    RUN_TEST(test_steady_state_hit_rate);
+    RUN_TEST(test_rebuild_invalidates);
+    RUN_TEST(test_crowded_region);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
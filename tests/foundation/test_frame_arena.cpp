@@ -0,0 +1,172 @@
+// Frame Arena Tests
+// Verifies bump allocation and alignment, growth after an overflowing frame, std::pmr use,
+// and that steady-state profiled simulation frames (debug primitives in the arena, profiler
+// summary each frame) allocate nothing
+
+#include "foundation/frame_arena.h"
+#include "foundation/memory_tracking.h"
+#include "foundation/profiler.h"
+#include "app/game_world.h"
+#include "app/debug_generation.h"
+#include "app/input_script.h"
+#include "rendering/debug_primitives.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+bool is_aligned(const void* p, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+}
+
+void test_bump_allocation() {
+    foundation::frame_arena arena(4096);
+
+    void* a = arena.allocate(3, 1);
+    void* b = arena.allocate(8, 8);
+    void* c = arena.allocate(64, 64);
+    void* d = arena.allocate(1, 1);
+    TEST_ASSERT(is_aligned(b, 8) && is_aligned(c, 64), "Requested alignment");
+    TEST_ASSERT(a < b && b < c && c < d, "Consecutive in one block");
+    TEST_ASSERT(static_cast<char*>(b) >= static_cast<char*>(a) + 3, "No overlap");
+    TEST_ASSERT(static_cast<char*>(d) >= static_cast<char*>(c) + 64, "No overlap");
+
+    std::span<glm::vec3> vertices = arena.allocate_array<glm::vec3>(100);
+    TEST_ASSERT(vertices.size() == 100 && is_aligned(vertices.data(), alignof(glm::vec3)),
+                "Typed array");
+
+    foundation::frame_arena_stats stats = arena.stats();
+    TEST_ASSERT(stats.used >= 3 + 8 + 64 + 1 + 100 * sizeof(glm::vec3), "Used counts requests");
+    TEST_ASSERT(stats.overflow_bytes == 0 && stats.capacity == 4096, "Fits in the block");
+
+    // Reset hands out the same memory again
+    arena.reset();
+    TEST_ASSERT(arena.stats().used == 0, "Reset empties the arena");
+    TEST_ASSERT(arena.allocate(3, 1) == a, "Reused from the start");
+    TEST_ASSERT(arena.stats().peak == stats.used, "Peak remembers the busiest frame");
+}
+
+void test_overflow_then_grow() {
+    foundation::frame_arena arena(1024);
+
+    // Frame larger than the block: served from extra blocks, all still valid and disjoint
+    std::vector<char*> blocks;
+    for (int i = 0; i < 10; ++i) {
+        std::span<char> bytes = arena.allocate_array<char>(300);
+        for (char& byte : bytes) {
+            byte = static_cast<char>(i);
+        }
+        blocks.push_back(bytes.data());
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 300; ++j) {
+            TEST_ASSERT(blocks[i][j] == static_cast<char>(i), "Overflow allocations intact");
+        }
+    }
+    foundation::frame_arena_stats stats = arena.stats();
+    TEST_ASSERT(stats.overflow_bytes > 0, "Overflowed");
+    TEST_ASSERT(stats.used >= 3000, "Overflow counted as used");
+
+    // Next frame: one block big enough for the whole previous frame
+    arena.reset();
+    stats = arena.stats();
+    TEST_ASSERT(stats.grows == 1 && stats.capacity >= 3000, "Grew to the frame's size");
+    for (int i = 0; i < 10; ++i) {
+        arena.allocate_array<char>(300);
+    }
+    TEST_ASSERT(arena.stats().overflow_bytes == 0, "Same frame now fits");
+
+    // Grows only when a frame overflows
+    arena.reset();
+    arena.reset();
+    TEST_ASSERT(arena.stats().grows == 1, "No growth without overflow");
+}
+
+void test_pmr_containers() {
+    foundation::frame_arena arena(64 * 1024);
+
+    debug::debug_primitive_list list(&arena);
+    for (int i = 0; i < 500; ++i) {
+        list.lines.push_back({glm::vec3(static_cast<float>(i)), glm::vec3(1.0f), glm::vec4(1.0f)});
+    }
+    list.add_text("a label long enough to need a heap buffer", glm::vec3(0.0f), glm::vec4(1.0f));
+
+    TEST_ASSERT(list.lines.get_allocator().resource() == &arena, "Vectors use the arena");
+    TEST_ASSERT(list.texts[0].text.get_allocator().resource() == &arena,
+                "Strings use the arena");
+    TEST_ASSERT(list.lines[499].start.x == 499.0f, "Contents intact");
+    TEST_ASSERT(arena.stats().used >= 500 * sizeof(debug::debug_line), "Storage came from arena");
+
+    std::pmr::vector<int> numbers(&arena);
+    numbers.assign(1000, 7);
+    TEST_ASSERT(numbers[999] == 7, "Plain pmr vector");
+}
+
+void test_steady_state_frames_do_not_allocate() {
+#if FROGLORDS_PROFILE
+    game_world world;
+    world.init();
+    app::input_script script = app::default_input_script();
+    foundation::frame_arena arena;
+    std::vector<profiler::zone_summary> summary;
+
+    // Profiled like the app: a recorded frame, then the Debug Panel's call-tree summary
+    auto run_frames = [&](int first, int count) {
+        for (int i = first; i < first + count; ++i) {
+            profiler::begin_frame();
+            arena.reset();
+            world.update(1.0f / 60.0f, script.sample(i % script.length()));
+            debug::debug_primitive_list list(&arena);
+            app::generate_debug_primitives(list, world);
+            profiler::end_frame();
+            profiler::summarize(summary);
+        }
+    };
+
+    // Warm-up: containers reach their working sizes, the arena grows if it has to
+    run_frames(0, 300);
+
+    uint64_t before = memory::allocation_count();
+    run_frames(300, 1000);
+    uint64_t allocations = memory::allocation_count() - before;
+    printf("  %llu heap allocations in 1000 frames\n",
+           static_cast<unsigned long long>(allocations));
+    TEST_ASSERT(allocations == 0, "Steady-state frames do not touch the heap");
+
+    // The counter does see allocations (a direct call: new-expressions may be elided)
+    before = memory::allocation_count();
+    void* probe = ::operator new(64);
+    TEST_ASSERT(memory::allocation_count() - before == 1, "Counts operator new");
+    ::operator delete(probe);
+#else
+    printf("  skipped (allocation counting needs FROGLORDS_PROFILER=ON)\n");
+#endif
+}
+
+int main() {
+    printf("=== Frame Arena Tests ===\n\n");
+
+    RUN_TEST(test_bump_allocation);
+    RUN_TEST(test_overflow_then_grow);
+    RUN_TEST(test_pmr_containers);
+    RUN_TEST(test_steady_state_frames_do_not_allocate);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
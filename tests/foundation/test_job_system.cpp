@@ -0,0 +1,257 @@
+// Job System Tests
+// Verifies parallel_for coverage, graph ordering, nesting, and that parallel consumers
+// (collision batch, debug primitive generation) match their serial results
+
+#include "foundation/job_system.h"
+#include "foundation/collision.h"
+#include "foundation/memory_tracking.h"
+#include "app/debug_generation.h"
+#include "app/game_world.h"
+#include "test_common.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+// Oversubscribed on purpose: more threads than cores forces preemption mid-task
+constexpr int WORKERS = 7;
+
+// Test 1: Every index is visited exactly once, in chunks no larger than the grain
+void test_parallel_for_coverage() {
+    job_system jobs(WORKERS);
+    TEST_ASSERT(jobs.thread_count() == WORKERS + 1, "Workers plus the owning thread");
+
+    const size_t counts[] = {0, 1, 63, 64, 65, 1000, 100003};
+    for (size_t count : counts) {
+        std::vector<std::atomic<int>> visits(count);
+        std::atomic<size_t> largest_chunk{0};
+        jobs.parallel_for(count, 64, [&](size_t begin, size_t end) {
+            TEST_ASSERT(begin < end && end <= count, "Chunk within range");
+            size_t size = end - begin;
+            size_t seen = largest_chunk.load();
+            while (size > seen && !largest_chunk.compare_exchange_weak(seen, size)) {
+            }
+            for (size_t i = begin; i < end; ++i) {
+                visits[i].fetch_add(1);
+            }
+        });
+
+        for (size_t i = 0; i < count; ++i) {
+            TEST_ASSERT(visits[i].load() == 1, "Each index visited exactly once");
+        }
+        TEST_ASSERT(largest_chunk.load() <= 64, "Chunks never exceed the grain");
+    }
+}
+
+// Test 2: No workers runs everything on the caller, still respecting the grain
+void test_inline_system() {
+    job_system jobs(0);
+    TEST_ASSERT(jobs.thread_count() == 1, "Only the owning thread");
+
+    std::vector<int> visits(1000, 0);
+    int chunks = 0;
+    jobs.parallel_for(visits.size(), 100, [&](size_t begin, size_t end) {
+        TEST_ASSERT(end - begin <= 100, "Chunk within grain");
+        chunks++;
+        for (size_t i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    TEST_ASSERT(chunks == 10, "Inline run splits by grain");
+    for (int v : visits) {
+        TEST_ASSERT(v == 1, "Each index visited exactly once");
+    }
+
+    // Null system: same contract through the free function
+    std::vector<int> null_visits(250, 0);
+    parallel_for(nullptr, null_visits.size(), 100, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            null_visits[i]++;
+        }
+    });
+    for (int v : null_visits) {
+        TEST_ASSERT(v == 1, "Null system visits each index once");
+    }
+}
+
+// Test 3: parallel_for inside jobs (waiting threads keep executing work)
+void test_nested_parallel_for() {
+    job_system jobs(WORKERS);
+
+    const size_t outer = 64;
+    const size_t inner = 500;
+    std::vector<std::atomic<int>> visits(outer * inner);
+    jobs.parallel_for(outer, 1, [&](size_t begin, size_t end) {
+        for (size_t o = begin; o < end; ++o) {
+            jobs.parallel_for(inner, 16, [&](size_t inner_begin, size_t inner_end) {
+                for (size_t i = inner_begin; i < inner_end; ++i) {
+                    visits[o * inner + i].fetch_add(1);
+                }
+            });
+        }
+    });
+
+    for (const auto& v : visits) {
+        TEST_ASSERT(v.load() == 1, "Nested ranges visit each index once");
+    }
+}
+
+// Test 4: Graph nodes run once each, never before their predecessors; graphs are reusable
+// and reruns do not allocate
+void test_graph_dependencies() {
+    job_system jobs(WORKERS);
+
+    // Diamond (a -> b, c -> d) plus a 20-long chain hanging off d, plus independent nodes
+    std::atomic<int> sequence{0};
+    std::vector<int> order(40, -1);
+    job_graph graph;
+    std::vector<job_graph::node_id> ids;
+    for (int i = 0; i < 40; ++i) {
+        ids.push_back(graph.add([&, i] { order[static_cast<size_t>(i)] = sequence.fetch_add(1); }));
+    }
+    graph.precede(ids[0], ids[1]);
+    graph.precede(ids[0], ids[2]);
+    graph.precede(ids[1], ids[3]);
+    graph.precede(ids[2], ids[3]);
+    for (int i = 3; i < 23; ++i) {
+        graph.precede(ids[static_cast<size_t>(i)], ids[static_cast<size_t>(i) + 1]);
+    }
+
+    for (int run = 0; run < 50; ++run) {
+        sequence = 0;
+        std::fill(order.begin(), order.end(), -1);
+        jobs.run(graph);
+
+        for (int v : order) {
+            TEST_ASSERT(v >= 0, "Every node ran");
+        }
+        TEST_ASSERT(sequence.load() == 40, "Every node ran exactly once");
+        TEST_ASSERT(order[0] < order[1] && order[0] < order[2], "Root before its successors");
+        TEST_ASSERT(order[1] < order[3] && order[2] < order[3], "Join waits for both branches");
+        for (size_t i = 3; i < 23; ++i) {
+            TEST_ASSERT(order[i] < order[i + 1], "Chain runs in order");
+        }
+    }
+
+#if FROGLORDS_PROFILE || FROGLORDS_MEMORY_TRACKING
+    // Reruns reuse the graph's scratch. Inline and one task queued at a time, so the deque
+    // stays in its first block and any allocation would be run()'s own.
+    job_system inline_jobs(0);
+    job_graph chain;
+    int steps = 0;
+    job_graph::node_id a = chain.add([&] { steps++; });
+    job_graph::node_id b = chain.add([&] { steps++; });
+    job_graph::node_id c = chain.add([&] { steps++; });
+    chain.precede(a, b);
+    chain.precede(b, c);
+    inline_jobs.run(chain);
+
+    uint64_t before = memory::allocation_count();
+    for (int run = 0; run < 50; ++run) {
+        inline_jobs.run(chain);
+    }
+    TEST_ASSERT(memory::allocation_count() == before, "Rerunning a graph does not allocate");
+    TEST_ASSERT(steps == 3 * 51, "Chain ran every time");
+#endif
+}
+
+// Test 5: Batched collision queries match serial resolution exactly
+void test_collision_batch() {
+    collision_world world;
+    for (int i = 0; i < 300; ++i) {
+        collision_box box;
+        box.bounds.center = random_vec3(-20.0f, 20.0f);
+        box.bounds.half_extents = random_vec3(0.2f, 2.0f);
+        world.boxes.push_back(box);
+    }
+    build_broadphase(world);
+
+    std::vector<sphere_query> queries;
+    for (int i = 0; i < 5000; ++i) {
+        sphere_query q;
+        q.collision_sphere = sphere{random_vec3(-20.0f, 20.0f), 0.5f};
+        q.position = q.collision_sphere.center + random_vec3(-0.5f, 0.5f);
+        q.velocity = random_vec3(-5.0f, 5.0f);
+        queries.push_back(q);
+    }
+
+    std::vector<sphere_query> serial = queries;
+    std::vector<sphere_collision> serial_contacts;
+    resolve_collisions_batch(serial, world, 0.707f, serial_contacts);
+
+    job_system jobs(WORKERS);
+    std::vector<sphere_query> parallel = queries;
+    std::vector<sphere_collision> parallel_contacts;
+    resolve_collisions_batch(parallel, world, 0.707f, parallel_contacts, &jobs);
+
+    int hits = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        TEST_ASSERT(serial[i].position == parallel[i].position, "Positions must match");
+        TEST_ASSERT(serial[i].velocity == parallel[i].velocity, "Velocities must match");
+        TEST_ASSERT(serial_contacts[i].hit == parallel_contacts[i].hit, "Hits must match");
+        TEST_ASSERT(serial_contacts[i].normal == parallel_contacts[i].normal, "Normals must match");
+        hits += serial_contacts[i].hit ? 1 : 0;
+    }
+    TEST_ASSERT(hits > 100, "Scenario must exercise collisions");
+}
+
+// Test 6: Parallel debug primitive generation produces the same list
+void test_debug_primitives() {
+    game_world world;
+    world.init();
+    for (int i = 0; i < 20000; ++i) {
+        collision_box box;
+        box.bounds.center = random_vec3(-200.0f, 200.0f);
+        box.bounds.half_extents = random_vec3(0.2f, 2.0f);
+        box.type = static_cast<collision_surface_type>(i % 4);
+        world.world_geometry.boxes.push_back(box);
+    }
+
+    debug::debug_primitive_list serial;
+    app::generate_debug_primitives(serial, world);
+
+    job_system jobs(WORKERS);
+    debug::debug_primitive_list parallel;
+    app::generate_debug_primitives(parallel, world, &jobs);
+
+    TEST_ASSERT(serial.boxes.size() == parallel.boxes.size(), "Box counts must match");
+    for (size_t i = 0; i < serial.boxes.size(); ++i) {
+        TEST_ASSERT(serial.boxes[i].transform == parallel.boxes[i].transform,
+                    "Box transforms must match");
+        TEST_ASSERT(serial.boxes[i].color == parallel.boxes[i].color, "Box colors must match");
+    }
+    TEST_ASSERT(serial.lines.size() == parallel.lines.size(), "Line counts must match");
+    TEST_ASSERT(serial.spheres.size() == parallel.spheres.size(), "Sphere counts must match");
+}
+
+int main() {
+    printf("=== Job System Tests ===\n\n");
+
+    RUN_TEST(test_parallel_for_coverage);
+    RUN_TEST(test_inline_system);
+    RUN_TEST(test_nested_parallel_for);
+    RUN_TEST(test_graph_dependencies);
+    RUN_TEST(test_collision_batch);
+    RUN_TEST(test_debug_primitives);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,182 @@
+// Memory Tracking Tests
+// Verifies per-tag attribution of live and peak bytes, nested tags, frees from another thread,
+// over-aligned allocations, allocations-per-frame windows and the text report
+
+#include "foundation/memory_tracking.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+// Allocations below are direct operator new calls: new-expressions may be elided
+
+void test_tag_attribution() {
+    memory::tag_stats mesh_before = memory::stats(memory::tag::MESH);
+    memory::tag_stats collision_before = memory::stats(memory::tag::COLLISION);
+
+    void* mesh = nullptr;
+    void* collision = nullptr;
+    {
+        FL_MEMORY_TAG(MESH);
+        mesh = ::operator new(1000);
+        {
+            FL_MEMORY_TAG(COLLISION);
+            collision = ::operator new(300);
+        }
+        // Inner scope restored the outer tag
+        void* more_mesh = ::operator new(24);
+        ::operator delete(more_mesh);
+    }
+
+    memory::tag_stats mesh_stats = memory::stats(memory::tag::MESH);
+    memory::tag_stats collision_stats = memory::stats(memory::tag::COLLISION);
+    TEST_ASSERT(mesh_stats.live_bytes - mesh_before.live_bytes == 1000, "Mesh live bytes");
+    TEST_ASSERT(mesh_stats.allocations - mesh_before.allocations == 2, "Mesh allocations");
+    TEST_ASSERT(mesh_stats.peak_bytes >= mesh_before.live_bytes + 1024, "Mesh peak");
+    TEST_ASSERT(collision_stats.live_bytes - collision_before.live_bytes == 300,
+                "Nested tag owns its allocation");
+    TEST_ASSERT(collision_stats.live_allocations - collision_before.live_allocations == 1,
+                "Collision live allocations");
+
+    ::operator delete(mesh);
+    ::operator delete(collision);
+    TEST_ASSERT(memory::stats(memory::tag::MESH).live_bytes == mesh_before.live_bytes,
+                "Freed bytes leave the tag");
+    TEST_ASSERT(memory::stats(memory::tag::COLLISION).live_allocations ==
+                    collision_before.live_allocations,
+                "Freed allocations leave the tag");
+    TEST_ASSERT(memory::stats(memory::tag::MESH).peak_bytes == mesh_stats.peak_bytes,
+                "Peak survives the free");
+}
+
+void test_cross_thread_free() {
+    memory::tag_stats before = memory::stats(memory::tag::RENDERING);
+
+    std::vector<int>* buffer = nullptr;
+    {
+        FL_MEMORY_TAG(RENDERING);
+        buffer = new std::vector<int>(256, 1);
+    }
+    TEST_ASSERT(memory::stats(memory::tag::RENDERING).live_allocations ==
+                    before.live_allocations + 2,
+                "Vector object and its storage tagged");
+
+    // Freed on a thread that has no tag: still charged back to the allocating tag
+    std::thread worker([buffer] { delete buffer; });
+    worker.join();
+
+    memory::tag_stats after = memory::stats(memory::tag::RENDERING);
+    TEST_ASSERT(after.live_bytes == before.live_bytes, "Other thread's free credited");
+    TEST_ASSERT(after.live_allocations == before.live_allocations, "Live count restored");
+}
+
+void test_aligned_allocations() {
+    memory::tag_stats before = memory::stats(memory::tag::DEBUG);
+
+    FL_MEMORY_TAG(DEBUG);
+    for (size_t alignment : {16u, 32u, 64u, 256u, 4096u}) {
+        void* p = ::operator new(100, std::align_val_t(alignment));
+        TEST_ASSERT(reinterpret_cast<uintptr_t>(p) % alignment == 0, "Requested alignment");
+        std::memset(p, 0xAB, 100);
+        TEST_ASSERT(memory::stats(memory::tag::DEBUG).live_bytes == before.live_bytes + 100,
+                    "Aligned allocation counted");
+        ::operator delete(p, std::align_val_t(alignment));
+    }
+
+    // Default alignment holds for the plain form too
+    void* p = ::operator new(1);
+    TEST_ASSERT(reinterpret_cast<uintptr_t>(p) % alignof(std::max_align_t) == 0,
+                "Default alignment");
+    ::operator delete(p, size_t(1));
+
+    TEST_ASSERT(memory::stats(memory::tag::DEBUG).live_bytes == before.live_bytes,
+                "All aligned memory released");
+}
+
+void test_frame_allocations() {
+    memory::end_frame();
+
+    {
+        FL_MEMORY_TAG(GUI);
+        for (int i = 0; i < 5; ++i) {
+            ::operator delete(::operator new(32));
+        }
+    }
+    TEST_ASSERT(memory::stats(memory::tag::GUI).frame_allocations == 0,
+                "Open frame not reported yet");
+
+    memory::end_frame();
+    TEST_ASSERT(memory::stats(memory::tag::GUI).frame_allocations == 5, "Closed frame counted");
+
+    memory::end_frame();
+    TEST_ASSERT(memory::stats(memory::tag::GUI).frame_allocations == 0, "Quiet frame is zero");
+}
+
+void test_allocation_count_sees_every_tag() {
+    uint64_t before = memory::allocation_count();
+    {
+        FL_MEMORY_TAG(COLLISION);
+        ::operator delete(::operator new(8));
+    }
+    ::operator delete(::operator new(8));
+    TEST_ASSERT(memory::allocation_count() - before == 2, "Tagged and untagged counted");
+}
+
+void test_write_report() {
+    const char* path = "test_memory_tracking_report.txt";
+    TEST_ASSERT(memory::write_report(path), "Report written");
+
+    std::FILE* file = std::fopen(path, "r");
+    TEST_ASSERT(file != nullptr, "Report readable");
+    std::string contents;
+    char line[256];
+    while (std::fgets(line, sizeof(line), file) != nullptr) {
+        contents += line;
+    }
+    std::fclose(file);
+    std::remove(path);
+
+    for (int i = 0; i < memory::TAG_COUNT; ++i) {
+        TEST_ASSERT(contents.find(memory::tag_name(static_cast<memory::tag>(i))) !=
+                        std::string::npos,
+                    "Every tag listed");
+    }
+    TEST_ASSERT(contents.find("total") != std::string::npos, "Totals row");
+    TEST_ASSERT(contents.find("peak_bytes") != std::string::npos, "Header row");
+
+    TEST_ASSERT(!memory::write_report("no_such_directory/report.txt"), "Unwritable path fails");
+}
+
+int main() {
+    printf("=== Memory Tracking Tests ===\n\n");
+
+    RUN_TEST(test_tag_attribution);
+    RUN_TEST(test_cross_thread_free);
+    RUN_TEST(test_aligned_allocations);
+    RUN_TEST(test_frame_allocations);
+    RUN_TEST(test_allocation_count_sees_every_tag);
+    RUN_TEST(test_write_report);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,191 @@
+// Mesh Buffer Tests
+// Verifies that the *_size functions are exact and that the span overloads write the same
+// vertices and edges as the wireframe_mesh generators, for 16- and 32-bit indices
+
+#include "foundation/procedural_mesh.h"
+#include "test_common.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+glm::vec3 random_horizontal_dir() {
+    float angle = random_float(-3.14159f, 3.14159f);
+    return glm::vec3(std::cos(angle), 0.0f, std::sin(angle));
+}
+
+// Buffers exactly the reported size, plus sentinels past the end to catch overruns
+template <typename Index>
+struct sized_buffers {
+    static constexpr size_t SLACK = 4;
+    static constexpr Index SENTINEL = static_cast<Index>(0xBEEF);
+
+    std::vector<glm::vec3> vertices;
+    std::vector<Index> indices;
+    foundation::mesh_size size;
+
+    explicit sized_buffers(foundation::mesh_size reported)
+        : vertices(reported.vertices + SLACK, glm::vec3(-999.0f))
+        , indices(reported.indices + SLACK, SENTINEL)
+        , size(reported) {}
+
+    foundation::mesh_buffers<Index> exact() {
+        return {std::span<glm::vec3>(vertices.data(), size.vertices),
+                std::span<Index>(indices.data(), size.indices)};
+    }
+
+    bool untouched_past_end() const {
+        for (size_t i = 0; i < SLACK; ++i) {
+            if (vertices[size.vertices + i] != glm::vec3(-999.0f) ||
+                indices[size.indices + i] != SENTINEL) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Reported size, written counts, and contents all agree with the vector generator (bit-exact:
+// both overloads run the same code)
+template <typename Index>
+void assert_matches(foundation::mesh_size reported, sized_buffers<Index>& buffers,
+                    foundation::mesh_size written, const foundation::wireframe_mesh& mesh) {
+    TEST_ASSERT(reported.vertices == mesh.vertices.size(), "Size reports vertex count");
+    TEST_ASSERT(reported.indices == mesh.edges.size() * 2, "Size reports index count");
+    TEST_ASSERT(written.vertices == reported.vertices && written.indices == reported.indices,
+                "Writes exactly the reported size");
+    TEST_ASSERT(buffers.untouched_past_end(), "No writes past the reported size");
+    for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+        TEST_ASSERT(buffers.vertices[i] == mesh.vertices[i], "Same vertices");
+    }
+    for (size_t i = 0; i < mesh.edges.size(); ++i) {
+        TEST_ASSERT(buffers.indices[i * 2] == static_cast<Index>(mesh.edges[i].v0) &&
+                        buffers.indices[i * 2 + 1] == static_cast<Index>(mesh.edges[i].v1),
+                    "Same edges in the same order");
+    }
+}
+
+template <typename Index>
+void check_all_generators() {
+    for (int trial = 0; trial < 40; ++trial) {
+        // Includes the degenerate and clamped cases: zero radius, < 3 segments, no divisions
+        foundation::sphere_config sphere{trial % 12, (trial * 5) % 11,
+                                         trial % 7 == 0 ? 0.0f : random_float(0.1f, 5.0f)};
+        foundation::mesh_size size = foundation::sphere_size(sphere);
+        sized_buffers<Index> sphere_out(size);
+        assert_matches(size, sphere_out, foundation::generate_sphere(sphere, sphere_out.exact()),
+                       foundation::generate_sphere(sphere));
+
+        foundation::box_dimensions dims{random_float(0.1f, 5.0f), random_float(0.1f, 5.0f),
+                                        random_float(0.1f, 5.0f)};
+        sized_buffers<Index> box_out(foundation::box_size());
+        assert_matches(foundation::box_size(), box_out,
+                       foundation::generate_box(dims, box_out.exact()),
+                       foundation::generate_box(dims));
+
+        int divisions = trial % 9 - 1;
+        float grid_size = random_float(1.0f, 50.0f);
+        size = foundation::grid_floor_size(divisions);
+        sized_buffers<Index> grid_out(size);
+        assert_matches(size, grid_out,
+                       foundation::generate_grid_floor(grid_size, divisions, grid_out.exact()),
+                       foundation::generate_grid_floor(grid_size, divisions));
+
+        glm::vec3 start = random_vec3(-10.0f, 10.0f);
+        glm::vec3 end = trial % 5 == 0 ? start : start + random_vec3(-5.0f, 5.0f);
+        float head = random_float(0.05f, 1.0f);
+        size = foundation::arrow_size(start, end);
+        sized_buffers<Index> arrow_out(size);
+        assert_matches(size, arrow_out,
+                       foundation::generate_arrow(start, end, head, arrow_out.exact()),
+                       foundation::generate_arrow(start, end, head));
+
+        sized_buffers<Index> head_out(foundation::arrow_head_size());
+        assert_matches(foundation::arrow_head_size(), head_out,
+                       foundation::generate_arrow_head(head_out.exact()),
+                       foundation::generate_arrow_head());
+
+        glm::vec3 center = random_vec3(-100.0f, 100.0f);
+        foundation::circle_config circle{random_float(0.1f, 5.0f), trial % 40 - 2};
+        size = foundation::circle_size(circle);
+        sized_buffers<Index> circle_out(size);
+        assert_matches(size, circle_out,
+                       foundation::generate_circle(center, circle, circle_out.exact()),
+                       foundation::generate_circle(center, circle));
+
+        // Parallel directions produce an empty arc
+        glm::vec3 start_dir = random_horizontal_dir();
+        glm::vec3 end_dir = trial % 6 == 0 ? start_dir : random_horizontal_dir();
+        float arc_radius = random_float(0.1f, 5.0f);
+        int arc_segments = 3 + trial % 60;
+        size = foundation::arc_size(start_dir, end_dir, arc_radius, arc_segments);
+        sized_buffers<Index> arc_out(size);
+        assert_matches(size, arc_out,
+                       foundation::generate_arc(center, start_dir, end_dir, arc_radius,
+                                                arc_segments, arc_out.exact()),
+                       foundation::generate_arc(center, start_dir, end_dir, arc_radius,
+                                                arc_segments));
+
+        int coils = trial % 10 - 1;
+        float spring_radius = trial % 8 == 0 ? 0.0f : random_float(0.01f, 0.5f);
+        size = foundation::spring_size(start, end, coils, spring_radius);
+        sized_buffers<Index> spring_out(size);
+        assert_matches(size, spring_out,
+                       foundation::generate_spring(start, end, coils, spring_radius,
+                                                   spring_out.exact()),
+                       foundation::generate_spring(start, end, coils, spring_radius));
+    }
+}
+
+void test_uint32_buffers() {
+    check_all_generators<uint32_t>();
+}
+
+void test_uint16_buffers() {
+    check_all_generators<uint16_t>();
+
+    // 255 x 255 grid: 65536 vertices, the most a 16-bit index can address
+    foundation::mesh_size size = foundation::grid_floor_size(255);
+    TEST_ASSERT(size.vertices == 65536, "Largest 16-bit grid");
+    sized_buffers<uint16_t> out(size);
+    foundation::mesh_size written = foundation::generate_grid_floor(100.0f, 255, out.exact());
+    TEST_ASSERT(written.indices == size.indices, "Full grid written");
+    TEST_ASSERT(out.indices[written.indices - 1] == 65535, "Last vertex addressed");
+}
+
+void test_oversized_buffers() {
+    // Larger buffers are fine; only the returned counts are written
+    std::vector<glm::vec3> vertices(100);
+    std::vector<uint32_t> indices(100);
+    foundation::mesh_size written =
+        foundation::generate_circle<uint32_t>(glm::vec3(0.0f), {1.0f, 16}, {vertices, indices});
+    TEST_ASSERT(written.vertices == 16 && written.indices == 32, "Circle counts");
+}
+
+int main() {
+    printf("=== Mesh Buffer Tests ===\n\n");
+
+    RUN_TEST(test_uint32_buffers);
+    RUN_TEST(test_uint16_buffers);
+    RUN_TEST(test_oversized_buffers);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
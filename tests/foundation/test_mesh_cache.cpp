@@ -0,0 +1,155 @@
+// Mesh Cache Tests
+// Verifies that cached unit meshes, once transformed, match the direct generators, that equal
+// configurations share one mesh, and the hit/miss counters
+
+#include "foundation/mesh_cache.h"
+#include "test_common.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+// Same topology, and every transformed vertex within tolerance of the direct mesh's
+void assert_matches(const foundation::cached_mesh& cached,
+                    const foundation::wireframe_mesh& direct, float tolerance) {
+    const foundation::wireframe_mesh& unit = *cached.mesh;
+    TEST_ASSERT(unit.vertices.size() == direct.vertices.size(), "Vertex count");
+    TEST_ASSERT(unit.edges.size() == direct.edges.size(), "Edge count");
+    for (size_t i = 0; i < unit.edges.size(); ++i) {
+        TEST_ASSERT(unit.edges[i].v0 == direct.edges[i].v0 &&
+                        unit.edges[i].v1 == direct.edges[i].v1,
+                    "Same edges");
+    }
+    glm::mat4 direct_model = direct.get_model_matrix();
+    for (size_t i = 0; i < unit.vertices.size(); ++i) {
+        glm::vec3 a = glm::vec3(cached.transform * glm::vec4(unit.vertices[i], 1.0f));
+        glm::vec3 b = glm::vec3(direct_model * glm::vec4(direct.vertices[i], 1.0f));
+        TEST_ASSERT(glm::length(a - b) <= tolerance, "Transformed vertex matches generator");
+    }
+}
+
+void test_matches_generators() {
+    foundation::mesh_cache cache;
+    for (int trial = 0; trial < 50; ++trial) {
+        float radius = random_float(0.05f, 20.0f);
+        int segments = 3 + trial % 30;
+        int rings = 3 + (trial * 7) % 20;
+        assert_matches(cache.sphere({segments, rings, radius}),
+                       foundation::generate_sphere({segments, rings, radius}), radius * 1e-5f);
+
+        foundation::box_dimensions dims{random_float(0.1f, 5.0f), random_float(0.1f, 5.0f),
+                                        random_float(0.1f, 5.0f)};
+        assert_matches(cache.box(dims), foundation::generate_box(dims), 1e-5f);
+
+        glm::vec3 center = random_vec3(-100.0f, 100.0f);
+        foundation::circle_config circle{radius, segments};
+        assert_matches(cache.circle(center, circle), foundation::generate_circle(center, circle),
+                       1e-4f);
+
+        // Arrow head: generate_arrow's vertices 1..5 are the tip and base ring
+        glm::vec3 start = random_vec3(-10.0f, 10.0f);
+        glm::vec3 end = start + random_vec3(-5.0f, 5.0f);
+        float head = random_float(0.05f, 1.0f);
+        foundation::cached_mesh arrow = cache.arrow_head(start, end, head);
+        foundation::wireframe_mesh direct = foundation::generate_arrow(start, end, head);
+        TEST_ASSERT(direct.vertices.size() == 6, "Non-degenerate arrow");
+        for (size_t i = 0; i < arrow.mesh->vertices.size(); ++i) {
+            glm::vec3 v = glm::vec3(arrow.transform * glm::vec4(arrow.mesh->vertices[i], 1.0f));
+            TEST_ASSERT(glm::length(v - direct.vertices[i + 1]) < 1e-4f, "Arrow head matches");
+        }
+    }
+
+    // Empty circles stay empty; degenerate arrows collapse
+    TEST_ASSERT(cache.circle(glm::vec3(0.0f), {1.0f, 0}).mesh->vertices.empty(), "No segments");
+    foundation::cached_mesh degenerate = cache.arrow_head(glm::vec3(1.0f), glm::vec3(1.0f), 0.2f);
+    TEST_ASSERT(degenerate.transform == glm::mat4(0.0f), "Degenerate arrow has zero transform");
+}
+
+void test_sharing_and_counters() {
+    foundation::mesh_cache cache;
+    foundation::cached_mesh a = cache.sphere({8, 8, 1.0f});
+    foundation::cached_mesh b = cache.sphere({8, 8, 3.0f});
+    foundation::cached_mesh c = cache.sphere({8, 6, 1.0f});
+    foundation::cached_mesh d = cache.sphere({1, 2, 1.0f}); // clamped to 3 x 3
+    foundation::cached_mesh e = cache.sphere({3, 3, 1.0f});
+
+    TEST_ASSERT(a.mesh == b.mesh, "Radius does not change the key");
+    TEST_ASSERT(a.mesh != c.mesh, "Rings do");
+    TEST_ASSERT(d.mesh == e.mesh, "Clamped tessellation shares a mesh");
+
+    TEST_ASSERT(cache.box({1.0f, 2.0f, 3.0f}).mesh == cache.box({4.0f, 5.0f, 6.0f}).mesh,
+                "One unit box");
+
+    foundation::mesh_cache_stats stats = cache.stats();
+    TEST_ASSERT(stats.misses == 4, "One miss per distinct mesh");
+    TEST_ASSERT(stats.hits == 3, "Repeats hit");
+    TEST_ASSERT(stats.entries == 4, "Four meshes held");
+    TEST_ASSERT(std::abs(stats.hit_rate() - 3.0f / 7.0f) < 1e-6f, "Hit rate");
+
+    cache.reset_stats();
+    TEST_ASSERT(cache.stats().hits == 0 && cache.stats().misses == 0, "Stats reset");
+    TEST_ASSERT(cache.stats().entries == 4, "Reset keeps meshes");
+
+    cache.clear();
+    TEST_ASSERT(cache.stats().entries == 0, "Cleared");
+    TEST_ASSERT(a.mesh->vertices.size() == 8 * 7 + 2, "Outstanding handles survive clear");
+    TEST_ASSERT(cache.sphere({8, 8, 1.0f}).mesh != a.mesh, "Regenerated after clear");
+}
+
+void test_concurrent_requests() {
+    foundation::mesh_cache cache;
+    constexpr int THREADS = 8;
+    constexpr int REQUESTS = 2000;
+    std::vector<std::thread> threads;
+    std::vector<const foundation::wireframe_mesh*> first(THREADS, nullptr);
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&cache, &first, t]() {
+            for (int i = 0; i < REQUESTS; ++i) {
+                foundation::cached_mesh mesh = cache.circle(glm::vec3(0.0f), {1.0f, 3 + i % 16});
+                if (i == 0) {
+                    first[t] = mesh.mesh.get();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    foundation::mesh_cache_stats stats = cache.stats();
+    TEST_ASSERT(stats.entries == 16, "Each key generated once");
+    TEST_ASSERT(stats.misses == 16, "No duplicate generation");
+    TEST_ASSERT(stats.hits + stats.misses == THREADS * REQUESTS, "Every request counted");
+    for (int t = 1; t < THREADS; ++t) {
+        TEST_ASSERT(first[t] == first[0], "Threads share the mesh");
+    }
+}
+
+int main() {
+    printf("=== Mesh Cache Tests ===\n\n");
+
+    RUN_TEST(test_matches_generators);
+    RUN_TEST(test_sharing_and_counters);
+    RUN_TEST(test_concurrent_requests);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
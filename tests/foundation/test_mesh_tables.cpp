@@ -0,0 +1,104 @@
+// Mesh Table Tests
+// Verifies that compile-time mesh tables match the runtime procedural generators: same
+// topology in the same order, and vertices within float rounding
+
+#include "foundation/mesh_tables.h"
+#include "foundation/procedural_mesh.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+// Built by the compiler: these fail the build, not the run, if table generation breaks
+constexpr auto SPHERE_8 = foundation::make_sphere_table<8, 8>();
+constexpr auto SPHERE_5x3 = foundation::make_sphere_table<5, 3>();
+constexpr auto BOX = foundation::make_box_table(0.6f, 0.4f, 1.2f);
+constexpr auto CIRCLE_32 = foundation::make_circle_table<32>();
+constexpr auto CIRCLE_3 = foundation::make_circle_table<3>();
+constexpr auto GRID = foundation::make_grid_table<40>(40.0f);
+constexpr auto ARROW_HEAD = foundation::make_arrow_head_table();
+
+static_assert(SPHERE_8.vertices.size() == 2 + 7 * 8, "Sphere vertex count");
+static_assert(SPHERE_8.vertices[0].y == 1.0f, "Top pole first");
+static_assert(CIRCLE_32.vertices[0].x == 1.0f && CIRCLE_32.vertices[0].z == 0.0f,
+              "Circle starts on +X");
+static_assert(GRID.indices.size() == 2 * 2 * 40 * 41, "Grid edge count");
+static_assert(BOX.vertices[7].x == 0.3f && BOX.vertices[7].z == -0.6f, "Box corner 7");
+
+// Same edges in the same order, every vertex within tolerance
+template <size_t V, size_t E>
+void assert_matches(const foundation::mesh_table<V, E>& table,
+                    const foundation::wireframe_mesh& mesh, float tolerance) {
+    TEST_ASSERT(table.vertices.size() == mesh.vertices.size(), "Vertex count");
+    TEST_ASSERT(table.indices.size() == mesh.edges.size() * 2, "Edge count");
+    for (size_t i = 0; i < mesh.edges.size(); ++i) {
+        TEST_ASSERT(table.indices[i * 2] == static_cast<uint32_t>(mesh.edges[i].v0) &&
+                        table.indices[i * 2 + 1] == static_cast<uint32_t>(mesh.edges[i].v1),
+                    "Same edge order");
+    }
+    for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+        TEST_ASSERT(glm::length(table.vertices[i] - mesh.vertices[i]) <= tolerance,
+                    "Vertex matches generator");
+    }
+}
+
+void test_spheres() {
+    assert_matches(SPHERE_8, foundation::generate_sphere({8, 8, 1.0f}), 1e-6f);
+    assert_matches(SPHERE_5x3, foundation::generate_sphere({5, 3, 1.0f}), 1e-6f);
+    assert_matches(foundation::make_sphere_table<6, 6>(),
+                   foundation::generate_sphere({6, 6, 1.0f}), 1e-6f);
+    assert_matches(foundation::make_sphere_table<4, 4>(),
+                   foundation::generate_sphere({4, 4, 1.0f}), 1e-6f);
+    assert_matches(foundation::make_sphere_table<32, 16>(),
+                   foundation::generate_sphere({32, 16, 1.0f}), 1e-6f);
+}
+
+void test_boxes() {
+    assert_matches(BOX, foundation::generate_box({0.6f, 0.4f, 1.2f}), 0.0f);
+    assert_matches(foundation::make_box_table(2.0f, 2.0f, 2.0f),
+                   foundation::generate_box({2.0f, 2.0f, 2.0f}), 0.0f);
+}
+
+void test_circles() {
+    assert_matches(CIRCLE_32, foundation::generate_circle(glm::vec3(0.0f), {1.0f, 32}), 1e-6f);
+    assert_matches(CIRCLE_3, foundation::generate_circle(glm::vec3(0.0f), {1.0f, 3}), 1e-6f);
+}
+
+void test_grid() {
+    // Same float arithmetic as the generator: bit-identical
+    assert_matches(GRID, foundation::generate_grid_floor(40.0f, 40), 0.0f);
+    assert_matches(foundation::make_grid_table<7>(13.5f),
+                   foundation::generate_grid_floor(13.5f, 7), 0.0f);
+}
+
+void test_arrow_head() {
+    assert_matches(ARROW_HEAD, foundation::generate_arrow_head(), 1e-6f);
+}
+
+int main() {
+    printf("=== Mesh Table Tests ===\n\n");
+
+    RUN_TEST(test_spheres);
+    RUN_TEST(test_boxes);
+    RUN_TEST(test_circles);
+    RUN_TEST(test_grid);
+    RUN_TEST(test_arrow_head);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+// Shared test fixtures: deterministic random numbers and random collision worlds
+//
+// Each test executable is a single translation unit, so the generator state is one inline
+// variable per test and sequences restart at the same seed in every run.
+
+#include "foundation/collision.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+// Deterministic LCG so failures reproduce across platforms
+inline uint32_t rng_state = 12345u;
+
+inline float random_float(float lo, float hi) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    float t = static_cast<float>(rng_state >> 8) / 16777216.0f;
+    return lo + (hi - lo) * t;
+}
+
+inline glm::vec3 random_vec3(float lo, float hi) {
+    return glm::vec3(random_float(lo, hi), random_float(lo, hi), random_float(lo, hi));
+}
+
+// Box centered in [-extent, extent]³ with half extents in [0.2, 2]
+inline collision_box random_box(float extent,
+                                collision_surface_type type = collision_surface_type::NONE) {
+    collision_box box;
+    box.bounds.center = random_vec3(-extent, extent);
+    box.bounds.half_extents = random_vec3(0.2f, 2.0f);
+    box.type = type;
+    return box;
+}
+
+// World of random_box boxes; build = false leaves the broadphase empty (linear fallback)
+inline collision_world make_random_world(int box_count, float extent, bool build = true) {
+    collision_world world;
+    for (int i = 0; i < box_count; ++i) {
+        world.boxes.push_back(random_box(extent));
+    }
+    if (build) {
+        build_broadphase(world);
+    }
+    return world;
+}
@@ -0,0 +1,212 @@
+// Vehicle Fleet Tests
+// Verifies the SoA fleet update against controller::apply_input + update bit-for-bit
+
+#include "vehicle/vehicle_fleet.h"
+#include "vehicle/controller.h"
+#include "foundation/collision.h"
+#include "foundation/job_system.h"
+#include "foundation/math_utils.h"
+#include "test_common.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Test utilities
+#define TEST_ASSERT(cond, msg) \
+    do { \
+        if (!(cond)) { \
+            printf("FAIL: %s\n  at %s:%d\n  condition: %s\n", msg, __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        printf("Running %s...\n", #test_func); \
+        test_func(); \
+        printf("  PASS\n"); \
+    } while (0)
+
+bool same_bits(float a, float b) {
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+controller make_random_controller() {
+    controller c;
+    c.position = glm::vec3(random_float(-50.0f, 50.0f), random_float(0.0f, 5.0f),
+                           random_float(-50.0f, 50.0f));
+    c.velocity = glm::vec3(random_float(-8.0f, 8.0f), 0.0f, random_float(-8.0f, 8.0f));
+    c.heading_yaw = random_float(-3.14f, 3.14f);
+    c.accel = random_float(2.0f, 30.0f);
+    c.max_speed = random_float(4.0f, 40.0f);
+    c.mass = random_float(50.0f, 2000.0f);
+    c.turn_rate = random_float(0.5f, 6.0f);
+    c.steering_reduction_factor = random_float(0.0f, 1.0f);
+    c.handbrake.brake_rate = random_float(0.0f, 10.0f);
+    c.collision_sphere.center = c.position;
+    return c;
+}
+
+// Mix of full stick, partial stick, and idle (so zero-velocity snapping triggers)
+controller_input_params make_random_input() {
+    controller_input_params input;
+    bool idle = random_float(0.0f, 1.0f) < 0.3f;
+    input.move_direction = idle ? glm::vec2(0.0f)
+                                : glm::vec2(random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f));
+    input.turn_input = idle ? 0.0f : random_float(-1.0f, 1.0f);
+    input.handbrake = random_float(0.0f, 1.0f) < 0.2f;
+    return input;
+}
+
+void check_matches(const vehicle_fleet& fleet, const std::vector<controller>& reference) {
+    for (size_t i = 0; i < reference.size(); ++i) {
+        const controller& c = reference[i];
+        TEST_ASSERT(same_bits(fleet.position_x[i], c.position.x), "position.x must match");
+        TEST_ASSERT(same_bits(fleet.position_y[i], c.position.y), "position.y must match");
+        TEST_ASSERT(same_bits(fleet.position_z[i], c.position.z), "position.z must match");
+        TEST_ASSERT(same_bits(fleet.velocity_x[i], c.velocity.x), "velocity.x must match");
+        TEST_ASSERT(same_bits(fleet.velocity_y[i], c.velocity.y), "velocity.y must match");
+        TEST_ASSERT(same_bits(fleet.velocity_z[i], c.velocity.z), "velocity.z must match");
+        TEST_ASSERT(same_bits(fleet.heading_yaw[i], c.heading_yaw), "heading_yaw must match");
+        TEST_ASSERT(same_bits(fleet.angular_velocity[i], c.angular_velocity),
+                    "angular_velocity must match");
+    }
+}
+
+// Test 1: add() copies controller state and tuning
+void test_add() {
+    vehicle_fleet fleet;
+    controller c = make_random_controller();
+    size_t index = fleet.add(c);
+
+    TEST_ASSERT(index == 0 && fleet.size() == 1, "First vehicle gets index 0");
+    TEST_ASSERT(fleet.position_x[0] == c.position.x, "Position copied");
+    TEST_ASSERT(fleet.heading_yaw[0] == c.heading_yaw, "Heading copied");
+    TEST_ASSERT(fleet.max_speed[0] == c.max_speed, "Tuning copied");
+    TEST_ASSERT(fleet.brake_rate[0] == c.handbrake.brake_rate, "Brake rate copied");
+    TEST_ASSERT(fleet.move_x[0] == 0.0f && fleet.handbrake[0] == 0, "Input starts idle");
+
+    fleet.clear();
+    TEST_ASSERT(fleet.size() == 0, "clear() removes all vehicles");
+}
+
+// Test 2: Many vehicles over many ticks with random input match controller exactly
+void test_matches_controller() {
+    const int vehicle_count = 257; // Not a multiple of any vector width
+    const int ticks = 600;
+    const float dt = 1.0f / 60.0f;
+    const collision_world empty_world;
+
+    std::vector<controller> reference;
+    vehicle_fleet fleet;
+    for (int i = 0; i < vehicle_count; ++i) {
+        reference.push_back(make_random_controller());
+        fleet.add(reference.back());
+    }
+
+    int snapped = 0;
+    int heading_wraps = 0;
+    for (int tick = 0; tick < ticks; ++tick) {
+        for (int i = 0; i < vehicle_count; ++i) {
+            // Hold input for a while so vehicles reach speed, turn through ±π, and coast to rest
+            if (tick % 90 == 0) {
+                fleet.set_input(static_cast<size_t>(i), make_random_input());
+            }
+        }
+
+        for (int i = 0; i < vehicle_count; ++i) {
+            controller& c = reference[static_cast<size_t>(i)];
+            size_t index = static_cast<size_t>(i);
+
+            controller_input_params input;
+            input.move_direction = glm::vec2(fleet.move_x[index], fleet.move_y[index]);
+            input.turn_input = fleet.turn_input[index];
+            input.handbrake = fleet.handbrake[index] != 0;
+
+            controller::camera_input_params basis;
+            basis.forward = math::yaw_to_forward(c.heading_yaw);
+            basis.right = math::yaw_to_right(c.heading_yaw);
+
+            float previous_yaw = c.heading_yaw;
+            c.apply_input(input, basis, dt);
+            c.update(&empty_world, dt);
+
+            heading_wraps += (previous_yaw > 3.0f && c.heading_yaw < -3.0f) ||
+                                     (previous_yaw < -3.0f && c.heading_yaw > 3.0f)
+                                 ? 1
+                                 : 0;
+            snapped += (c.velocity.x == 0.0f && c.velocity.z == 0.0f) ? 1 : 0;
+        }
+        fleet.update(dt);
+
+        check_matches(fleet, reference);
+    }
+
+    TEST_ASSERT(heading_wraps > 0, "Scenario must wrap heading across ±π");
+    TEST_ASSERT(snapped > 0, "Scenario must exercise zero-velocity snapping");
+}
+
+// Test 3: Out-of-range heading deltas (far outside ±2π) take the exact wrap fallback
+void test_large_turn_step() {
+    const float dt = 0.5f;
+    const collision_world empty_world;
+
+    controller c = make_random_controller();
+    c.turn_rate = 40.0f; // 20 rad per step
+    c.steering_reduction_factor = 0.0f;
+
+    vehicle_fleet fleet;
+    fleet.add(c);
+
+    controller_input_params input{glm::vec2(0.0f, 1.0f), 1.0f, false};
+    fleet.set_input(0, input);
+    for (int tick = 0; tick < 10; ++tick) {
+        controller::camera_input_params basis;
+        basis.forward = math::yaw_to_forward(c.heading_yaw);
+        basis.right = math::yaw_to_right(c.heading_yaw);
+        c.apply_input(input, basis, dt);
+        c.update(&empty_world, dt);
+        fleet.update(dt);
+
+        check_matches(fleet, std::vector<controller>{c});
+    }
+}
+
+// Test 4: Updating blocks in parallel gives the same bits as the serial update
+void test_parallel_update() {
+    const int vehicle_count = 10000; // Several job grains of blocks, plus a partial block
+    vehicle_fleet serial;
+    for (int i = 0; i < vehicle_count; ++i) {
+        serial.add(make_random_controller());
+        serial.set_input(static_cast<size_t>(i), make_random_input());
+    }
+    vehicle_fleet parallel = serial;
+
+    job_system jobs(3);
+    for (int tick = 0; tick < 120; ++tick) {
+        serial.update(1.0f / 60.0f);
+        parallel.update(1.0f / 60.0f, &jobs);
+    }
+
+    size_t bytes = sizeof(float) * static_cast<size_t>(vehicle_count);
+    TEST_ASSERT(std::memcmp(serial.position_x.data(), parallel.position_x.data(), bytes) == 0,
+                "Parallel positions must match serial");
+    TEST_ASSERT(std::memcmp(serial.velocity_z.data(), parallel.velocity_z.data(), bytes) == 0,
+                "Parallel velocities must match serial");
+    TEST_ASSERT(std::memcmp(serial.heading_yaw.data(), parallel.heading_yaw.data(), bytes) == 0,
+                "Parallel headings must match serial");
+}
+
+int main() {
+    printf("=== Vehicle Fleet Tests ===\n\n");
+
+    RUN_TEST(test_add);
+    RUN_TEST(test_matches_controller);
+    RUN_TEST(test_large_turn_step);
+    RUN_TEST(test_parallel_update);
+
+    printf("\n=== All tests passed! ===\n");
+    return 0;
+}